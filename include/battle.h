@@ -3,72 +3,14 @@
 #define BATTLE_H
 
 #include <stdbool.h>
-
-typedef struct PokeMonster PokeMonster;
-typedef struct MonsterList MonsterList;
-typedef struct Attack Attack;
-typedef struct BattleSystem BattleSystem;
-extern bool actionQueueReady;
-
-
-
-
-// Estados de batalha
-typedef enum {
-    BATTLE_IDLE = 0,
-    BATTLE_INTRO_ANIMATION,  // NOVO ESTADO para animação de pokébolas
-    BATTLE_INTRO,
-    BATTLE_SELECT_ACTION,
-    BATTLE_SELECT_ATTACK,
-    BATTLE_SELECT_MONSTER,
-    BATTLE_ITEM_MENU,
-    BATTLE_PREPARING_ACTIONS,
-    BATTLE_EXECUTING_ACTIONS,
-    BATTLE_ATTACK_ANIMATION,
-    BATTLE_DAMAGE_ANIMATION,
-    BATTLE_MESSAGE_DISPLAY,
-    BATTLE_RESULT_MESSAGE,
-    BATTLE_TURN_END,
-    BATTLE_OVER,
-    BATTLE_CONFIRM_QUIT,
-    BATTLE_FORCED_SWITCH
-} BattleState;
-
-// Adicionar estruturas necessárias
-typedef struct {
-    char message[256];
-    float displayTime;
-    float elapsedTime;
-    bool waitingForInput;
-    bool autoAdvance;
-} BattleMessage;
-
-typedef struct {
-    bool isAnimating;
-    float animationTime;
-    float elapsedTime;
-    int animationType;
-    PokeMonster* source;
-    PokeMonster* target;
-} BattleAnimation;
-
-// Tipos de itens
-typedef enum {
-    ITEM_POTION = 0,
-    ITEM_RED_CARD,
-    ITEM_COIN
-} ItemType;
-
-// Tipos de status
-typedef enum {
-    STATUS_NONE = 0,
-    STATUS_ATK_DOWN = 1,
-    STATUS_DEF_DOWN = 2,
-    STATUS_SPD_DOWN = 3,
-    STATUS_PARALYZED = 4,
-    STATUS_SLEEPING = 5,
-    STATUS_BURNING = 6
-} StatusType;
+#include "battle_rules.h"  // Regras da batalha (núcleo sem Raylib)
+#include "battle_bot.h"    // Decisões locais do bot (núcleo)
+#include "battle_search.h" // Bot de busca, com tempo pela dificuldade
+#include "battle_mcts.h"   // Bot MCTS (nível mestre)
+#include "endgame_table.h" // Finais 1x1 resolvidos (resources/endgame.bin)
+#include "damage_cache.h"  // Distribuição exata de dano da batalha atual
+#include "policy_net.h"    // Rede de política local (resources/policy.bin)
+#include "decision_cache.h" // Decisões da IA online guardadas em disco (ai_cache.bin)
 
 // Protótipos das funções existentes
 void initializeBattleSystem(void);
@@ -76,31 +18,13 @@ void freeBattleSystem(void);
 void startNewBattle(MonsterList* playerTeam, MonsterList* opponentTeam);
 void updateBattle(void);
 void processBattleInput(void);
-void executeAttack(PokeMonster* attacker, PokeMonster* defender, int attackIndex);
-int calculateDamage(PokeMonster* attacker, PokeMonster* defender, Attack* attack);
-void applyStatusEffect(PokeMonster* target, int statusEffect, int statusPower, int duration);
-void processTurnEnd(void);
-bool isBattleOver(void);
-int getBattleWinner(void);
 void determineTurnOrder(void);
-ItemType rollRandomItem(void);
-void useItem(ItemType itemType, PokeMonster* target);
-bool isMonsterFainted(PokeMonster* monster);
-void switchMonster(MonsterList* team, PokeMonster* newMonster);
 void botChooseAction(void);
-int botChooseAttack(PokeMonster* botMonster, PokeMonster* playerMonster);
-PokeMonster* botChooseMonster(MonsterList* botTeam, PokeMonster* playerMonster);
 const char* getBattleDescription(void);
 void resetBattle(void);
-int getAISuggestedActionSimple(PokeMonster* botMonster, PokeMonster* playerMonster);
 bool canAttack(PokeMonster* monster);
-void executeItemUse(PokeMonster* user, ItemType itemType);
-void processStatusEffects(PokeMonster* monster);
 void displayStatusMessage(const char* message);
-void determineAndExecuteTurnOrder(void);
 void messageDisplayComplete(void);
-void executeMonsterSwitch(PokeMonster* monster, int targetIndex);
-bool hasActiveMonstersLeft(MonsterList* team);
 bool monsterBelongsToTeam(PokeMonster* monster, MonsterList* team);
 void StartBattleIntroAnimation(void);
 void UpdateBattleIntroAnimation(void);
@@ -108,6 +32,20 @@ void DrawBattleIntroAnimation(void);
 bool IsBattleIntroActive(void);
 void SkipBattleIntro(void);
 
+// Chance de vitória e melhor ataque do jogador num final 1x1, se a tabela
+// de finais está carregada e cobre a situação
+bool getBattleEndgameHint(EndgameResult* result);
+
+// Distribuições de dano da batalha atual (montadas em startNewBattle)
+DamageCache* getBattleDamageCache(void);
+
+// Níveis do bot local nas configurações: os da busca e, depois deles, a
+// rede de política (sem o arquivo ou fora do que ela cobre, vale a busca
+// do nível normal)
+#define BOT_DIFFICULTY_NET SEARCH_DIFFICULTY_COUNT
+#define BOT_DIFFICULTY_COUNT (SEARCH_DIFFICULTY_COUNT + 1)
+const char* getBotDifficultyName(int difficultyIndex);
+
 
 // Encontra o melhor ataque de status
 int getBestStatusAttack(PokeMonster* botMonster, PokeMonster* playerMonster);
@@ -0,0 +1,55 @@
+/**
+ * PokeBattle - Bots sem rede
+ *
+ * Decisões locais do bot, usadas pelo jogo quando a IA não responde e
+ * pelo simulador headless para controlar os dois lados da batalha.
+ */
+#ifndef BATTLE_BOT_H
+#define BATTLE_BOT_H
+
+#include <stdbool.h>
+#include "battle_rules.h"
+#include "policy_net.h"
+
+// Iterações da política "mcts" do simulador
+#define BOT_MCTS_ITERATIONS 400
+
+// Políticas disponíveis para o simulador
+typedef enum {
+    BOT_POLICY_RANDOM = 0,   // Ataque aleatório entre os que têm PP
+    BOT_POLICY_GREEDY,       // Maior dano esperado contra o monstro atual
+    BOT_POLICY_SIMPLE,       // Mesma heurística do fallback do jogo (itens e trocas)
+    BOT_POLICY_EXPECTIMAX,   // Busca de 1 turno (battle_search.h), só em simples
+    BOT_POLICY_MCTS,         // MCTS com iterações fixas (battle_mcts.h), só em simples
+    BOT_POLICY_FIRST,        // Fallback de botChooseAttack: primeiro ataque com PP
+    BOT_POLICY_NET,          // Rede de política (policy_net.h), só em simples
+    BOT_POLICY_COUNT
+} BotPolicy;
+
+const char* getBotPolicyName(BotPolicy policy);
+bool parseBotPolicy(const char* name, BotPolicy* policy);
+
+// Rede usada pela política "net" (sem rede ela joga como "simple"). O
+// ponteiro continua de quem carregou
+void setBotPolicyNet(const PolicyNet* net);
+const PolicyNet* getBotPolicyNet(void);
+
+// Escolhe a ação de um lado (action: 0 ataque, 1 troca, 2 item; parameter
+// como em queueBattleAction)
+void chooseBotAction(BattleContext* ctx, bool isPlayerSide, BotPolicy policy,
+                     int* action, int* parameter);
+
+// Mesmo que chooseBotAction para um espaço em campo (duplas e triplas)
+void chooseBotActionForSlot(BattleContext* ctx, bool isPlayerSide, int slot, BotPolicy policy,
+                            int* action, int* parameter);
+
+// Escolhe quem entra quando o monstro atual desmaiou (NULL se não há)
+PokeMonster* chooseBotReplacement(BattleContext* ctx, bool isPlayerSide, BotPolicy policy);
+PokeMonster* chooseBotReplacementForSlot(BattleContext* ctx, bool isPlayerSide, int slot, BotPolicy policy);
+
+// Heurísticas do fallback do jogo
+int getAISuggestedActionSimple(BattleContext* ctx, PokeMonster* botMonster, PokeMonster* playerMonster);
+int botChooseAttack(PokeMonster* botMonster, PokeMonster* playerMonster);
+PokeMonster* botChooseMonster(MonsterList* botTeam, PokeMonster* playerMonster);
+
+#endif // BATTLE_BOT_H
@@ -0,0 +1,40 @@
+/**
+ * PokeBattle - Hash Zobrist da batalha
+ *
+ * Cada pedaço do estado (faixa de HP, PP de cada ataque, status e
+ * atributos de cada monstro, quem está em campo, itens usados) tem uma
+ * chave aleatória de 64 bits; o hash é o XOR das chaves. Como o XOR se
+ * desfaz, trocar um pedaço custa dois XORs: updateBattleHash só refaz os
+ * monstros e campos que mudaram entre duas fotografias.
+ *
+ * O HP entra em faixas (HASH_HP_BUCKETS por monstro), então estados com
+ * HP quase igual têm o mesmo hash. O turno e o gerador aleatório ficam
+ * de fora: o mesmo estado alcançado por caminhos diferentes bate.
+ */
+#ifndef BATTLE_HASH_H
+#define BATTLE_HASH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "battle_snapshot.h"
+
+// Faixas de HP (mais a faixa do monstro desmaiado)
+#define HASH_HP_BUCKETS 64
+
+// HP máximo dos monstros da batalha, para calcular as faixas
+typedef struct {
+    int16_t maxHp[2][SNAPSHOT_MAX_TEAM];
+} BattleHasher;
+
+// Prepara o hasher para os times do contexto. Falso se algum time tem
+// mais de SNAPSHOT_MAX_TEAM monstros
+bool initBattleHasher(BattleHasher* hasher, const BattleContext* ctx);
+
+// Hash completo de uma fotografia
+uint64_t hashBattleSnapshot(const BattleHasher* hasher, const BattleSnapshot* snapshot);
+
+// Hash de after a partir do hash de before, refazendo só o que mudou
+uint64_t updateBattleHash(const BattleHasher* hasher, uint64_t hash,
+                          const BattleSnapshot* before, const BattleSnapshot* after);
+
+#endif // BATTLE_HASH_H
@@ -0,0 +1,48 @@
+/**
+ * PokeBattle - Bot MCTS (busca em árvore Monte Carlo)
+ *
+ * Paralelização pela raiz: cada thread do pool cresce a sua própria árvore
+ * a partir do mesmo estado, com sementes diferentes, e no fim as visitas
+ * das ações da raiz são somadas. Os lados escolhem ao mesmo tempo, então
+ * cada nó guarda estatísticas separadas para as ações de cada lado (UCT
+ * desacoplado). A árvore é de laço aberto: os nós são sequências de
+ * ações, e acertos, críticos e danos são sorteados de novo a cada
+ * iteração. Os rollouts usam as regras de verdade, com o bot guloso nos
+ * dois lados. Só funciona em simples e nunca usa rede.
+ */
+#ifndef BATTLE_MCTS_H
+#define BATTLE_MCTS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "battle_rules.h"
+#include "work_pool.h"
+
+typedef struct {
+    int timeBudgetMs;   // 0: sem limite de tempo (só iterations)
+    long iterations;    // Total entre as threads; 0: só o tempo
+    int threads;        // 0: todos os núcleos; 1: roda na thread de quem chamou
+    uint64_t seed;      // Mesma semente, iterações e threads: mesma escolha
+    WorkPool* pool;     // Opcional: pool já criado, reaproveitado entre as
+                        // buscas (as threads passam a ser as dele)
+} MctsLimits;
+
+typedef struct {
+    int action;         // 0 ataque, 1 troca, 2 item
+    int parameter;      // Como em queueBattleAction
+    double value;       // Resultado médio da ação escolhida (-1 .. 1)
+    long iterations;
+    long treeNodes;     // Nós criados nas árvores
+    long turnsSimulated;          // Turnos jogados na árvore e nos rollouts
+    double iterationsPerSecond;
+    double nodesPerSecond;        // Turnos simulados por segundo
+    double elapsedMs;
+    int threads;
+} MctsResult;
+
+// Escolhe a ação do lado. O contexto não é alterado (cada thread usa um
+// clone). Falso se nenhuma iteração terminou; result ainda traz uma ação
+// válida (a da heurística simples)
+bool chooseMctsAction(BattleContext* ctx, bool isPlayerSide, const MctsLimits* limits, MctsResult* result);
+
+#endif // BATTLE_MCTS_H
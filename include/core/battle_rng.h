@@ -0,0 +1,31 @@
+/**
+ * PokeBattle - Gerador de números aleatórios da batalha
+ *
+ * xoshiro256** com semente expandida por splitmix64. Cada BattleContext
+ * tem o seu próprio gerador: com a mesma semente e as mesmas escolhas a
+ * batalha se repete bit a bit, e batalhas em threads diferentes não
+ * disputam o estado do rand() da libc.
+ */
+#ifndef BATTLE_RNG_H
+#define BATTLE_RNG_H
+
+#include <stdint.h>
+
+typedef struct {
+    uint64_t s[4];
+} BattleRng;
+
+// Inicializa o gerador a partir de uma semente de 64 bits
+void battleRngSeed(BattleRng* rng, uint64_t seed);
+
+// Próximo valor de 64 bits
+uint64_t battleRngNext(BattleRng* rng);
+
+// Inteiro uniforme em [0, bound) (bound > 0)
+int battleRngRange(BattleRng* rng, int bound);
+
+// Cria um sub-fluxo independente: o filho continua a sequência atual do
+// pai e o pai salta 2^128 posições, então os fluxos nunca se sobrepõem
+void battleRngFork(BattleRng* parent, BattleRng* child);
+
+#endif // BATTLE_RNG_H
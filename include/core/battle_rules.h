@@ -0,0 +1,217 @@
+/**
+ * PokeBattle - Regras da batalha
+ *
+ * Núcleo de regras (pokebattle_core), sem Raylib nem cURL. As regras não
+ * desenham nem tocam sons: tudo o que é apresentação é reportado como um
+ * BattleEvent para o handler registrado pela camada do jogo.
+ *
+ * Todo o estado de uma batalha fica em um BattleContext. Não há estado
+ * global nas regras, então várias batalhas independentes podem rodar ao
+ * mesmo tempo (uma por thread, por exemplo).
+ */
+#ifndef BATTLE_RULES_H
+#define BATTLE_RULES_H
+
+#include <stdbool.h>
+#include "core_structures.h"
+#include "battle_rng.h"
+
+// Eventos de apresentação emitidos pelas regras
+typedef enum {
+    BATTLE_EVENT_ATTACK = 0,     // Ataque acertou (attackType = tipo do golpe)
+    BATTLE_EVENT_DAMAGE,         // Dano aplicado (value = dano, critical)
+    BATTLE_EVENT_STATUS,         // Ataque aplicou status (value = StatusType)
+    BATTLE_EVENT_STATUS_TICK,    // Status ativo processado no fim do turno (value = StatusType)
+    BATTLE_EVENT_HEAL,           // Cura com item (value = HP recuperado)
+    BATTLE_EVENT_FULL_HEAL,      // Moeda da Sorte deu cara (value = HP máximo)
+    BATTLE_EVENT_FAINT           // Monstro desmaiou
+} BattleEventType;
+
+typedef struct {
+    BattleEventType type;
+    const PokeMonster* source;   // Quem causou o evento (pode ser NULL)
+    const PokeMonster* target;   // Quem sofreu o evento
+    bool targetIsPlayer;         // Se o alvo é o monstro atual do jogador
+    int value;
+    const Attack* attack;        // Golpe envolvido (NULL para itens e status)
+    MonsterType attackType;
+    bool critical;
+} BattleEvent;
+
+typedef void (*BattleEventHandler)(const BattleEvent* event, void* userData);
+
+// Sorteios de um ataque que podem ser decididos de fora (busca do bot)
+typedef enum {
+    BATTLE_CHANCE_PARALYSIS = 0, // Paralisado perde a vez (sucesso = perde)
+    BATTLE_CHANCE_HIT,           // Ataque acerta
+    BATTLE_CHANCE_CRITICAL,      // Acerto crítico
+    BATTLE_CHANCE_STATUS,        // Efeito de status do golpe pega
+    BATTLE_CHANCE_DAMAGE_ROLL,   // Variação do dano (0-15, somada a 85%)
+    BATTLE_CHANCE_COUNT
+} BattleChance;
+
+// Decide um sorteio. Para os de sucesso/falha, percent é a chance de
+// sucesso (0-100) e o retorno é 1 ou 0; para a variação do dano o retorno
+// é 0-15 e percent não é usado
+typedef int (*BattleChanceHandler)(BattleChance chance, int percent, void* userData);
+
+// Mensagem em exibição e seu tempo na tela
+typedef struct {
+    char message[256];
+    float displayTime;
+    float elapsedTime;
+    bool waitingForInput;
+    bool autoAdvance;
+} BattleMessage;
+
+typedef struct {
+    bool isAnimating;
+    float animationTime;
+    float elapsedTime;
+    int animationType;
+    PokeMonster* source;
+    PokeMonster* target;
+} BattleAnimation;
+
+// Formato da batalha: quantos monstros de cada lado ficam em campo
+#define BATTLE_MAX_ACTIVE 3
+
+typedef enum {
+    BATTLE_FORMAT_SINGLES = 1,
+    BATTLE_FORMAT_DOUBLES = 2,
+    BATTLE_FORMAT_TRIPLES = 3
+} BattleFormat;
+
+// Contexto de uma batalha: tudo o que antes era global
+typedef struct BattleContext {
+    MonsterList* playerTeam;
+    MonsterList* opponentTeam;
+    ActionQueue actionQueue;
+    EffectStack* effectStack;
+    int turn;
+    int battleState;
+    bool playerTurn;
+    int selectedAttack;
+    int selectedAction;
+    bool itemUsed;
+    bool playerItemUsed;  // Flag para item usado pelo jogador
+    bool botItemUsed;     // Flag para item usado pelo bot
+    bool botPotionUsed;     // Controla se o bot já usou poção na batalha
+    bool botRandomItemUsed; // Controla se o bot já usou item aleatório na batalha
+    bool playerPotionUsed;      // Idem para o lado do jogador
+    bool playerRandomItemUsed;
+    int itemType;
+
+    // Gerador aleatório da batalha (acertos, críticos, status, item, bot)
+    BattleRng rng;
+
+    // Monstros em campo. Em simples vale o current de cada time; em duplas e
+    // triplas os espaços 1 e 2 ficam aqui (o espaço 0 é sempre o current)
+    BattleFormat format;
+    PokeMonster* playerActive[BATTLE_MAX_ACTIVE];
+    PokeMonster* opponentActive[BATTLE_MAX_ACTIVE];
+
+    // Mensagens e temporização
+    bool actionQueueReady;
+    char battleMessage[256];
+    BattleMessage currentMessage;
+    BattleAnimation currentAnimation;
+    float stateTransitionDelay;
+
+    // Histórico do bot de IA, para evitar repetir sempre a mesma decisão
+    int aiLastAction;
+    int aiActionRepeatCount;
+    int aiLastAttack;
+    int aiAttackRepeatCount;
+
+    // Quem recebe os eventos de apresentação (NULL descarta)
+    BattleEventHandler eventHandler;
+    void* eventUserData;
+
+    // Quem decide os sorteios dos ataques (NULL sorteia com rng)
+    BattleChanceHandler chanceHandler;
+    void* chanceUserData;
+
+    // Logs de depuração das regras desta batalha (começa em battleDebugLog;
+    // os clones das buscas começam desligados)
+    bool debugLog;
+} BattleContext;
+
+#define BATTLE_DEBUG(ctx, ...) do { if ((ctx)->debugLog) printf(__VA_ARGS__); } while (0)
+
+// Ciclo de vida do contexto
+BattleContext* createBattleContext(void);
+void freeBattleContext(BattleContext* ctx);
+
+// Define a semente do gerador da batalha (mesma semente, mesma batalha)
+void seedBattleContext(BattleContext* ctx, uint64_t seed);
+
+// Prepara o contexto para uma nova batalha entre os dois times
+void beginBattle(BattleContext* ctx, MonsterList* playerTeam, MonsterList* opponentTeam);
+
+// Registra quem recebe os eventos (NULL descarta os eventos)
+void setBattleEventHandler(BattleContext* ctx, BattleEventHandler handler, void* userData);
+
+// Registra quem decide os sorteios dos ataques (NULL volta a usar rng)
+void setBattleChanceHandler(BattleContext* ctx, BattleChanceHandler handler, void* userData);
+
+// Formato das próximas batalhas (vale a partir de beginBattle). Padrão: simples
+void setBattleFormat(BattleContext* ctx, BattleFormat format);
+const char* getBattleFormatName(BattleFormat format);
+bool parseBattleFormat(const char* name, BattleFormat* format);
+
+// Monstros em campo por espaço (0 .. format-1). NULL se o espaço está vazio
+PokeMonster* getActiveMonster(BattleContext* ctx, bool isPlayerSide, int slot);
+void setActiveMonster(BattleContext* ctx, bool isPlayerSide, int slot, PokeMonster* monster);
+bool isMonsterActive(BattleContext* ctx, PokeMonster* monster);
+
+// Em que lado e espaço o monstro está em campo (falso se não está)
+bool findActiveSlot(BattleContext* ctx, PokeMonster* monster, bool* isPlayerSide, int* slot);
+
+// Alvo de um ataque: o adversário no mesmo espaço ou, se ele desmaiou, o
+// primeiro adversário de pé
+PokeMonster* chooseAttackTarget(BattleContext* ctx, PokeMonster* attacker);
+PokeMonster* chooseAttackTargetForSlot(BattleContext* ctx, bool isPlayerSide, int slot);
+
+// Coloca uma ação na fila (kind: 0 ataque, 1 troca, 2 item), já com lado,
+// espaço e chave de ordem. Falso se a fila está cheia
+bool queueBattleAction(BattleContext* ctx, int kind, int parameter, PokeMonster* monster);
+
+// Execução das ações
+void executeAttack(BattleContext* ctx, PokeMonster* attacker, PokeMonster* defender, int attackIndex);
+int calculateDamage(BattleContext* ctx, PokeMonster* attacker, PokeMonster* defender, Attack* attack);
+// Mesmo cálculo sem sortear: randomPercent é a variação (85-100). Só inteiros
+int calculateDamageWithRoll(const PokeMonster* attacker, const PokeMonster* defender,
+                            const Attack* attack, int randomPercent);
+void applyStatusEffect(BattleContext* ctx, PokeMonster* target, int statusEffect, int statusPower, int duration);
+void processStatusEffects(BattleContext* ctx, PokeMonster* monster);
+void processTurnEnd(BattleContext* ctx);
+void determineAndExecuteTurnOrder(BattleContext* ctx);
+
+// Prioridade do tipo de ação: troca 1, item 2, ataque 3
+int getActionPriority(int action);
+
+// Ordena as ações pela chave de ordem (prioridade, depois velocidade).
+// Empates exatos são sorteados com ctx->rng. O(n log n) e sem alocação
+void sortTurnOrder(BattleContext* ctx, ActionRecord* records, int count);
+void executeMonsterSwitch(BattleContext* ctx, PokeMonster* monster, int targetIndex);
+void executeItemUse(BattleContext* ctx, PokeMonster* user, ItemType itemType);
+void useItem(BattleContext* ctx, ItemType itemType, PokeMonster* target);
+ItemType rollRandomItem(BattleContext* ctx);
+
+// Executa o turno inteiro (ordem, ações da fila e fim de turno) sem pausas
+// nem mensagens na tela. Usado por simuladores e buscas; o jogo faz o mesmo
+// passo a passo em updateBattle.
+void resolveTurn(BattleContext* ctx);
+
+// Consultas de estado
+bool isBattleOver(BattleContext* ctx);
+int getBattleWinner(BattleContext* ctx);
+bool isMonsterFainted(PokeMonster* monster);
+void switchMonster(MonsterList* team, PokeMonster* newMonster);
+bool hasActiveMonstersLeft(MonsterList* team);
+
+// Gera a descrição textual de um ataque (sem rede)
+char* generateAttackDescription(BattleContext* ctx, PokeMonster* attacker, PokeMonster* defender, Attack* attack);
+
+#endif // BATTLE_RULES_H
@@ -0,0 +1,76 @@
+/**
+ * PokeBattle - Bot de busca (expectimax)
+ *
+ * Procura a melhor ação olhando alguns turnos à frente. Nos nós de decisão
+ * o bot escolhe a melhor ação (com poda alfa-beta) e a resposta do
+ * adversário entra como média, com pesos pelo dano que cada ataque dele
+ * causaria; nos nós de chance faz a média sobre acerto,
+ * paralisia, crítico, status e variação do dano, com as probabilidades das
+ * regras. Aprofunda turno a turno até acabar o tempo e devolve a escolha
+ * da última profundidade completa. Só funciona em simples e nunca usa rede.
+ */
+#ifndef BATTLE_SEARCH_H
+#define BATTLE_SEARCH_H
+
+#include <stdbool.h>
+#include "battle_rules.h"
+#include "transposition_table.h"
+
+// Turnos à frente, no máximo
+#define SEARCH_MAX_DEPTH 6
+
+// Níveis de dificuldade (índice das configurações do jogo). O último usa
+// o MCTS (battle_mcts.h) com o tempo dos limites, em vez do expectimax
+#define SEARCH_DIFFICULTY_COUNT 4
+#define SEARCH_DIFFICULTY_MCTS 3
+
+typedef struct {
+    int timeBudgetMs;   // 0: sem limite de tempo (só maxDepth, resultado reproduzível)
+    int maxDepth;       // 1..SEARCH_MAX_DEPTH
+    TranspositionTable* table;   // Opcional; pode ser dividida entre buscas e threads
+} SearchLimits;
+
+typedef struct {
+    int action;         // 0 ataque, 1 troca, 2 item
+    int parameter;      // Como em queueBattleAction
+    int depthReached;   // Última profundidade completa (0: usou a heurística simples)
+    long turnsSimulated;
+    long tableProbes;   // Consultas desta busca à tabela de transposição
+    long tableHits;
+    double value;       // -1 derrota .. 1 vitória, para quem buscou
+    double elapsedMs;
+} SearchResult;
+
+// Ações por lado: 4 ataques, 5 trocas e 2 itens
+#define SEARCH_MAX_ACTIONS 11
+
+typedef struct {
+    int kind;           // 0 ataque, 1 troca, 2 item
+    int parameter;
+    float order;        // Estimativa rápida, para tentar as melhores primeiro
+} SearchAction;
+
+// Limites para um nível de dificuldade (0 fácil, 1 normal, 2 difícil, 3 mestre)
+SearchLimits getDifficultySearchLimits(int difficultyIndex);
+const char* getDifficultyName(int difficultyIndex);
+
+// Escolhe a ação do lado. O contexto não é alterado (a busca roda num
+// clone). Falso se não há o que buscar; result ainda traz uma ação válida
+bool chooseSearchAction(BattleContext* ctx, bool isPlayerSide, const SearchLimits* limits,
+                        SearchResult* result);
+
+// Peças usadas também pelas outras buscas (battle_mcts.h)
+
+// Ações possíveis do lado (monstro em campo, simples), da mais promissora à
+// menos pela estimativa rápida. Retorna quantas
+int generateSearchActions(BattleContext* ctx, bool isPlayerSide, SearchAction* actions);
+
+// Joga um turno com as duas ações (NULL: o lado não age) e substitui quem
+// desmaiou
+void playSearchTurn(BattleContext* ctx, bool isPlayerSide, const SearchAction* mine, const SearchAction* theirs);
+
+// Valor do estado para o lado: ±1 no fim da batalha, dentro de (-1, 1)
+// nos outros casos (HP e monstros de pé)
+double evaluateBattleState(BattleContext* ctx, bool isPlayerSide);
+
+#endif // BATTLE_SEARCH_H
@@ -0,0 +1,41 @@
+/**
+ * PokeBattle - Batalhas headless
+ *
+ * Roda uma batalha inteira sem janela, com um bot em cada lado. Base do
+ * pokebattle-sim e das outras ferramentas de simulação em lote.
+ */
+#ifndef BATTLE_SIM_H
+#define BATTLE_SIM_H
+
+#include <stdbool.h>
+#include "battle_rules.h"
+#include "battle_bot.h"
+
+// Máximo de monstros em um time
+#define SIM_MAX_TEAM_SIZE 6
+
+// Time descrito por índices do banco de dados
+typedef struct {
+    int indices[SIM_MAX_TEAM_SIZE];
+    int count;
+    int randomCount;     // > 0: sortear esse número de monstros a cada batalha
+} TeamSpec;
+
+// Lê "Charizard,Blastoise", "0,5,12" ou "random:3"
+bool parseTeamSpec(const char* text, TeamSpec* spec);
+
+// Cria o time (cópias novas dos monstros do banco); sorteia com rng se preciso
+MonsterList* createTeamFromSpec(const TeamSpec* spec, BattleRng* rng);
+
+// Joga uma batalha completa entre os dois times, no formato configurado
+// com setBattleFormat (simples, duplas ou triplas). Retorna o vencedor no
+// formato de getBattleWinner (1 jogador, 2 oponente, 0 empate ou limite
+// de turnos atingido). O número de turnos fica em ctx->turn.
+int playHeadlessBattle(BattleContext* ctx, MonsterList* playerTeam, MonsterList* opponentTeam,
+                       BotPolicy playerPolicy, BotPolicy opponentPolicy, int maxTurns);
+
+// Continua uma batalha já em andamento (rollouts das buscas) até o fim ou
+// até ctx->turn passar de maxTurns. Retorna como playHeadlessBattle
+int continueHeadlessBattle(BattleContext* ctx, BotPolicy playerPolicy, BotPolicy opponentPolicy, int maxTurns);
+
+#endif // BATTLE_SIM_H
@@ -0,0 +1,75 @@
+/**
+ * PokeBattle - Fotografia da batalha
+ *
+ * Guarda em um bloco plano (sem ponteiros, copiável com memcpy) tudo o que
+ * as regras usam de uma batalha: HP, atributos, PP, status, quem está em
+ * campo, itens usados, turno e o estado do gerador aleatório. Nomes, tipos,
+ * animações e ponteiros das listas ficam de fora: não mudam durante a
+ * batalha e continuam nos monstros do contexto.
+ *
+ * Uso típico numa busca: cloneBattleContext uma vez por thread, depois
+ * restoreBattleSnapshot + resolveTurn quantas vezes for preciso, sem malloc.
+ */
+#ifndef BATTLE_SNAPSHOT_H
+#define BATTLE_SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "battle_rules.h"
+
+// Máximo de monstros por time numa fotografia
+#define SNAPSHOT_MAX_TEAM 6
+
+// Espaço em campo vazio
+#define SNAPSHOT_NO_MONSTER 0xFF
+
+// Estado mutável de um monstro (16 bytes)
+typedef struct {
+    int16_t hp;
+    int16_t attack;
+    int16_t defense;
+    int16_t speed;
+    uint8_t pp[4];
+    int8_t statusCondition;
+    int8_t statusCounter;
+    int8_t statusTurns;
+    uint8_t reserved;
+} MonsterSnapshot;
+
+typedef struct {
+    MonsterSnapshot monsters[SNAPSHOT_MAX_TEAM];  // Na ordem da lista do time
+    uint8_t count;
+    uint8_t active[BATTLE_MAX_ACTIVE];            // Índice no time por espaço
+    uint8_t itemUsed;          // Já usou item neste turno
+    uint8_t potionUsed;
+    uint8_t randomItemUsed;
+    uint8_t reserved;
+} TeamSnapshot;
+
+typedef struct {
+    BattleRng rng;
+    TeamSnapshot teams[2];     // 0 jogador, 1 oponente
+    int32_t turn;
+    uint8_t format;
+    uint8_t itemType;          // Item sorteado para a batalha
+    uint8_t itemUsed;
+    uint8_t reserved;
+} BattleSnapshot;
+
+_Static_assert(sizeof(BattleSnapshot) <= 256, "BattleSnapshot deve caber em 256 bytes");
+
+// Fotografa a batalha. Falso se algum time tem mais de SNAPSHOT_MAX_TEAM
+// monstros ou algum valor não cabe nos campos compactos
+bool captureBattleSnapshot(const BattleContext* ctx, BattleSnapshot* snapshot);
+
+// Volta a batalha para a fotografia. Os times do contexto precisam ter o
+// mesmo número de monstros, na mesma ordem, de quando ela foi tirada (o
+// próprio contexto ou um clone). A fila de ações é esvaziada
+bool restoreBattleSnapshot(BattleContext* ctx, const BattleSnapshot* snapshot);
+
+// Contexto novo com cópias dos times e o mesmo estado de source, sem
+// handler de eventos. Os times pertencem ao clone
+BattleContext* cloneBattleContext(const BattleContext* source);
+void freeBattleContextClone(BattleContext* clone);
+
+#endif // BATTLE_SNAPSHOT_H
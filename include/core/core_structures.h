@@ -0,0 +1,212 @@
+// core_structures.h
+#ifndef CORE_STRUCTURES_H
+#define CORE_STRUCTURES_H
+
+#include <stdio.h>
+#include <stddef.h>  // Para size_t
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * PokeBattle - Estruturas de regras da batalha
+ *
+ * Tipos usados pelas regras da batalha, sem dependência de Raylib ou cURL.
+ * O jogo inclui este arquivo através de structures.h; simuladores e
+ * servidores podem incluí-lo diretamente e linkar apenas pokebattle_core.
+ */
+
+// Forward declarations
+typedef struct PokeMonster PokeMonster;
+
+// A textura é um tipo do Raylib: o núcleo só guarda o ponteiro
+struct Texture;
+
+// Padrão dos logs de depuração do núcleo (ligado no jogo): vale para os
+// logs fora de uma batalha e é o valor inicial de BattleContext.debugLog.
+// Definido pelo programa na inicialização; o núcleo só lê
+extern bool battleDebugLog;
+
+// Tipos de PokeMonstros
+typedef enum {
+    TYPE_NONE = -1,
+    TYPE_NORMAL = 0,
+    TYPE_FIRE,       // Fogo
+    TYPE_WATER,      // Água
+    TYPE_GRASS,      // Grama
+    TYPE_ELECTRIC,   // Elétrico
+    TYPE_ICE,        // Gelo
+    TYPE_FIGHTING,   // Lutador
+    TYPE_POISON,     // Veneno
+    TYPE_GROUND,     // Terra
+    TYPE_FLYING,     // Voador
+    TYPE_PSYCHIC,    // Psíquico
+    TYPE_BUG,        // Inseto
+    TYPE_ROCK,       // Pedra
+    TYPE_GHOST,      // Fantasma
+    TYPE_DRAGON,     // Dragão
+    TYPE_DARK,       // Sombrio
+    TYPE_STEEL,      // Metal/Ferro
+    TYPE_FAIRY,      // Fada
+    TYPE_COUNT
+} MonsterType;
+
+// Estados de batalha
+typedef enum {
+    BATTLE_IDLE = 0,
+    BATTLE_INTRO_ANIMATION,  // NOVO ESTADO para animação de pokébolas
+    BATTLE_INTRO,
+    BATTLE_SELECT_ACTION,
+    BATTLE_SELECT_ATTACK,
+    BATTLE_SELECT_MONSTER,
+    BATTLE_ITEM_MENU,
+    BATTLE_PREPARING_ACTIONS,
+    BATTLE_EXECUTING_ACTIONS,
+    BATTLE_ATTACK_ANIMATION,
+    BATTLE_DAMAGE_ANIMATION,
+    BATTLE_MESSAGE_DISPLAY,
+    BATTLE_RESULT_MESSAGE,
+    BATTLE_TURN_END,
+    BATTLE_OVER,
+    BATTLE_CONFIRM_QUIT,
+    BATTLE_FORCED_SWITCH
+} BattleState;
+
+// Tipos de itens
+typedef enum {
+    ITEM_POTION = 0,
+    ITEM_RED_CARD,
+    ITEM_COIN
+} ItemType;
+
+// Tipos de status
+typedef enum {
+    STATUS_NONE = 0,
+    STATUS_ATK_DOWN = 1,
+    STATUS_DEF_DOWN = 2,
+    STATUS_SPD_DOWN = 3,
+    STATUS_PARALYZED = 4,
+    STATUS_SLEEPING = 5,
+    STATUS_BURNING = 6
+} StatusType;
+
+// Estrutura para os ataques
+typedef struct Attack {
+    char name[32];
+    MonsterType type;
+    int power;
+    int accuracy;
+    int ppMax;
+    int ppCurrent;
+    int statusEffect;
+    int statusPower;
+    int statusChance;
+} Attack;
+
+typedef struct {
+    struct Texture *frames; // Array de texturas (Texture2D no Raylib)
+    int frameCount;        // Número total de frames
+    int currentFrame;      // Frame atual
+    float frameDelay;      // Tempo entre frames (em segundos)
+    float elapsedTime;     // Tempo acumulado
+} Animation;
+
+
+// Estrutura para um PokeMonstro
+struct PokeMonster {
+    char name[32];
+    MonsterType type1;
+    MonsterType type2;
+    int hp;
+    int maxHp;
+    int attack;
+    int defense;
+    int speed;
+    Attack attacks[4];
+    int statusCondition;
+    int statusCounter;
+    int statusTurns;
+    int speciesIndex;          // Posição no banco (as cópias herdam)
+    Animation frontAnimation;  // Substitui frontTexture
+    Animation backAnimation;   // Substitui backTexture
+    struct PokeMonster* next;
+    struct PokeMonster* prev;
+};
+
+
+// Estrutura para lista duplamente encadeada de monstros
+typedef struct MonsterList {
+    PokeMonster* first;
+    PokeMonster* last;
+    PokeMonster* current;
+    int count;
+} MonsterList;
+
+// Capacidade da fila de ações (potência de 2: o anel usa máscara)
+#define ACTION_QUEUE_CAPACITY 16
+
+// Ação empacotada (16 bytes): quem age, de que lado e espaço, o quê e a
+// chave de ordem já calculada, para não precisar procurar o monstro nos times
+typedef struct {
+    PokeMonster* monster;
+    int16_t parameter;      // Ataque, índice da troca ou tipo do item
+    uint8_t side;           // 0 jogador, 1 oponente
+    uint8_t slot;           // Espaço em campo (0 em simples)
+    uint8_t kind;           // 0 ataque, 1 troca, 2 item
+    uint8_t reserved;
+    uint16_t orderKey;      // Maior age antes: prioridade do tipo e velocidade
+} ActionRecord;
+
+// Fila de ações: anel de tamanho fixo dentro do próprio contexto, sem malloc
+typedef struct {
+    ActionRecord records[ACTION_QUEUE_CAPACITY];
+    int front;
+    int count;
+} ActionQueue;
+
+// Estrutura para a pilha de efeitos
+typedef struct {
+    int* types;
+    int* durations;
+    int* values;
+    PokeMonster** targets;
+    int top;
+    int capacity;
+} EffectStack;
+
+// Estrutura para o banco de dados de monstros
+typedef struct {
+    PokeMonster* monsters;
+    int count;
+} MonsterDatabase;
+
+// Protótipos de funções para manipulação das estruturas de dados
+
+// Funções para a lista duplamente encadeada
+MonsterList* createMonsterList(void);
+void freeMonsterList(MonsterList* list);
+void addMonster(MonsterList* list, PokeMonster* monster);
+// Como addMonster, sem o log (cópias para simulação, montadas em outras threads)
+void addMonsterQuiet(MonsterList* list, PokeMonster* monster);
+void removeMonster(MonsterList* list, PokeMonster* monster);
+PokeMonster* findMonster(MonsterList* list, const char* name);
+void switchCurrentMonster(MonsterList* list, PokeMonster* newCurrent);
+
+// Funções para a fila de ações
+bool isQueueEmpty(const ActionQueue* queue);
+bool isQueueFull(const ActionQueue* queue);
+bool enqueue(ActionQueue* queue, const ActionRecord* record);
+bool dequeue(ActionQueue* queue, ActionRecord* record);
+void clearQueue(ActionQueue* queue);
+
+// Funções para a pilha de efeitos
+EffectStack* createEffectStack(int capacity);
+void freeEffectStack(EffectStack* stack);
+bool isStackEmpty(EffectStack* stack);
+bool isStackFull(EffectStack* stack);
+bool push(EffectStack* stack, int type, int duration, int value, PokeMonster* target);
+bool pop(EffectStack* stack, int* type, int* duration, int* value, PokeMonster** target);
+void clearStack(EffectStack* stack);
+
+void freeMonster(PokeMonster* monster);
+
+#endif // CORE_STRUCTURES_H
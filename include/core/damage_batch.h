@@ -0,0 +1,71 @@
+/**
+ * PokeBattle - Dano em lote
+ *
+ * Calcula dano mínimo, esperado e máximo de vários golpes contra vários
+ * defensores de uma vez. Os dados ficam em vetores (um campo por vetor) para
+ * o cálculo usar SIMD: AVX2 ou SSE4.1 quando o processador tiver, e uma
+ * versão escalar em qualquer outro caso. Os resultados são exatamente os de
+ * calculateDamageWithRoll.
+ */
+#ifndef DAMAGE_BATCH_H
+#define DAMAGE_BATCH_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "core_structures.h"
+
+// Máximo de golpes e de defensores em um lote
+#define DAMAGE_BATCH_MAX 64
+
+typedef enum {
+    DAMAGE_KERNEL_AUTO,     // Melhor disponível no processador
+    DAMAGE_KERNEL_SCALAR,
+    DAMAGE_KERNEL_SSE41,
+    DAMAGE_KERNEL_AVX2,
+    DAMAGE_KERNEL_COUNT
+} DamageKernel;
+
+// Golpes já com os dados do atacante (ataque e STAB)
+typedef struct {
+    int32_t power[DAMAGE_BATCH_MAX];
+    int32_t attack[DAMAGE_BATCH_MAX];    // Ataque do monstro que usa o golpe
+    int32_t type[DAMAGE_BATCH_MAX];
+    int32_t stab[DAMAGE_BATCH_MAX];      // 1 se o golpe é do tipo do atacante
+    int count;
+} DamageMoveBatch;
+
+typedef struct {
+    int32_t defense[DAMAGE_BATCH_MAX];
+    int32_t type1[DAMAGE_BATCH_MAX];
+    int32_t type2[DAMAGE_BATCH_MAX];
+    int count;
+} DamageDefenderBatch;
+
+// Resultados por [golpe][defensor], considerando as 16 variações (85-100%)
+typedef struct {
+    int32_t minDamage[DAMAGE_BATCH_MAX][DAMAGE_BATCH_MAX];
+    int32_t maxDamage[DAMAGE_BATCH_MAX][DAMAGE_BATCH_MAX];
+    float expectedDamage[DAMAGE_BATCH_MAX][DAMAGE_BATCH_MAX];
+} DamageBatchResult;
+
+// Adiciona os golpes do monstro (os de poder 0 também, com dano 0).
+// Retorna quantos couberam
+int addDamageBatchMoves(DamageMoveBatch* moves, const PokeMonster* attacker);
+
+// Adiciona um defensor. Falso se o lote está cheio
+bool addDamageBatchDefender(DamageDefenderBatch* defenders, const PokeMonster* defender);
+
+// Preenche result para todas as combinações golpe x defensor
+void computeDamageBatch(const DamageMoveBatch* moves, const DamageDefenderBatch* defenders,
+                        DamageBatchResult* result);
+
+// Escolhe a implementação (para testes e benchmark). Falso se o
+// processador não suporta; nesse caso nada muda
+bool setDamageBatchKernel(DamageKernel kernel);
+
+// Implementação que computeDamageBatch está usando
+DamageKernel getDamageBatchKernel(void);
+const char* getDamageKernelName(DamageKernel kernel);
+bool isDamageKernelSupported(DamageKernel kernel);
+
+#endif // DAMAGE_BATCH_H
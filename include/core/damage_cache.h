@@ -0,0 +1,60 @@
+/**
+ * PokeBattle - Distribuição exata de dano por confronto
+ *
+ * Para cada trio (atacante, defensor, ataque) de uma batalha guarda o dano
+ * das 16 variações (85 a 100%). O crítico (5%, dano x1,5) e a precisão
+ * entram nas contas, então a chance de nocaute e o dano médio saem exatos,
+ * sem sortear nada.
+ *
+ * O cache é montado quando os times estão definidos. Cada entrada lembra o
+ * ataque do atacante e a defesa do defensor usados no cálculo e só é
+ * refeita quando um status muda um desses valores.
+ */
+#ifndef DAMAGE_CACHE_H
+#define DAMAGE_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "battle_rules.h"
+
+#define DAMAGE_CACHE_MAX_TEAM 6
+#define DAMAGE_ROLLS 16
+
+// Distribuição de um ataque (40 bytes)
+typedef struct {
+    uint16_t rolls[DAMAGE_ROLLS];  // Dano sem crítico por variação, em ordem crescente
+    uint8_t accuracy;              // 0..100
+    uint8_t hasDamage;             // 0: ataque de status
+    int16_t attackStat;            // Entradas do cálculo (para saber se mudaram)
+    int16_t defenseStat;
+} DamageDistribution;
+
+typedef struct {
+    PokeMonster* members[2][DAMAGE_CACHE_MAX_TEAM];   // 0 jogador, 1 oponente
+    int counts[2];
+    // [lado do atacante][atacante][defensor][ataque]
+    DamageDistribution entries[2][DAMAGE_CACHE_MAX_TEAM][DAMAGE_CACHE_MAX_TEAM][4];
+    long lookups;
+    long refreshes;                // Entradas refeitas por mudança de atributo
+} DamageCache;
+
+// Calcula todas as distribuições dos times do contexto
+void buildDamageCache(DamageCache* cache, BattleContext* ctx);
+
+// Distribuição do ataque; NULL se os monstros não são de lados opostos da
+// batalha do cache
+const DamageDistribution* getDamageDistribution(DamageCache* cache, const PokeMonster* attacker,
+                                                const PokeMonster* defender, int attackIndex);
+
+// Chance de uma jogada causar pelo menos damage (acerto e crítico incluídos)
+double getDamageChanceAtLeast(const DamageDistribution* distribution, int damage);
+
+// Dano médio de uma jogada (erros contam como zero)
+double getExpectedDamage(const DamageDistribution* distribution);
+
+// Chance de nocautear o defensor com o HP atual neste turno, contando
+// também sono, paralisia e PP do atacante
+double getKoProbability(DamageCache* cache, const PokeMonster* attacker, const PokeMonster* defender,
+                        int attackIndex);
+
+#endif // DAMAGE_CACHE_H
@@ -0,0 +1,77 @@
+/**
+ * PokeBattle - Cache persistente de decisões da IA
+ *
+ * As mesmas situações se repetem muito entre partidas, e cada uma custava
+ * uma consulta nova à API. O cache guarda a decisão da IA (ação, ataque e
+ * troca) pela posição vista pelo bot, reduzida ao que importa e em faixas:
+ * espécies em campo e no banco, HP em faixas, PP, status e os itens que
+ * ainda podem ser usados. Posições que só diferem dentro de uma faixa
+ * caem na mesma entrada.
+ *
+ * O arquivo é uma tabela hash de endereçamento aberto mapeada na memória
+ * (leitura e escrita), então vale entre execuções sem etapa de carregar ou
+ * salvar. Cada entrada guarda quando foi gravada; a validade (TTL) e a
+ * política de uso vêm da configuração ao abrir.
+ */
+#ifndef DECISION_CACHE_H
+#define DECISION_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "battle_rules.h"
+
+// Arquivo padrão (fica no diretório do jogo, não em resources/)
+#define DECISION_CACHE_FILE "ai_cache.bin"
+
+typedef struct DecisionCache DecisionCache;
+
+typedef enum {
+    DECISION_CACHE_OFF,         // Não consulta nem grava
+    DECISION_CACHE_STORE_ONLY,  // Só grava (aquece o cache sem mudar o jogo)
+    DECISION_CACHE_READ_WRITE   // Usa o que encontrar e grava as respostas novas
+} DecisionCachePolicy;
+
+typedef struct {
+    DecisionCachePolicy policy;
+    int log2Slots;          // Tamanho ao criar o arquivo (um arquivo existente manda)
+    long ttlSeconds;        // Validade de uma entrada (0 = não expira)
+    int refreshEvery;       // A cada N acertos de uma entrada, consulta a IA de novo para renová-la (0 = nunca)
+} DecisionCacheConfig;
+
+typedef struct {
+    int action;             // 0 ataque, 1 troca, 2 item
+    int attackIndex;        // -1 se a IA não escolheu
+    int switchIndex;        // Posição no time, -1 se a IA não escolheu
+} CachedDecision;
+
+typedef struct {
+    long hits;
+    long misses;
+    long expired;           // Encontradas mas vencidas (contam também como faltas)
+    long refreshes;         // Acertos devolvidos como falta para renovar a entrada
+    long stores;
+    long entries;           // Entradas ocupadas no arquivo
+    long capacity;
+    long totalHits;         // Somados desde que o arquivo foi criado
+    long totalMisses;
+} DecisionCacheStats;
+
+// Abre (ou cria) o arquivo. NULL se não deu para mapear ou a política é OFF
+DecisionCache* openDecisionCache(const char* path, const DecisionCacheConfig* config);
+
+// Grava as páginas alteradas e fecha
+void closeDecisionCache(DecisionCache* cache);
+
+// Chave da posição vista pelo lado (isPlayerSide), pelos monstros atuais
+uint64_t getDecisionCacheKey(const BattleContext* ctx, bool isPlayerSide);
+
+// Decisão guardada para a chave, se existe, está na validade e a política
+// permite usar. Conta acerto ou falta
+bool lookupDecisionCache(DecisionCache* cache, uint64_t key, CachedDecision* decision);
+
+// Grava (ou renova) a decisão da chave
+void storeDecisionCache(DecisionCache* cache, uint64_t key, const CachedDecision* decision);
+
+DecisionCacheStats getDecisionCacheStats(const DecisionCache* cache);
+
+#endif // DECISION_CACHE_H
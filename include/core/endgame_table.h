@@ -0,0 +1,59 @@
+/**
+ * PokeBattle - Tabela de finais 1x1
+ *
+ * Quando cada lado só tem um monstro de pé, o estado cabe em dois números:
+ * o HP de cada um. O gerador (pokebattle-endgame) resolve todos os
+ * confrontos do banco por programação dinâmica, do menor HP para o maior,
+ * e grava num arquivo a chance de vitória e o melhor ataque para cada par
+ * de HPs. Em jogo o arquivo é mapeado na memória e cada consulta é uma
+ * leitura.
+ *
+ * O modelo considera acerto, crítico e variação do dano, e a ordem pela
+ * velocidade (empate: meio a meio). Status, itens e o fim dos PP ficam de
+ * fora, então a tabela só responde com os dois monstros sem status e com
+ * os atributos do banco. A chance guardada é a garantida: o adversário
+ * pode até adivinhar o ataque escolhido a cada turno.
+ */
+#ifndef ENDGAME_TABLE_H
+#define ENDGAME_TABLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "battle_rules.h"
+
+// Arquivo padrão (o jogo procura em resources/)
+#define ENDGAME_TABLE_FILE "endgame.bin"
+
+typedef struct EndgameTable EndgameTable;
+
+typedef struct {
+    float winProbability;   // Para o lado que consultou
+    int attackIndex;        // Melhor ataque (0..3)
+} EndgameResult;
+
+typedef struct {
+    long pairs;
+    long states;
+    size_t fileBytes;
+    double elapsedMs;
+} EndgameBuildStats;
+
+// Resolve todos os confrontos do banco (já inicializado) e grava em path.
+// threads <= 0 usa todos os núcleos
+bool buildEndgameTable(const char* path, int threads, EndgameBuildStats* stats);
+
+// Mapeia o arquivo. NULL se não existe ou foi gerado para outro banco de
+// monstros (o arquivo guarda uma impressão digital dos atributos)
+EndgameTable* openEndgameTable(const char* path);
+void closeEndgameTable(EndgameTable* table);
+
+// Consulta direta por índice do banco e HP atual (1..maxHp)
+bool probeEndgame(const EndgameTable* table, int myMonster, int foeMonster, int myHp, int foeHp,
+                  EndgameResult* result);
+
+// Consulta para a batalha: falso se não é um final 1x1 coberto pela
+// tabela (mais de um monstro de pé, status, atributos alterados, formato
+// que não é simples ou o ataque indicado sem PP)
+bool lookupEndgame(const EndgameTable* table, BattleContext* ctx, bool isPlayerSide, EndgameResult* result);
+
+#endif // ENDGAME_TABLE_H
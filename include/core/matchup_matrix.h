@@ -0,0 +1,48 @@
+/**
+ * PokeBattle - Matriz de confrontos do banco
+ *
+ * Uma nota de 0 a 1 para cada par (A, B) do banco dizendo o quanto A leva
+ * vantagem no 1x1 contra B. A nota sai do melhor ataque de cada lado
+ * (dano esperado com tipo, STAB, precisão e crítico, calculado em lote com
+ * damage_batch.h) e de quem ataca primeiro. É montada uma vez junto com o
+ * banco e fica num vetor contínuo, linha por atacante, então a troca do bot
+ * e as sugestões de time consultam um par com uma leitura.
+ *
+ * As notas são das espécies (atributos do banco, HP cheio): quem usa
+ * precisa pesar o HP atual por conta própria.
+ */
+#ifndef MATCHUP_MATRIX_H
+#define MATCHUP_MATRIX_H
+
+#include <stdint.h>
+#include "core_structures.h"
+
+typedef struct {
+    int count;              // Monstros no banco quando a matriz foi montada
+    float* score;           // [atacante * count + defensor]; score[b][a] = 1 - score[a][b]
+    uint8_t* bestAttack;    // Melhor ataque do atacante contra o defensor
+    float* averageScore;    // Nota média de cada monstro contra o banco todo
+} MatchupMatrix;
+
+extern MatchupMatrix matchupMatrix;
+
+// Monta a matriz para o banco atual (chamada por initializeMonsterDatabase)
+void buildMatchupMatrix(void);
+void freeMatchupMatrix(void);
+
+// Índice no banco de um monstro (cópias incluídas) ou -1
+int getSpeciesIndex(const PokeMonster* monster);
+
+// Nota de A contra B por índice do banco, sem verificação
+static inline float getMatchupScoreByIndex(int attacker, int defender)
+{
+    return matchupMatrix.score[attacker * matchupMatrix.count + defender];
+}
+
+// Nota de A contra B; 0.5 (neutro) se algum não é do banco
+float getMatchupScore(const PokeMonster* attacker, const PokeMonster* defender);
+
+// Melhor ataque de A contra B ou -1
+int getMatchupBestAttack(const PokeMonster* attacker, const PokeMonster* defender);
+
+#endif // MATCHUP_MATRIX_H
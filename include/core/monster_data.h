@@ -0,0 +1,86 @@
+/**
+ * PokeBattle - Banco de dados de monstros e tabela de tipos
+ *
+ * Parte do núcleo de regras (pokebattle_core): não depende de Raylib.
+ * Sprites e cores dos tipos ficam em monsters.h, no lado do jogo.
+ */
+
+#ifndef MONSTER_DATA_H
+#define MONSTER_DATA_H
+
+#include <stdint.h>
+#include "core_structures.h"
+
+// Matriz de efetividade de tipos
+extern float typeEffectiveness[TYPE_COUNT][TYPE_COUNT];
+
+// Banco de dados de monstros
+extern MonsterDatabase monsterDB;
+
+// Inicializa o banco de dados de monstros
+void initializeMonsterDatabase(void);
+
+// Libera o banco de dados de monstros
+void freeMonsterDatabase(void);
+
+// Obtém um monstro do banco de dados pelo índice
+PokeMonster* getMonsterByIndex(int index);
+
+// Obtém um monstro do banco de dados pelo nome
+PokeMonster* getMonsterByName(const char* name);
+
+// Retorna o número total de monstros no banco de dados
+int getMonsterCount(void);
+
+// Cria uma cópia de um monstro do banco de dados
+PokeMonster* createMonsterCopy(PokeMonster* source);
+
+// Libera um monstro alocado dinamicamente
+void freeMonster(PokeMonster* monster);
+
+// Adiciona um ataque a um monstro
+void addAttackToMonster(PokeMonster* monster, int slot, const char* name, MonsterType type,
+                        int power, int accuracy, int pp, int statusEffect,
+                        int statusPower, int statusChance);
+
+// Calcula o multiplicador de dano baseado nos tipos do atacante e do defensor
+float calculateTypeEffectiveness(MonsterType attackType, MonsterType defenderType1, MonsterType defenderType2);
+
+// Ponto fixo usado no cálculo de dano: DAMAGE_FIXED_ONE representa 1.0
+#define DAMAGE_FIXED_SHIFT 12
+#define DAMAGE_FIXED_ONE (1 << DAMAGE_FIXED_SHIFT)
+
+// Multiplicador de tipo em ponto fixo (0, 1/4, 1/2, 1, 2 ou 4 vezes DAMAGE_FIXED_ONE)
+int calculateTypeEffectivenessFixed(MonsterType attackType, MonsterType defenderType1, MonsterType defenderType2);
+
+// Efetividade como expoente de 2: -2..+2 (1/4x a 4x) ou TYPE_EXPONENT_IMMUNE
+// (sem efeito). Indexada por [ataque][tipo 1][tipo 2 + 1]; a coluna 0 é TYPE_NONE
+#define TYPE_EXPONENT_IMMUNE INT8_MIN
+extern int8_t typeExponentTable[TYPE_COUNT][TYPE_COUNT][TYPE_COUNT + 1];
+
+// Preenche typeExponentTable a partir de typeEffectiveness
+// (chamada por initializeMonsterDatabase)
+void buildTypeExponentTable(void);
+
+// Uma leitura de byte, sem verificação: os tipos precisam ser válidos
+static inline int getTypeExponent(MonsterType attackType, MonsterType defenderType1, MonsterType defenderType2)
+{
+    return typeExponentTable[attackType][defenderType1][defenderType2 + 1];
+}
+
+// Mesmo valor, mas tipos inválidos contam como neutro (expoente 0)
+int calculateTypeExponent(MonsterType attackType, MonsterType defenderType1, MonsterType defenderType2);
+
+// Gera um time aleatório de monstros para o bot
+MonsterList* generateRandomTeam(int teamSize);
+
+// Algoritmo Quick Sort para ordenar monstros por velocidade
+void quickSortMonstersBySpeed(PokeMonster** monsters, int left, int right);
+
+// Função de particionamento para o Quick Sort
+int partitionMonsters(PokeMonster** monsters, int left, int right);
+
+// Retorna o nome do tipo como string
+const char* getTypeName(MonsterType type);
+
+#endif // MONSTER_DATA_H
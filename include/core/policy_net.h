@@ -0,0 +1,104 @@
+/**
+ * PokeBattle - Rede de política local
+ *
+ * Um perceptron pequeno (160 entradas, duas camadas ocultas de 64, uma
+ * saída por ação) que escolhe a jogada do bot sem rede e em microssegundos.
+ * Os pesos são treinados fora do jogo (pokebattle-selfplay gera as
+ * partidas, pokebattle-train aprende a imitar a busca nelas) e guardados
+ * em int8, com uma escala por neurônio. A avaliação usa AVX2 ou SSE4.1
+ * quando o processador tem, como o dano em lote, e uma versão escalar nos
+ * outros casos.
+ *
+ * As entradas descrevem a batalha do ponto de vista de um lado (HP, tipos,
+ * status, dano esperado de cada ataque, o banco e os itens); nada depende
+ * da posição dos monstros no banco de dados, então o arquivo continua
+ * valendo quando o banco muda. Só o formato simples é coberto.
+ */
+#ifndef POLICY_NET_H
+#define POLICY_NET_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "battle_rules.h"
+
+// Arquivo padrão (o jogo procura em resources/)
+#define POLICY_NET_FILE "policy.bin"
+
+#define POLICY_NET_INPUTS 160
+#define POLICY_NET_HIDDEN 64
+
+// Saídas: 4 ataques, troca para cada posição do time (6), poção e o item
+// sorteado da batalha
+#define POLICY_NET_OUTPUTS 12
+#define POLICY_NET_SLOT_SWITCH 4
+#define POLICY_NET_SLOT_POTION 10
+#define POLICY_NET_SLOT_ITEM 11
+
+// Camadas: entrada -> oculta, oculta -> oculta, oculta -> saída
+#define POLICY_NET_LAYERS 3
+
+typedef struct PolicyNet PolicyNet;
+
+// Pesos em float de uma camada, linha por neurônio de saída
+// (weights[linha * entradas + coluna]), como o treinador guarda
+typedef struct {
+    const float* weights;
+    const float* biases;
+} PolicyNetLayerWeights;
+
+// Uma decisão das partidas de treino (pokebattle-selfplay)
+typedef struct {
+    uint8_t features[POLICY_NET_INPUTS];   // Entradas quantizadas (0..127), como a rede vê
+    uint16_t legalMask;
+    uint8_t action;         // Saída escolhida pela busca
+    int8_t outcome;         // Resultado da partida para quem decidiu: 1, -1 ou 0
+} PolicySample;
+
+typedef struct {
+    int action;             // 0 ataque, 1 troca, 2 item
+    int parameter;          // Como em queueBattleAction
+    int slot;               // Saída escolhida (0 .. POLICY_NET_OUTPUTS-1)
+    float confidence;       // Probabilidade da saída entre as ações válidas
+    double elapsedUs;       // Entradas + rede
+} PolicyNetResult;
+
+// Lê o arquivo de pesos. NULL se não existe ou não é deste formato
+PolicyNet* loadPolicyNet(const char* path);
+void freePolicyNet(PolicyNet* net);
+
+// Quantiza os pesos em float (dimensões acima) e grava em path
+bool savePolicyNet(const char* path, const PolicyNetLayerWeights layers[POLICY_NET_LAYERS]);
+
+// Entradas da rede para o lado e as saídas válidas (bit i = saída i).
+// Falso se a rede não cobre a posição (formato que não é simples ou sem
+// monstro em campo)
+bool extractPolicyFeatures(BattleContext* ctx, bool isPlayerSide, float features[POLICY_NET_INPUTS],
+                           uint16_t* legalMask);
+
+// Saída de uma ação de generateSearchActions (-1 se não tem)
+int getPolicyActionSlot(int kind, int parameter);
+
+// Entradas em [0, 1] para os inteiros 0..127 usados na avaliação
+void quantizePolicyFeatures(const float features[POLICY_NET_INPUTS], uint8_t quantized[POLICY_NET_INPUTS]);
+
+// Arquivo de amostras (cabeçalho "PBSP" e as amostras em sequência).
+// loadPolicySamples devolve um vetor a liberar com free
+bool savePolicySamples(const char* path, const PolicySample* samples, long count);
+PolicySample* loadPolicySamples(const char* path, long* count);
+
+// Ação correspondente a uma saída (action e parameter como em queueBattleAction)
+void getPolicySlotAction(const BattleContext* ctx, int slot, int* action, int* parameter);
+
+// Pontuação de cada saída, antes da máscara (maior é melhor)
+void evaluatePolicyNet(const PolicyNet* net, const float features[POLICY_NET_INPUTS],
+                       float logits[POLICY_NET_OUTPUTS]);
+
+// Escolhe a ação do lado. Falso se a rede não cobre a posição; result
+// ainda traz um ataque válido
+bool choosePolicyNetAction(const PolicyNet* net, BattleContext* ctx, bool isPlayerSide,
+                           PolicyNetResult* result);
+
+// Implementação em uso pela avaliação ("avx2", "sse4.1" ou "scalar")
+const char* getPolicyNetKernelName(void);
+
+#endif // POLICY_NET_H
@@ -0,0 +1,70 @@
+/**
+ * PokeBattle - Sugestão de time
+ *
+ * Procura o melhor time de 3 monstros do banco contra um grupo de times
+ * adversários sorteados, sem travar quem chamou:
+ *
+ *   1. Todos os times possíveis (12.341 com 43 monstros) recebem uma nota
+ *      barata pela matriz de confrontos: contra cada adversário do grupo,
+ *      a nota do melhor monstro do time para enfrentá-lo.
+ *   2. Só os mais bem colocados nessa nota vão para batalhas simuladas
+ *      (bot guloso dos dois lados) contra o grupo inteiro, em um pool de
+ *      threads. Os outros são podados sem jogar.
+ *
+ * Os times candidatos são avaliados do melhor para o pior na nota barata, e
+ * o ranking parcial pode ser lido a qualquer momento enquanto as threads
+ * trabalham.
+ */
+#ifndef TEAM_BUILDER_H
+#define TEAM_BUILDER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TEAM_BUILDER_SIZE 3
+#define TEAM_BUILDER_TOP 5
+
+typedef struct {
+    int opponentTeams;       // Tamanho do grupo sorteado (padrão: 24)
+    int gamesPerOpponent;    // Batalhas contra cada adversário (padrão: 2)
+    int maxCandidates;       // Times que chegam às batalhas (padrão: 256)
+    int threads;             // <= 0: todos os núcleos menos um (o da janela)
+    uint64_t seed;
+    int required[TEAM_BUILDER_SIZE];    // Monstros que o time precisa ter
+    int requiredCount;
+} TeamBuilderConfig;
+
+typedef struct {
+    int indices[TEAM_BUILDER_SIZE];     // Índices do banco
+    float coverage;                     // Nota barata (0..1)
+    float winRate;                      // Nas batalhas simuladas (empate vale meio)
+    float hpLeft;                       // Fração média de HP que sobra ao time (desempate)
+} TeamSuggestion;
+
+typedef struct {
+    long teamsTotal;         // Times possíveis com os monstros exigidos
+    long candidates;         // Times que passaram da poda
+    long evaluated;          // Candidatos já simulados
+    long battles;
+    bool finished;
+    double elapsedMs;
+    int bestCount;
+    TeamSuggestion best[TEAM_BUILDER_TOP];   // Melhor primeiro
+} TeamBuilderProgress;
+
+typedef struct TeamBuilder TeamBuilder;
+
+// Preenche config com os valores padrão
+void initTeamBuilderConfig(TeamBuilderConfig* config);
+
+// Faz a etapa barata e deixa as batalhas rodando no pool. O banco de
+// monstros e a matriz de confrontos precisam estar prontos
+TeamBuilder* startTeamBuilder(const TeamBuilderConfig* config);
+
+// Cópia do andamento; nunca espera as threads
+void getTeamBuilderProgress(TeamBuilder* builder, TeamBuilderProgress* progress);
+
+// Cancela o que falta, espera as tarefas em andamento e libera tudo
+void stopTeamBuilder(TeamBuilder* builder);
+
+#endif // TEAM_BUILDER_H
@@ -0,0 +1,56 @@
+/**
+ * PokeBattle - Tabela de transposição
+ *
+ * Guarda, por hash de estado (battle_hash.h), o valor que uma busca já
+ * calculou, a profundidade da busca e a melhor ação. Tamanho fixo, sem
+ * travas: cada entrada são duas palavras atômicas (dados e hash XOR
+ * dados). Uma escrita pela metade de outra thread não bate com o hash e
+ * vira um miss, então várias buscas podem usar a mesma tabela ao mesmo
+ * tempo.
+ *
+ * Cada posição tem duas entradas: uma fica com a busca mais profunda, a
+ * outra é sempre substituída.
+ */
+#ifndef TRANSPOSITION_TABLE_H
+#define TRANSPOSITION_TABLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct TranspositionTable TranspositionTable;
+
+// Tipo do valor guardado (a busca usa janelas alfa-beta)
+typedef enum {
+    TT_BOUND_EXACT = 0,
+    TT_BOUND_LOWER,     // O valor real é >= value (a busca cortou por beta)
+    TT_BOUND_UPPER      // O valor real é <= value (nenhuma ação passou de alfa)
+} TranspositionBound;
+
+typedef struct {
+    float value;
+    int depth;          // Turnos buscados a partir do estado
+    TranspositionBound bound;
+    int action;         // 0 ataque, 1 troca, 2 item
+    int parameter;
+} TranspositionEntry;
+
+typedef struct {
+    uint64_t probes;
+    uint64_t hits;
+    uint64_t stores;
+    double hitRate;     // hits / probes
+} TranspositionStats;
+
+// Tabela com 2^sizeLog2 posições (duas entradas de 16 bytes cada)
+TranspositionTable* createTranspositionTable(int sizeLog2);
+void freeTranspositionTable(TranspositionTable* table);
+
+// Esvazia a tabela e zera as estatísticas (não chamar durante uma busca)
+void clearTranspositionTable(TranspositionTable* table);
+
+bool probeTransposition(TranspositionTable* table, uint64_t hash, TranspositionEntry* entry);
+void storeTransposition(TranspositionTable* table, uint64_t hash, const TranspositionEntry* entry);
+
+TranspositionStats getTranspositionStats(const TranspositionTable* table);
+
+#endif // TRANSPOSITION_TABLE_H
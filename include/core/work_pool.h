@@ -0,0 +1,39 @@
+/**
+ * PokeBattle - Pool de threads com roubo de tarefas
+ *
+ * Cada thread tem sua própria fila (deque). A thread consome do fim da
+ * própria fila e, quando ela esvazia, rouba do começo da fila de outra.
+ * Tarefas podem enviar novas tarefas de dentro de outras tarefas.
+ */
+#ifndef WORK_POOL_H
+#define WORK_POOL_H
+
+#include <stdbool.h>
+
+typedef struct WorkPool WorkPool;
+
+// Tarefa: recebe o argumento e o índice da thread que a executa
+// (0 .. getWorkPoolThreadCount()-1), útil para estado por thread
+typedef void (*WorkTask)(void* arg, int workerIndex);
+
+// Número de núcleos disponíveis (pelo menos 1)
+int getCpuCount(void);
+
+// Cria o pool (threadCount <= 0 usa getCpuCount())
+WorkPool* createWorkPool(int threadCount);
+
+// Encerra as threads e libera o pool (espera as tarefas pendentes)
+void freeWorkPool(WorkPool* pool);
+
+int getWorkPoolThreadCount(const WorkPool* pool);
+
+// Envia uma tarefa. De dentro de uma tarefa, vai para a fila da própria thread
+bool submitWorkTask(WorkPool* pool, WorkTask task, void* arg);
+
+// Bloqueia até todas as tarefas enviadas terminarem
+void waitWorkPool(WorkPool* pool);
+
+// Quantas tarefas foram roubadas de outra fila (diagnóstico)
+long getWorkPoolSteals(const WorkPool* pool);
+
+#endif // WORK_POOL_H
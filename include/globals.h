@@ -27,13 +27,8 @@ extern bool vsBot;
 extern bool playerTurn;
 extern bool gameInitialized;
 
-// Sistema de batalha
-extern BattleSystem* battleSystem;
-extern bool actionQueueReady;
-extern char battleMessage[256];
-extern BattleMessage currentMessage;
-extern BattleAnimation currentAnimation;
-extern float stateTransitionDelay;
+// Sistema de batalha (contexto da batalha em andamento no jogo)
+extern BattleContext* battleSystem;
 extern MessageSequence currentSequence;
 
 // Variáveis de configuração
@@ -46,6 +41,7 @@ extern bool hasUnsavedChanges;
 extern float pendingMusicVolume;
 extern float pendingSoundVolume;
 extern bool pendingFullscreen;
+extern int difficultyIndex;
 extern int pendingDifficultyIndex;
 extern int pendingAnimSpeedIndex;
 
@@ -71,12 +67,6 @@ extern Sound faintSound;
 extern Music menuMusic;
 extern Music battleMusic;
 extern int currentBattleBackground;
-extern BattleSystem* battleSystem;
-extern bool actionQueueReady;
-extern char battleMessage[256];
-extern BattleMessage currentMessage;
-extern BattleAnimation currentAnimation;
-extern float stateTransitionDelay;
 extern char errorBuffer[256];
 
 // Funções de inicialização/finalização globais
@@ -2,6 +2,7 @@
 #define IA_INTEGRATION_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include "structures.h"
 #include "battle.h"
 #include <curl/curl.h>
@@ -9,6 +10,8 @@
 
 // Tamanho máximo para um prompt de IA
 #define MAX_PROMPT_SIZE 2048
+// Prompt da decisão completa do bot (ataques e banco juntos)
+#define MAX_DECISION_PROMPT_SIZE 4096
 // Tamanho máximo para uma resposta da IA
 #define MAX_RESPONSE_SIZE 4096
 
@@ -23,22 +26,54 @@ bool initializeAI(void);
 // Encerra a conexão com a API de IA
 void shutdownAI(void);
 
-// Consulta a API de IA com um prompt e retorna a resposta
+// Consulta a API de IA com um prompt e retorna a resposta (bloqueia até a
+// resposta chegar; o bot usa as consultas em segundo plano de ia_worker.h)
 char* queryAI(const char* prompt);
 
-// Funções específicas para utilização da IA no jogo
+// Partes de uma requisição, comuns a queryAI e à thread de consultas
+const char* getAIEndpointUrl(void);
+char* buildAIRequestPayload(const char* prompt);
 
-// Gera uma descrição criativa para um ataque
-char* generateAttackDescription(PokeMonster* attacker, PokeMonster* defender, Attack* attack);
+// Funções específicas para utilização da IA no jogo
 
 // Sugere a melhor ação para o bot
-int getAISuggestedAction(PokeMonster* botMonster, PokeMonster* playerMonster);
+int getAISuggestedAction(BattleContext* ctx, PokeMonster* botMonster, PokeMonster* playerMonster);
 
 // Sugere o melhor ataque para o bot
-int getAISuggestedAttack(PokeMonster* botMonster, PokeMonster* playerMonster);
+int getAISuggestedAttack(BattleContext* ctx, PokeMonster* botMonster, PokeMonster* playerMonster);
+
+// As duas consultas acima em partes: o prompt e a interpretação da resposta
+// (para quem envia o prompt por conta própria, como o bot em segundo plano)
+void buildAIActionPrompt(PokeMonster* botMonster, PokeMonster* playerMonster, char* prompt, size_t size);
+int resolveAIActionResponse(BattleContext* ctx, PokeMonster* botMonster, PokeMonster* playerMonster,
+                            const char* response);
+void buildAIAttackPrompt(PokeMonster* botMonster, PokeMonster* playerMonster, char* prompt, size_t size);
+int resolveAIAttackResponse(BattleContext* ctx, PokeMonster* botMonster, const char* response);
+
+// Decisão completa do bot numa consulta só (buildAIDecisionPrompt).
+// attackIndex e switchIndex ficam -1 quando a IA não deu um valor válido
+typedef struct {
+    int action;         // 0 atacar, 1 trocar, 2 item
+    int attackIndex;    // 0..3, com PP
+    int switchIndex;    // Posição no time do bot, viva e fora de campo
+} AIBotDecision;
+
+// Prompt que pede ação, ataque e troca numa linha "ACAO=a ATAQUE=b TROCA=c"
+void buildAIDecisionPrompt(BattleContext* ctx, PokeMonster* botMonster, PokeMonster* playerMonster,
+                           char* prompt, size_t size);
+
+// Lê a linha da resposta. Falso se falta algum campo ou a ação é inválida
+bool parseAIDecisionResponse(const char* response, AIBotDecision* decision);
+
+// Limpa (-1) o ataque sem PP e a troca para posição que não pode entrar
+void checkAIDecision(BattleContext* ctx, PokeMonster* botMonster, AIBotDecision* decision);
+
+// Evita que a IA repita a mesma ação ou o mesmo ataque turno após turno
+void varyAIDecision(BattleContext* ctx, PokeMonster* botMonster, PokeMonster* playerMonster,
+                    AIBotDecision* decision);
 
 // Sugere o melhor monstro para troca
-int getAISuggestedMonster(MonsterList* botTeam, PokeMonster* playerMonster);
+int getAISuggestedMonster(BattleContext* ctx, MonsterList* botTeam, PokeMonster* playerMonster);
 
 // Fornece dicas estratégicas para o jogador
 char* getStrategicHint(PokeMonster* playerMonster, PokeMonster* botMonster);
@@ -59,9 +94,6 @@ int interpretAIResponse(const char* response);
 const char* getStatusName(int statusCondition);
 const char* getEffectDescription(int statusEffect, int statusChance);
 
-// Sistema de fallback quando a IA falha
-int getAISuggestedActionSimple(PokeMonster* botMonster, PokeMonster* playerMonster);
-
 // Testa a conexão com a API
 bool testAIConnection(void);
 
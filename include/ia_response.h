@@ -0,0 +1,59 @@
+/**
+ * PokeBattle - Leitura incremental das respostas da IA
+ *
+ * O JSON da API é lido à medida que os pedaços chegam da libcurl, sem
+ * guardar a resposta inteira: um tokenizador de estados acompanha objetos,
+ * listas e strings e só copia o conteúdo das strings com a chave "text"
+ * (as partes da resposta), já sem os escapes, para um buffer alocado uma vez.
+ * O texto fica nesse buffer; quem usa lê a visão ou fica com o buffer.
+ */
+#ifndef IA_RESPONSE_H
+#define IA_RESPONSE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Profundidade máxima de objetos e listas aninhados
+#define AI_RESPONSE_MAX_DEPTH 32
+
+typedef struct {
+    // Texto extraído (terminado em '\0'); cresce só se passar da capacidade
+    char* buffer;
+    size_t length;
+    size_t capacity;
+
+    // Estado do tokenizador
+    int state;
+    int depth;
+    uint8_t isObject[AI_RESPONSE_MAX_DEPTH];
+    bool expectKey;         // Próxima string do objeto atual é uma chave
+    bool capturing;         // Dentro de uma string "text"
+    bool nextIsText;        // A última chave foi "text"
+    char key[8];            // Chave lida até agora (só importa se é "text")
+    int keyLength;
+    uint32_t codepoint;     // \uXXXX em leitura
+    int hexDigits;
+    uint32_t highSurrogate; // Primeira metade de um par UTF-16 (\uD83D...)
+    int textCount;          // Strings "text" encontradas
+    bool failed;            // JSON malformado ou sem memória
+} AIResponseParser;
+
+// capacityHint: tamanho esperado do texto (0 usa MAX_RESPONSE_SIZE)
+bool initAIResponseParser(AIResponseParser* parser, size_t capacityHint);
+void freeAIResponseParser(AIResponseParser* parser);
+
+// Processa mais um pedaço. Falso se o JSON é inválido
+bool feedAIResponseParser(AIResponseParser* parser, const char* data, size_t size);
+
+// Callback de escrita da libcurl (userp é o AIResponseParser)
+size_t aiResponseWriteCallback(void* contents, size_t size, size_t nmemb, void* userp);
+
+// Visão do texto extraído (sem cópia). Falso se não veio nenhum "text"
+bool getAIResponseText(const AIResponseParser* parser, const char** text, size_t* length);
+
+// Entrega o buffer com o texto a quem chamou (liberar com free) e deixa o
+// parser vazio. NULL se não veio nenhum "text" ou o JSON é inválido
+char* takeAIResponseText(AIResponseParser* parser);
+
+#endif // IA_RESPONSE_H
@@ -0,0 +1,41 @@
+/**
+ * PokeBattle - Consultas à IA em segundo plano
+ *
+ * Uma thread com a interface multi da libcurl faz as requisições à API
+ * enquanto o jogo continua desenhando. O jogo envia o prompt, recebe um
+ * identificador e, a cada quadro, pergunta se a resposta já chegou (as
+ * respostas prontas ficam numa fila de concluídas). Nada aqui bloqueia à
+ * espera da rede.
+ */
+#ifndef IA_WORKER_H
+#define IA_WORKER_H
+
+#include <stdbool.h>
+
+typedef enum {
+    AI_QUERY_PENDING,       // Na fila ou em andamento
+    AI_QUERY_DONE,          // Resposta pronta
+    AI_QUERY_FAILED,        // Erro de rede, HTTP ou resposta sem texto
+    AI_QUERY_UNKNOWN        // Identificador inválido ou já consumido
+} AIQueryState;
+
+// Sobe a thread (chamado por initializeAI, depois de curl_global_init)
+bool startAIWorker(void);
+
+// Cancela o que estiver pendente e espera a thread terminar
+void stopAIWorker(void);
+
+bool isAIWorkerRunning(void);
+
+// Envia um prompt. timeoutMs limita a requisição na libcurl (0 = sem
+// limite). Devolve o identificador (> 0) ou -1 se a thread não está ativa
+int submitAIQuery(const char* prompt, int timeoutMs);
+
+// Não bloqueia. Em AI_QUERY_DONE *response recebe o texto (liberar com
+// free) e o identificador deixa de valer; em AI_QUERY_FAILED também
+AIQueryState pollAIQuery(int id, char** response);
+
+// Desiste da consulta (a resposta, se chegar, é descartada)
+void cancelAIQuery(int id);
+
+#endif // IA_WORKER_H
@@ -0,0 +1,466 @@
+/**
+ * PokeBattle - Bots sem rede
+ *
+ * Decisões locais do bot (o fallback da IA do jogo) e as políticas usadas
+ * pelo simulador headless. Parte do pokebattle_core.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "battle_bot.h"
+#include "battle_mcts.h"
+#include "battle_search.h"
+#include "matchup_matrix.h"
+#include "monster_data.h"
+
+/**
+ * Escolhe um ataque para o bot (usado pelo sistema de fallback)
+ */
+int botChooseAttack(PokeMonster* botMonster, PokeMonster* playerMonster) {
+    if (botMonster == NULL || playerMonster == NULL) {
+        return 0; // Primeiro ataque como padrão
+    }
+
+    // Se temos um ataque previamente determinado pelo getAISuggestedActionSimple
+    if (botMonster->statusCounter >= 0 && botMonster->statusCounter < 4 &&
+        botMonster->attacks[botMonster->statusCounter].ppCurrent > 0) {
+        return botMonster->statusCounter;
+        }
+
+    // Fallback: encontrar o primeiro ataque com PP
+    for (int i = 0; i < 4; i++) {
+        if (botMonster->attacks[i].ppCurrent > 0) {
+            return i;
+        }
+    }
+
+    return 0; // Primeiro ataque como última opção
+}
+
+/**
+ * Escolhe um monstro para o bot
+ */
+PokeMonster* botChooseMonster(MonsterList* botTeam, PokeMonster* playerMonster) {
+    if (botTeam == NULL || playerMonster == NULL) {
+        return NULL;
+    }
+
+    // O melhor confronto contra o monstro do jogador, pesado pelo HP que
+    // sobrou; no empate fica o primeiro da lista
+    PokeMonster* best = NULL;
+    float bestScore = -1.0f;
+    PokeMonster* current = botTeam->first;
+    while (current != NULL) {
+        if (!isMonsterFainted(current) && current != botTeam->current) {
+            float score = getMatchupScore(current, playerMonster) * current->hp / current->maxHp;
+            if (score > bestScore) {
+                bestScore = score;
+                best = current;
+            }
+        }
+        current = current->next;
+    }
+
+    return best != NULL ? best : botTeam->current; // Se não encontrar outro, retorna o atual
+}
+
+/**
+ * Sistema de fallback simples para quando a IA não estiver disponível
+ * Faz decisões básicas baseadas no estado do jogo
+ */
+int getAISuggestedActionSimple(BattleContext* ctx, PokeMonster* botMonster, PokeMonster* playerMonster) {
+    if (ctx == NULL || botMonster == NULL || playerMonster == NULL) {
+        return 0; // Atacar por padrão
+    }
+
+    // Calcular porcentagem de HP
+    float botHpPercent = (float)botMonster->hp / botMonster->maxHp * 100.0f;
+    float playerHpPercent = (float)playerMonster->hp / playerMonster->maxHp * 100.0f;
+
+    // 1. Verificar se há necessidade de curar (HP baixo)
+    if (botHpPercent < 25.0f) {
+        // Se tiver item de cura e ele não foi usado ainda neste turno
+        if (!ctx->itemUsed && ctx->itemType == ITEM_POTION) {
+            return 2; // Usar item
+        }
+
+        // Se HP muito baixo e não puder usar item, considerar trocar
+        if (botHpPercent < 15.0f) {
+            // Verificar se há algum monstro saudável para trocar
+            MonsterList* botTeam = (ctx->playerTeam != NULL && botMonster == ctx->playerTeam->current) ?
+                                   ctx->playerTeam : ctx->opponentTeam;
+            PokeMonster* current = botTeam->first;
+            while (current != NULL) {
+                if (current != botMonster && !isMonsterFainted(current) &&
+                    (float)current->hp / current->maxHp > 0.5f) {
+                    return 1; // Trocar
+                }
+                current = current->next;
+            }
+        }
+    }
+
+    // 2. Verificar se tem vantagem de tipo - atacar se tiver
+    float bestEffectiveness = 0.0f;
+    int bestAttackIndex = -1;
+
+    for (int i = 0; i < 4; i++) {
+        if (botMonster->attacks[i].ppCurrent <= 0) continue;
+
+        float effectiveness = calculateTypeEffectiveness(
+            botMonster->attacks[i].type,
+            playerMonster->type1,
+            playerMonster->type2
+        );
+
+        if (effectiveness > bestEffectiveness) {
+            bestEffectiveness = effectiveness;
+            bestAttackIndex = i;
+        }
+    }
+
+    // Se encontrar um ataque super efetivo (>=2x), usar
+    if (bestEffectiveness >= 2.0f && bestAttackIndex >= 0) {
+        // Armazenar o melhor ataque para a próxima função
+        botMonster->statusCounter = bestAttackIndex; // Usar statusCounter para armazenar temporariamente
+        return 0; // Atacar
+    }
+
+    // 3. Se o oponente estiver com pouca vida, tentar finalizar
+    if (playerHpPercent < 25.0f) {
+        // Encontrar o ataque com maior poder
+        int highestPower = 0;
+        int powerfulAttackIndex = 0;
+
+        for (int i = 0; i < 4; i++) {
+            if (botMonster->attacks[i].ppCurrent <= 0) continue;
+
+            if (botMonster->attacks[i].power > highestPower) {
+                highestPower = botMonster->attacks[i].power;
+                powerfulAttackIndex = i;
+            }
+        }
+
+        // Armazenar o ataque mais poderoso
+        botMonster->statusCounter = powerfulAttackIndex;
+        return 0; // Atacar
+    }
+
+    // 4. Considerar aplicar efeitos de status
+    // Se o inimigo estiver saudável, tentar causar status negativo
+    if (playerHpPercent > 50.0f && playerMonster->statusCondition == STATUS_NONE) {
+        for (int i = 0; i < 4; i++) {
+            if (botMonster->attacks[i].ppCurrent <= 0) continue;
+
+            // Verificar se o ataque causa algum efeito de status
+            if (botMonster->attacks[i].statusEffect > 0 &&
+                botMonster->attacks[i].statusChance > 30) {
+                botMonster->statusCounter = i;
+                return 0; // Atacar com movimento de status
+            }
+        }
+    }
+
+    // 5. Opções aleatórias com pesos para adicionar variedade (20% de chance)
+    if (battleRngRange(&ctx->rng, 100) < 20) {
+        int action = battleRngRange(&ctx->rng, 10);
+
+        if (action < 7) { // 70% chance de atacar aleatoriamente
+            botMonster->statusCounter = battleRngRange(&ctx->rng, 4);
+            // Verificar se o ataque tem PP
+            if (botMonster->attacks[botMonster->statusCounter].ppCurrent <= 0) {
+                // Encontrar primeiro ataque com PP
+                for (int i = 0; i < 4; i++) {
+                    if (botMonster->attacks[i].ppCurrent > 0) {
+                        botMonster->statusCounter = i;
+                        break;
+                    }
+                }
+            }
+            return 0; // Atacar
+        }
+        else if (action < 9 && !ctx->itemUsed) { // 20% chance de usar item
+            return 2; // Usar item
+        }
+        else { // 10% chance de trocar
+            return 1; // Trocar
+        }
+    }
+
+    // 6. Padrão: usar o melhor ataque disponível conforme determinado anteriormente
+    if (bestAttackIndex >= 0) {
+        botMonster->statusCounter = bestAttackIndex;
+    } else {
+        // Simplesmente usar o primeiro ataque com PP
+        for (int i = 0; i < 4; i++) {
+            if (botMonster->attacks[i].ppCurrent > 0) {
+                botMonster->statusCounter = i;
+                break;
+            }
+        }
+    }
+
+    return 0; // Atacar como ação padrão
+}
+
+// Nome curto de cada política (linha de comando e JSON do simulador)
+static const char* policyNames[BOT_POLICY_COUNT] = {
+    "random",
+    "greedy",
+    "simple",
+    "expectimax",
+    "mcts",
+    "first",
+    "net"
+};
+
+static const PolicyNet* botPolicyNet = NULL;
+
+void setBotPolicyNet(const PolicyNet* net) {
+    botPolicyNet = net;
+}
+
+const PolicyNet* getBotPolicyNet(void) {
+    return botPolicyNet;
+}
+
+const char* getBotPolicyName(BotPolicy policy) {
+    if (policy < 0 || policy >= BOT_POLICY_COUNT) {
+        return "desconhecida";
+    }
+    return policyNames[policy];
+}
+
+bool parseBotPolicy(const char* name, BotPolicy* policy) {
+    if (name == NULL || policy == NULL) {
+        return false;
+    }
+
+    for (int i = 0; i < BOT_POLICY_COUNT; i++) {
+        if (strcmp(name, policyNames[i]) == 0) {
+            *policy = (BotPolicy)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Índice do primeiro ataque com PP (0 se nenhum)
+static int firstAttackWithPP(PokeMonster* monster) {
+    for (int i = 0; i < 4; i++) {
+        if (monster->attacks[i].ppCurrent > 0) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+// Posição de um monstro dentro do time (para executeMonsterSwitch)
+static int indexInTeam(MonsterList* team, PokeMonster* monster) {
+    int index = 0;
+    for (PokeMonster* current = team->first; current != NULL; current = current->next) {
+        if (current == monster) {
+            return index;
+        }
+        index++;
+    }
+    return -1;
+}
+
+// Ataque com maior dano esperado: poder x precisão x efetividade x STAB
+static int chooseGreedyAttack(PokeMonster* self, PokeMonster* foe) {
+    int best = firstAttackWithPP(self);
+    float bestScore = -1.0f;
+
+    for (int i = 0; i < 4; i++) {
+        Attack* attack = &self->attacks[i];
+        if (attack->ppCurrent <= 0) continue;
+
+        float score = (float)attack->power * attack->accuracy / 100.0f *
+                      calculateTypeEffectiveness(attack->type, foe->type1, foe->type2);
+        if (attack->type == self->type1 || attack->type == self->type2) {
+            score *= 1.5f;
+        }
+
+        if (score > bestScore) {
+            bestScore = score;
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+// Primeiro monstro de pé que não está em campo (para trocas em duplas e triplas)
+static PokeMonster* firstBenchedMonster(BattleContext* ctx, MonsterList* team) {
+    for (PokeMonster* current = team->first; current != NULL; current = current->next) {
+        if (!isMonsterFainted(current) && !isMonsterActive(ctx, current)) {
+            return current;
+        }
+    }
+    return NULL;
+}
+
+void chooseBotAction(BattleContext* ctx, bool isPlayerSide, BotPolicy policy,
+                     int* action, int* parameter) {
+    chooseBotActionForSlot(ctx, isPlayerSide, 0, policy, action, parameter);
+}
+
+void chooseBotActionForSlot(BattleContext* ctx, bool isPlayerSide, int slot, BotPolicy policy,
+                            int* action, int* parameter) {
+    MonsterList* team = isPlayerSide ? ctx->playerTeam : ctx->opponentTeam;
+    MonsterList* foeTeam = isPlayerSide ? ctx->opponentTeam : ctx->playerTeam;
+    PokeMonster* self = getActiveMonster(ctx, isPlayerSide, slot);
+
+    // Padrão: atacar
+    *action = 0;
+    *parameter = 0;
+    if (self == NULL) {
+        return;
+    }
+    *parameter = firstAttackWithPP(self);
+
+    // O adversário que esse espaço vai atacar
+    PokeMonster* foe = chooseAttackTarget(ctx, self);
+    if (foe == NULL) {
+        foe = foeTeam->current;
+    }
+
+    switch (policy) {
+        case BOT_POLICY_RANDOM: {
+            int valid[4];
+            int validCount = 0;
+            for (int i = 0; i < 4; i++) {
+                if (self->attacks[i].ppCurrent > 0) {
+                    valid[validCount++] = i;
+                }
+            }
+            if (validCount > 0) {
+                *parameter = valid[battleRngRange(&ctx->rng, validCount)];
+            }
+            break;
+        }
+
+        case BOT_POLICY_GREEDY:
+            *parameter = chooseGreedyAttack(self, foe);
+            break;
+
+        case BOT_POLICY_SIMPLE: {
+            // Mesma lógica do fallback do jogo, sem a chamada à IA
+            int suggested = getAISuggestedActionSimple(ctx, self, foe);
+            bool potionUsed = isPlayerSide ? ctx->playerPotionUsed : ctx->botPotionUsed;
+            bool randomItemUsed = isPlayerSide ? ctx->playerRandomItemUsed : ctx->botRandomItemUsed;
+
+            if (suggested == 1) {
+                PokeMonster* next = (ctx->format == BATTLE_FORMAT_SINGLES) ?
+                                    botChooseMonster(team, foe) :
+                                    firstBenchedMonster(ctx, team);
+                if (next != NULL && next != self) {
+                    *action = 1;
+                    *parameter = indexInTeam(team, next);
+                    return;
+                }
+            } else if (suggested == 2) {
+                if (self->hp < self->maxHp * 0.4f && !potionUsed) {
+                    *action = 2;
+                    *parameter = ITEM_POTION;
+                    return;
+                }
+                if (!randomItemUsed && ctx->itemType != ITEM_POTION) {
+                    *action = 2;
+                    *parameter = ctx->itemType;
+                    return;
+                }
+            }
+
+            *parameter = botChooseAttack(self, foe);
+            break;
+        }
+
+        case BOT_POLICY_EXPECTIMAX: {
+            // Sem limite de tempo, para o simulador ser reproduzível
+            if (ctx->format != BATTLE_FORMAT_SINGLES) {
+                chooseBotActionForSlot(ctx, isPlayerSide, slot, BOT_POLICY_SIMPLE, action, parameter);
+                return;
+            }
+            SearchLimits limits = { .timeBudgetMs = 0, .maxDepth = 1, .table = NULL };
+            SearchResult result;
+            chooseSearchAction(ctx, isPlayerSide, &limits, &result);
+            *action = result.action;
+            *parameter = result.parameter;
+            break;
+        }
+
+        case BOT_POLICY_MCTS: {
+            // Iterações fixas numa thread (o simulador já usa os núcleos) e
+            // semente tirada de uma cópia do gerador, sem gastar números dele
+            if (ctx->format != BATTLE_FORMAT_SINGLES) {
+                chooseBotActionForSlot(ctx, isPlayerSide, slot, BOT_POLICY_SIMPLE, action, parameter);
+                return;
+            }
+            BattleRng seedRng = ctx->rng;
+            MctsLimits limits = {
+                .timeBudgetMs = 0, .iterations = BOT_MCTS_ITERATIONS, .threads = 1,
+                .seed = battleRngNext(&seedRng), .pool = NULL
+            };
+            MctsResult result;
+            chooseMctsAction(ctx, isPlayerSide, &limits, &result);
+            *action = result.action;
+            *parameter = result.parameter;
+            break;
+        }
+
+        case BOT_POLICY_FIRST:
+            *parameter = botChooseAttack(self, foe);
+            break;
+
+        case BOT_POLICY_NET: {
+            PolicyNetResult result;
+            if (!choosePolicyNetAction(botPolicyNet, ctx, isPlayerSide, &result)) {
+                chooseBotActionForSlot(ctx, isPlayerSide, slot, BOT_POLICY_SIMPLE, action, parameter);
+                return;
+            }
+            *action = result.action;
+            *parameter = result.parameter;
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+PokeMonster* chooseBotReplacement(BattleContext* ctx, bool isPlayerSide, BotPolicy policy) {
+    return chooseBotReplacementForSlot(ctx, isPlayerSide, 0, policy);
+}
+
+PokeMonster* chooseBotReplacementForSlot(BattleContext* ctx, bool isPlayerSide, int slot, BotPolicy policy) {
+    MonsterList* team = isPlayerSide ? ctx->playerTeam : ctx->opponentTeam;
+
+    // Adversário em frente ao espaço (ou o primeiro de pé)
+    PokeMonster* foe = getActiveMonster(ctx, !isPlayerSide, slot);
+    for (int i = 0; i < (int)ctx->format && (foe == NULL || isMonsterFainted(foe)); i++) {
+        foe = getActiveMonster(ctx, !isPlayerSide, i);
+    }
+
+    if (policy == BOT_POLICY_GREEDY && foe != NULL) {
+        // Quem tiver o golpe mais forte contra o monstro atual do adversário
+        PokeMonster* best = NULL;
+        float bestScore = -1.0f;
+        for (PokeMonster* current = team->first; current != NULL; current = current->next) {
+            if (isMonsterFainted(current) || isMonsterActive(ctx, current)) continue;
+
+            Attack* attack = &current->attacks[chooseGreedyAttack(current, foe)];
+            float score = (float)attack->power *
+                          calculateTypeEffectiveness(attack->type, foe->type1, foe->type2);
+            if (score > bestScore) {
+                bestScore = score;
+                best = current;
+            }
+        }
+        return best;
+    }
+
+    return firstBenchedMonster(ctx, team);
+}
@@ -0,0 +1,147 @@
+/**
+ * PokeBattle - Hash Zobrist da batalha
+ *
+ * As tabelas de chaves são sorteadas uma vez, com semente fixa (o mesmo
+ * estado tem o mesmo hash em todas as execuções), na primeira chamada de
+ * initBattleHasher.
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include "battle_hash.h"
+
+// Valores distintos por campo; acima disso os valores dividem chave
+#define HASH_PP_LEVELS 64
+#define HASH_STATUS_LEVELS 8
+#define HASH_STAT_LEVELS 256
+#define HASH_ITEM_TYPES 4
+
+#define HASH_SEED 0x5A0B157C0FFEE123ULL
+
+typedef struct {
+    uint64_t hp[HASH_HP_BUCKETS + 1];
+    uint64_t pp[4][HASH_PP_LEVELS];
+    uint64_t stat[3][HASH_STAT_LEVELS];           // Ataque, defesa, velocidade
+    uint64_t status[HASH_STATUS_LEVELS][HASH_STATUS_LEVELS];
+    uint64_t statusCounter[HASH_STATUS_LEVELS];
+} MonsterKeys;
+
+typedef struct {
+    MonsterKeys monsters[2][SNAPSHOT_MAX_TEAM];
+    uint64_t active[2][BATTLE_MAX_ACTIVE][SNAPSHOT_MAX_TEAM];
+    uint64_t itemUsed[2];
+    uint64_t potionUsed[2];
+    uint64_t randomItemUsed[2];
+    uint64_t battleItemUsed;
+    uint64_t itemType[HASH_ITEM_TYPES];
+} ZobristKeys;
+
+static ZobristKeys keys;
+static pthread_once_t keysOnce = PTHREAD_ONCE_INIT;
+
+static void fillKeys(uint64_t* table, size_t count, BattleRng* rng) {
+    for (size_t i = 0; i < count; i++) {
+        table[i] = battleRngNext(rng);
+    }
+}
+
+static void initKeys(void) {
+    BattleRng rng;
+    battleRngSeed(&rng, HASH_SEED);
+    fillKeys((uint64_t*)&keys, sizeof(ZobristKeys) / sizeof(uint64_t), &rng);
+}
+
+static int clampLevel(int value, int levels) {
+    if (value < 0) return 0;
+    return value < levels ? value : levels - 1;
+}
+
+bool initBattleHasher(BattleHasher* hasher, const BattleContext* ctx) {
+    pthread_once(&keysOnce, initKeys);
+    memset(hasher, 0, sizeof(BattleHasher));
+
+    for (int side = 0; side < 2; side++) {
+        MonsterList* team = side == 0 ? ctx->playerTeam : ctx->opponentTeam;
+        int index = 0;
+        for (PokeMonster* current = team ? team->first : NULL; current != NULL; current = current->next) {
+            if (index >= SNAPSHOT_MAX_TEAM) {
+                return false;
+            }
+            hasher->maxHp[side][index++] = (int16_t)current->maxHp;
+        }
+    }
+    return true;
+}
+
+static uint64_t monsterKey(const BattleHasher* hasher, int side, int index, const MonsterSnapshot* monster) {
+    const MonsterKeys* table = &keys.monsters[side][index];
+    int maxHp = hasher->maxHp[side][index];
+
+    // Faixa 0 só para HP zerado: desmaiado nunca divide chave com vivo
+    int bucket = 0;
+    if (monster->hp > 0) {
+        bucket = maxHp > 0 ? 1 + (monster->hp - 1) * HASH_HP_BUCKETS / maxHp : 1;
+        bucket = clampLevel(bucket, HASH_HP_BUCKETS + 1);
+    }
+
+    uint64_t key = table->hp[bucket];
+    for (int i = 0; i < 4; i++) {
+        key ^= table->pp[i][clampLevel(monster->pp[i], HASH_PP_LEVELS)];
+    }
+    key ^= table->stat[0][(uint16_t)monster->attack % HASH_STAT_LEVELS];
+    key ^= table->stat[1][(uint16_t)monster->defense % HASH_STAT_LEVELS];
+    key ^= table->stat[2][(uint16_t)monster->speed % HASH_STAT_LEVELS];
+    key ^= table->status[clampLevel(monster->statusCondition, HASH_STATUS_LEVELS)]
+                        [clampLevel(monster->statusTurns, HASH_STATUS_LEVELS)];
+    key ^= table->statusCounter[clampLevel(monster->statusCounter, HASH_STATUS_LEVELS)];
+    return key;
+}
+
+// Campo e itens de um lado
+static uint64_t teamKey(int side, const TeamSnapshot* team) {
+    uint64_t key = 0;
+    for (int slot = 0; slot < BATTLE_MAX_ACTIVE; slot++) {
+        if (team->active[slot] < SNAPSHOT_MAX_TEAM) {
+            key ^= keys.active[side][slot][team->active[slot]];
+        }
+    }
+    if (team->itemUsed) key ^= keys.itemUsed[side];
+    if (team->potionUsed) key ^= keys.potionUsed[side];
+    if (team->randomItemUsed) key ^= keys.randomItemUsed[side];
+    return key;
+}
+
+static uint64_t battleKey(const BattleSnapshot* snapshot) {
+    uint64_t key = keys.itemType[clampLevel(snapshot->itemType, HASH_ITEM_TYPES)];
+    if (snapshot->itemUsed) key ^= keys.battleItemUsed;
+    return key;
+}
+
+uint64_t hashBattleSnapshot(const BattleHasher* hasher, const BattleSnapshot* snapshot) {
+    uint64_t hash = battleKey(snapshot);
+    for (int side = 0; side < 2; side++) {
+        const TeamSnapshot* team = &snapshot->teams[side];
+        for (int i = 0; i < team->count && i < SNAPSHOT_MAX_TEAM; i++) {
+            hash ^= monsterKey(hasher, side, i, &team->monsters[i]);
+        }
+        hash ^= teamKey(side, team);
+    }
+    return hash;
+}
+
+uint64_t updateBattleHash(const BattleHasher* hasher, uint64_t hash,
+                          const BattleSnapshot* before, const BattleSnapshot* after) {
+    for (int side = 0; side < 2; side++) {
+        const TeamSnapshot* old = &before->teams[side];
+        const TeamSnapshot* now = &after->teams[side];
+        for (int i = 0; i < now->count && i < SNAPSHOT_MAX_TEAM; i++) {
+            // Um turno costuma mexer em dois ou três monstros
+            if (memcmp(&old->monsters[i], &now->monsters[i], sizeof(MonsterSnapshot)) != 0) {
+                hash ^= monsterKey(hasher, side, i, &old->monsters[i]) ^
+                        monsterKey(hasher, side, i, &now->monsters[i]);
+            }
+        }
+        hash ^= teamKey(side, old) ^ teamKey(side, now);
+    }
+    return hash ^ battleKey(before) ^ battleKey(after);
+}
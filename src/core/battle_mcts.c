@@ -0,0 +1,403 @@
+/**
+ * PokeBattle - Bot MCTS (busca em árvore Monte Carlo)
+ *
+ * Cada iteração: volta o clone ao estado da raiz, desce a árvore escolhendo
+ * por UCB1 a ação de cada lado, cria um nó novo, joga o rollout e soma o
+ * resultado no caminho. As árvores ficam em vetores de nós por thread.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "battle_mcts.h"
+#include "battle_search.h"
+#include "battle_snapshot.h"
+#include "battle_sim.h"
+#include "work_pool.h"
+
+// Nós por árvore (cada thread tem a sua). Cheia, a árvore para de crescer
+// e as iterações seguem só com rollouts a partir das folhas
+#define MCTS_MAX_NODES 16384
+
+// Turnos descidos na árvore e jogados no rollout, no máximo
+#define MCTS_MAX_TREE_DEPTH 12
+#define MCTS_ROLLOUT_TURNS 30
+
+// Constante de exploração do UCB1 (valores normalizados em 0..1)
+#define MCTS_EXPLORATION 0.7
+
+// Iterações entre consultas ao relógio
+#define MCTS_CLOCK_INTERVAL 8
+
+typedef struct {
+    int firstChild;
+    int nextSibling;
+    uint8_t mineIndex;           // Par de ações que leva a este nó (índices no pai)
+    uint8_t theirsIndex;
+    uint8_t mineCount;
+    uint8_t theirsCount;
+    int8_t mineKind[SEARCH_MAX_ACTIONS];
+    int8_t mineParameter[SEARCH_MAX_ACTIONS];
+    int8_t theirsKind[SEARCH_MAX_ACTIONS];
+    int8_t theirsParameter[SEARCH_MAX_ACTIONS];
+    uint32_t visits;
+    uint32_t mineVisits[SEARCH_MAX_ACTIONS];
+    uint32_t theirsVisits[SEARCH_MAX_ACTIONS];
+    float mineTotal[SEARCH_MAX_ACTIONS];     // Soma dos resultados para quem busca
+    float theirsTotal[SEARCH_MAX_ACTIONS];   // Soma para o adversário
+} MctsNode;
+
+// Trabalho de uma thread: a árvore dela e o que ela conseguiu
+typedef struct {
+    const BattleContext* source;
+    const BattleSnapshot* root;
+    bool isPlayerSide;
+    uint64_t seed;
+    long iterationLimit;         // 0: sem limite
+    bool hasDeadline;
+    struct timespec deadline;
+
+    MctsNode* nodes;
+    int nodeCount;
+    long iterations;
+    long turns;
+    bool failed;
+} MctsWorker;
+
+static bool deadlinePassed(const struct timespec* deadline) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return now.tv_sec > deadline->tv_sec ||
+           (now.tv_sec == deadline->tv_sec && now.tv_nsec >= deadline->tv_nsec);
+}
+
+static int newNode(MctsWorker* worker, BattleContext* ctx, bool isPlayerSide) {
+    if (worker->nodeCount >= MCTS_MAX_NODES) {
+        return -1;
+    }
+
+    int index = worker->nodeCount++;
+    MctsNode* node = &worker->nodes[index];
+    memset(node, 0, sizeof(MctsNode));
+    node->firstChild = -1;
+    node->nextSibling = -1;
+
+    SearchAction actions[SEARCH_MAX_ACTIONS];
+    node->mineCount = (uint8_t)generateSearchActions(ctx, isPlayerSide, actions);
+    for (int i = 0; i < node->mineCount; i++) {
+        node->mineKind[i] = (int8_t)actions[i].kind;
+        node->mineParameter[i] = (int8_t)actions[i].parameter;
+    }
+    node->theirsCount = (uint8_t)generateSearchActions(ctx, !isPlayerSide, actions);
+    for (int i = 0; i < node->theirsCount; i++) {
+        node->theirsKind[i] = (int8_t)actions[i].kind;
+        node->theirsParameter[i] = (int8_t)actions[i].parameter;
+    }
+    return index;
+}
+
+// A árvore é de laço aberto: a ação guardada no nó pode não valer no estado
+// desta iteração (o monstro da troca desmaiou, o item já foi usado)
+static bool isActionLegal(BattleContext* ctx, bool isPlayerSide, int kind, int parameter) {
+    MonsterList* team = isPlayerSide ? ctx->playerTeam : ctx->opponentTeam;
+    if (team->current == NULL || isMonsterFainted(team->current)) {
+        return false;
+    }
+
+    if (kind == 1) {
+        PokeMonster* target = team->first;
+        for (int i = 0; i < parameter && target != NULL; i++) {
+            target = target->next;
+        }
+        return target != NULL && target != team->current && !isMonsterFainted(target);
+    }
+    if (kind == 2) {
+        bool potionUsed = isPlayerSide ? ctx->playerPotionUsed : ctx->botPotionUsed;
+        bool randomItemUsed = isPlayerSide ? ctx->playerRandomItemUsed : ctx->botRandomItemUsed;
+        return parameter == ITEM_POTION ? !potionUsed : !randomItemUsed;
+    }
+    return true;
+}
+
+// UCB1 entre as ações legais agora. -1 se nenhuma
+static int selectAction(BattleContext* ctx, bool isPlayerSide, uint32_t visits, uint8_t count,
+                        const int8_t* kinds, const int8_t* parameters,
+                        const uint32_t* actionVisits, const float* totals) {
+    int best = -1;
+    double bestScore = -1.0;
+    double logVisits = log((double)visits + 1.0);
+
+    for (int i = 0; i < count; i++) {
+        if (!isActionLegal(ctx, isPlayerSide, kinds[i], parameters[i])) {
+            continue;
+        }
+        if (actionVisits[i] == 0) {
+            return i;   // Na ordem da estimativa rápida
+        }
+
+        double mean = (totals[i] / actionVisits[i] + 1.0) * 0.5;
+        double score = mean + MCTS_EXPLORATION * sqrt(logVisits / actionVisits[i]);
+        if (score > bestScore) {
+            bestScore = score;
+            best = i;
+        }
+    }
+    return best;
+}
+
+static int findChild(MctsWorker* worker, int parent, int mineIndex, int theirsIndex) {
+    for (int child = worker->nodes[parent].firstChild; child >= 0; child = worker->nodes[child].nextSibling) {
+        if (worker->nodes[child].mineIndex == mineIndex && worker->nodes[child].theirsIndex == theirsIndex) {
+            return child;
+        }
+    }
+    return -1;
+}
+
+static void runIteration(MctsWorker* worker, BattleContext* ctx, BattleRng* rng) {
+    restoreBattleSnapshot(ctx, worker->root);
+    battleRngSeed(&ctx->rng, battleRngNext(rng));
+
+    int path[MCTS_MAX_TREE_DEPTH + 1];
+    int mineChoice[MCTS_MAX_TREE_DEPTH];
+    int theirsChoice[MCTS_MAX_TREE_DEPTH];
+    int length = 0;
+    int node = 0;
+
+    // Seleção e expansão
+    while (length < MCTS_MAX_TREE_DEPTH && !isBattleOver(ctx)) {
+        MctsNode* current = &worker->nodes[node];
+        int mine = selectAction(ctx, worker->isPlayerSide, current->visits, current->mineCount,
+                                current->mineKind, current->mineParameter,
+                                current->mineVisits, current->mineTotal);
+        int theirs = selectAction(ctx, !worker->isPlayerSide, current->visits, current->theirsCount,
+                                  current->theirsKind, current->theirsParameter,
+                                  current->theirsVisits, current->theirsTotal);
+        if (mine < 0) {
+            break;
+        }
+
+        SearchAction mineAction = { current->mineKind[mine], current->mineParameter[mine], 0.0f };
+        SearchAction theirsAction = { theirs >= 0 ? current->theirsKind[theirs] : 0,
+                                      theirs >= 0 ? current->theirsParameter[theirs] : 0, 0.0f };
+        playSearchTurn(ctx, worker->isPlayerSide, &mineAction, theirs >= 0 ? &theirsAction : NULL);
+        worker->turns++;
+
+        path[length] = node;
+        mineChoice[length] = mine;
+        theirsChoice[length] = theirs;
+        length++;
+
+        int child = findChild(worker, node, mine, theirs < 0 ? 0xFF : theirs);
+        if (child < 0) {
+            child = newNode(worker, ctx, worker->isPlayerSide);
+            if (child >= 0) {
+                MctsNode* created = &worker->nodes[child];
+                created->mineIndex = (uint8_t)mine;
+                created->theirsIndex = (uint8_t)(theirs < 0 ? 0xFF : theirs);
+                created->nextSibling = worker->nodes[node].firstChild;
+                worker->nodes[node].firstChild = child;
+            }
+            break;
+        }
+        node = child;
+    }
+
+    // Rollout com o bot guloso nos dois lados
+    if (!isBattleOver(ctx)) {
+        int startTurn = ctx->turn;
+        continueHeadlessBattle(ctx, BOT_POLICY_GREEDY, BOT_POLICY_GREEDY, startTurn + MCTS_ROLLOUT_TURNS);
+        worker->turns += ctx->turn - startTurn;
+    }
+    float value = (float)evaluateBattleState(ctx, worker->isPlayerSide);
+
+    // Retropropagação
+    for (int i = 0; i < length; i++) {
+        MctsNode* current = &worker->nodes[path[i]];
+        current->visits++;
+        current->mineVisits[mineChoice[i]]++;
+        current->mineTotal[mineChoice[i]] += value;
+        if (theirsChoice[i] >= 0) {
+            current->theirsVisits[theirsChoice[i]]++;
+            current->theirsTotal[theirsChoice[i]] -= value;
+        }
+    }
+    worker->iterations++;
+}
+
+static void runWorker(void* arg, int workerIndex) {
+    (void)workerIndex;
+    MctsWorker* worker = (MctsWorker*)arg;
+
+    // O clone já vem com os logs das regras desligados
+    BattleContext* ctx = cloneBattleContext(worker->source);
+    worker->nodes = (MctsNode*)malloc(MCTS_MAX_NODES * sizeof(MctsNode));
+    if (ctx == NULL || worker->nodes == NULL) {
+        worker->failed = true;
+        freeBattleContextClone(ctx);
+        return;
+    }
+
+    BattleRng rng;
+    battleRngSeed(&rng, worker->seed);
+    newNode(worker, ctx, worker->isPlayerSide);
+
+    while (worker->iterationLimit == 0 || worker->iterations < worker->iterationLimit) {
+        if (worker->hasDeadline && worker->iterations % MCTS_CLOCK_INTERVAL == 0 &&
+            deadlinePassed(&worker->deadline)) {
+            break;
+        }
+        runIteration(worker, ctx, &rng);
+    }
+
+    freeBattleContextClone(ctx);
+}
+
+// Heurística simples num clone, quando a busca não chega a uma ação
+static void chooseFallbackAction(BattleContext* ctx, bool isPlayerSide, MctsResult* result) {
+    BattleContext* clone = cloneBattleContext(ctx);
+    if (clone != NULL) {
+        chooseBotAction(clone, isPlayerSide, BOT_POLICY_SIMPLE, &result->action, &result->parameter);
+        freeBattleContextClone(clone);
+    }
+}
+
+bool chooseMctsAction(BattleContext* ctx, bool isPlayerSide, const MctsLimits* limits, MctsResult* result) {
+    memset(result, 0, sizeof(MctsResult));
+    if (ctx == NULL || limits == NULL) {
+        return false;
+    }
+
+    // Sem limite nenhum a busca não terminaria
+    MctsLimits effective = *limits;
+    if (effective.timeBudgetMs <= 0 && effective.iterations <= 0) {
+        effective.iterations = 1000;
+    }
+
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+
+    BattleSnapshot root;
+    if (!captureBattleSnapshot(ctx, &root)) {
+        chooseFallbackAction(ctx, isPlayerSide, result);
+        return false;
+    }
+
+    int threads = effective.threads > 0 ? effective.threads : getCpuCount();
+    if (effective.pool != NULL) {
+        threads = getWorkPoolThreadCount(effective.pool);
+    }
+    MctsWorker* workers = (MctsWorker*)calloc(threads, sizeof(MctsWorker));
+    if (workers == NULL) {
+        chooseFallbackAction(ctx, isPlayerSide, result);
+        return false;
+    }
+
+    struct timespec deadline = start;
+    if (effective.timeBudgetMs > 0) {
+        deadline.tv_sec += effective.timeBudgetMs / 1000;
+        deadline.tv_nsec += (long)(effective.timeBudgetMs % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+    }
+
+    for (int i = 0; i < threads; i++) {
+        MctsWorker* worker = &workers[i];
+        worker->source = ctx;
+        worker->root = &root;
+        worker->isPlayerSide = isPlayerSide;
+        worker->seed = effective.seed + 0x9E3779B97F4A7C15ULL * (uint64_t)(i + 1);
+        worker->hasDeadline = effective.timeBudgetMs > 0;
+        worker->deadline = deadline;
+        if (effective.iterations > 0) {
+            // Divide as iterações; as primeiras threads levam o resto
+            worker->iterationLimit = effective.iterations / threads + (i < effective.iterations % threads ? 1 : 0);
+            if (worker->iterationLimit == 0) {
+                worker->iterationLimit = -1;
+            }
+        }
+    }
+
+    // Uma thread: sem pool, na thread de quem chamou (o simulador já roda
+    // várias batalhas em paralelo). Sem um pool de quem chamou, as threads
+    // são criadas só para esta busca
+    if (threads == 1) {
+        runWorker(&workers[0], 0);
+    } else {
+        WorkPool* pool = effective.pool != NULL ? effective.pool : createWorkPool(threads);
+        if (pool == NULL) {
+            runWorker(&workers[0], 0);
+            threads = 1;
+        } else {
+            for (int i = 0; i < threads; i++) {
+                submitWorkTask(pool, runWorker, &workers[i]);
+            }
+            waitWorkPool(pool);
+            if (pool != effective.pool) {
+                freeWorkPool(pool);
+            }
+        }
+    }
+
+    // Soma as visitas da raiz de todas as árvores. As ações da raiz são
+    // geradas do mesmo estado, então os índices batem entre as threads
+    uint32_t visits[SEARCH_MAX_ACTIONS] = { 0 };
+    double totals[SEARCH_MAX_ACTIONS] = { 0.0 };
+    const MctsNode* reference = NULL;
+    for (int i = 0; i < threads; i++) {
+        MctsWorker* worker = &workers[i];
+        result->iterations += worker->iterations;
+        result->treeNodes += worker->nodeCount;
+        result->turnsSimulated += worker->turns;
+        if (worker->failed || worker->nodes == NULL || worker->nodeCount == 0) {
+            continue;
+        }
+
+        const MctsNode* rootNode = &worker->nodes[0];
+        reference = rootNode;
+        for (int a = 0; a < rootNode->mineCount; a++) {
+            visits[a] += rootNode->mineVisits[a];
+            totals[a] += rootNode->mineTotal[a];
+        }
+    }
+
+    int best = -1;
+    if (reference != NULL) {
+        for (int a = 0; a < reference->mineCount; a++) {
+            if (visits[a] > 0 && (best < 0 || visits[a] > visits[best])) {
+                best = a;
+            }
+        }
+    }
+
+    bool found = best >= 0;
+    if (found) {
+        result->action = reference->mineKind[best];
+        result->parameter = reference->mineParameter[best];
+        result->value = totals[best] / visits[best];
+    }
+
+    for (int i = 0; i < threads; i++) {
+        free(workers[i].nodes);
+    }
+    free(workers);
+
+    if (!found) {
+        // Nenhuma iteração coube no tempo
+        chooseFallbackAction(ctx, isPlayerSide, result);
+    }
+
+    struct timespec end;
+    timespec_get(&end, TIME_UTC);
+    result->elapsedMs = (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+    result->threads = threads;
+    if (result->elapsedMs > 0.0) {
+        result->iterationsPerSecond = result->iterations * 1000.0 / result->elapsedMs;
+        result->nodesPerSecond = result->turnsSimulated * 1000.0 / result->elapsedMs;
+    }
+    return found;
+}
@@ -0,0 +1,84 @@
+/**
+ * PokeBattle - Gerador de números aleatórios da batalha
+ *
+ * Implementação de referência do xoshiro256** (Blackman e Vigna), com a
+ * semente espalhada pelo splitmix64 para que sementes pequenas (0, 1, 2...)
+ * também gerem estados bem distribuídos.
+ */
+
+#include "battle_rng.h"
+
+static inline uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t splitmix64(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void battleRngSeed(BattleRng* rng, uint64_t seed) {
+    uint64_t state = seed;
+    for (int i = 0; i < 4; i++) {
+        rng->s[i] = splitmix64(&state);
+    }
+}
+
+uint64_t battleRngNext(BattleRng* rng) {
+    uint64_t* s = rng->s;
+    const uint64_t result = rotl(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+
+    s[2] ^= t;
+    s[3] = rotl(s[3], 45);
+
+    return result;
+}
+
+int battleRngRange(BattleRng* rng, int bound) {
+    if (bound <= 1) {
+        return 0;
+    }
+
+    // Multiplicação em vez de módulo: usa os bits altos, que são os melhores
+    uint64_t r = battleRngNext(rng) >> 32;
+    return (int)((r * (uint64_t)bound) >> 32);
+}
+
+// Avança o estado em 2^128 chamadas de battleRngNext
+static void battleRngJump(BattleRng* rng) {
+    static const uint64_t JUMP[] = {
+        0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+        0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+    };
+
+    uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int i = 0; i < 4; i++) {
+        for (int b = 0; b < 64; b++) {
+            if (JUMP[i] & (1ULL << b)) {
+                s0 ^= rng->s[0];
+                s1 ^= rng->s[1];
+                s2 ^= rng->s[2];
+                s3 ^= rng->s[3];
+            }
+            battleRngNext(rng);
+        }
+    }
+
+    rng->s[0] = s0;
+    rng->s[1] = s1;
+    rng->s[2] = s2;
+    rng->s[3] = s3;
+}
+
+void battleRngFork(BattleRng* parent, BattleRng* child) {
+    *child = *parent;
+    battleRngJump(parent);
+}
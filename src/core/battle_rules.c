@@ -0,0 +1,1396 @@
+/**
+ * PokeBattle - Regras da batalha
+ *
+ * Execução de ataques, trocas, itens, status e ordem do turno. Este arquivo
+ * faz parte do pokebattle_core e não conhece Raylib: efeitos visuais e sons
+ * são avisados ao jogo através de BattleEvent (ver battle_rules.h).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "battle_rules.h"
+#include "monster_data.h"
+
+// Avisa a camada de apresentação (se houver) sobre algo que aconteceu na batalha
+static void emitBattleEvent(BattleContext* ctx, BattleEventType type, const PokeMonster* source,
+                            const PokeMonster* target, int value, const Attack* attack, bool critical) {
+    if (ctx->eventHandler == NULL) {
+        return;
+    }
+
+    BattleEvent event;
+    event.type = type;
+    event.source = source;
+    event.target = target;
+    event.targetIsPlayer = (ctx->playerTeam != NULL && target == ctx->playerTeam->current);
+    event.value = value;
+    event.attack = attack;
+    event.attackType = attack ? attack->type : TYPE_NONE;
+    event.critical = critical;
+
+    ctx->eventHandler(&event, ctx->eventUserData);
+}
+
+// Cria um contexto de batalha vazio
+BattleContext* createBattleContext(void) {
+    BattleContext* ctx = (BattleContext*)calloc(1, sizeof(BattleContext));
+    if (ctx == NULL) {
+        printf("Erro ao alocar sistema de batalha!\n");
+        return NULL;
+    }
+
+    clearQueue(&ctx->actionQueue);
+    ctx->effectStack = createEffectStack(20);
+
+    // Verificar se tudo foi alocado corretamente
+    if (ctx->effectStack == NULL) {
+        printf("Erro ao alocar componentes do sistema de batalha!\n");
+        freeBattleContext(ctx);
+        return NULL;
+    }
+
+    ctx->battleState = BATTLE_IDLE;
+    ctx->playerTurn = true;
+    ctx->itemType = ITEM_POTION; // Padrão
+    ctx->aiLastAction = -1;
+    ctx->aiLastAttack = -1;
+    ctx->format = BATTLE_FORMAT_SINGLES;
+    ctx->debugLog = battleDebugLog;
+    battleRngSeed(&ctx->rng, 0);
+
+    return ctx;
+}
+
+// Libera o contexto (os times são gerenciados por quem chamou)
+void freeBattleContext(BattleContext* ctx) {
+    if (ctx == NULL) {
+        return;
+    }
+
+    if (ctx->effectStack) {
+        freeEffectStack(ctx->effectStack);
+    }
+
+    free(ctx);
+}
+
+void seedBattleContext(BattleContext* ctx, uint64_t seed) {
+    if (ctx == NULL) {
+        return;
+    }
+
+    battleRngSeed(&ctx->rng, seed);
+}
+
+static const char* formatNames[] = {"singles", "doubles", "triples"};
+
+void setBattleFormat(BattleContext* ctx, BattleFormat format) {
+    if (ctx == NULL) {
+        return;
+    }
+
+    if (format < BATTLE_FORMAT_SINGLES || format > BATTLE_FORMAT_TRIPLES) {
+        printf("ERRO: formato de batalha inválido: %d\n", format);
+        format = BATTLE_FORMAT_SINGLES;
+    }
+    ctx->format = format;
+}
+
+const char* getBattleFormatName(BattleFormat format) {
+    if (format < BATTLE_FORMAT_SINGLES || format > BATTLE_FORMAT_TRIPLES) {
+        return "desconhecido";
+    }
+    return formatNames[format - 1];
+}
+
+bool parseBattleFormat(const char* name, BattleFormat* format) {
+    if (name == NULL || format == NULL) {
+        return false;
+    }
+
+    for (int i = 0; i < 3; i++) {
+        if (strcmp(name, formatNames[i]) == 0) {
+            *format = (BattleFormat)(i + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+PokeMonster* getActiveMonster(BattleContext* ctx, bool isPlayerSide, int slot) {
+    if (ctx == NULL || slot < 0 || slot >= (int)ctx->format) {
+        return NULL;
+    }
+
+    if (slot == 0) {
+        MonsterList* team = isPlayerSide ? ctx->playerTeam : ctx->opponentTeam;
+        return team ? team->current : NULL;
+    }
+    return isPlayerSide ? ctx->playerActive[slot] : ctx->opponentActive[slot];
+}
+
+void setActiveMonster(BattleContext* ctx, bool isPlayerSide, int slot, PokeMonster* monster) {
+    if (ctx == NULL || slot < 0 || slot >= (int)ctx->format) {
+        return;
+    }
+
+    if (slot == 0) {
+        switchMonster(isPlayerSide ? ctx->playerTeam : ctx->opponentTeam, monster);
+    } else if (isPlayerSide) {
+        ctx->playerActive[slot] = monster;
+    } else {
+        ctx->opponentActive[slot] = monster;
+    }
+}
+
+bool findActiveSlot(BattleContext* ctx, PokeMonster* monster, bool* isPlayerSide, int* slot) {
+    if (ctx == NULL || monster == NULL) {
+        return false;
+    }
+
+    for (int side = 0; side < 2; side++) {
+        for (int i = 0; i < (int)ctx->format; i++) {
+            if (getActiveMonster(ctx, side == 0, i) == monster) {
+                if (isPlayerSide) *isPlayerSide = (side == 0);
+                if (slot) *slot = i;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool isMonsterActive(BattleContext* ctx, PokeMonster* monster) {
+    return findActiveSlot(ctx, monster, NULL, NULL);
+}
+
+PokeMonster* chooseAttackTarget(BattleContext* ctx, PokeMonster* attacker) {
+    bool isPlayerSide;
+    int slot;
+    if (!findActiveSlot(ctx, attacker, &isPlayerSide, &slot)) {
+        return NULL;
+    }
+    return chooseAttackTargetForSlot(ctx, isPlayerSide, slot);
+}
+
+PokeMonster* chooseAttackTargetForSlot(BattleContext* ctx, bool isPlayerSide, int slot) {
+    PokeMonster* target = getActiveMonster(ctx, !isPlayerSide, slot);
+    if (target != NULL && !isMonsterFainted(target)) {
+        return target;
+    }
+
+    for (int i = 0; i < (int)ctx->format; i++) {
+        PokeMonster* other = getActiveMonster(ctx, !isPlayerSide, i);
+        if (other != NULL && !isMonsterFainted(other)) {
+            return other;
+        }
+    }
+    return target;
+}
+
+// Ocupa os espaços 1 e 2 com os primeiros monstros de pé que não estão em campo
+static void fillActiveSlots(BattleContext* ctx, bool isPlayerSide) {
+    MonsterList* team = isPlayerSide ? ctx->playerTeam : ctx->opponentTeam;
+    if (team == NULL) {
+        return;
+    }
+
+    for (int slot = 1; slot < (int)ctx->format; slot++) {
+        for (PokeMonster* current = team->first; current != NULL; current = current->next) {
+            if (!isMonsterFainted(current) && !isMonsterActive(ctx, current)) {
+                setActiveMonster(ctx, isPlayerSide, slot, current);
+                break;
+            }
+        }
+    }
+}
+
+// Lado de um monstro que não está em campo (caso raro: procura nos times)
+static bool belongsToPlayer(BattleContext* ctx, PokeMonster* monster) {
+    for (PokeMonster* current = ctx->playerTeam ? ctx->playerTeam->first : NULL; current != NULL; current = current->next) {
+        if (current == monster) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Chave de ordem: prioridade do tipo de ação nos 2 bits altos, velocidade abaixo
+static uint16_t makeOrderKey(int kind, int speed) {
+    if (speed < 0) speed = 0;
+    if (speed > 0x3FFF) speed = 0x3FFF;
+    return (uint16_t)(((3 - getActionPriority(kind)) << 14) | speed);
+}
+
+bool queueBattleAction(BattleContext* ctx, int kind, int parameter, PokeMonster* monster) {
+    if (ctx == NULL || monster == NULL) {
+        return false;
+    }
+
+    bool isPlayerSide = true;
+    int slot = 0;
+    if (!findActiveSlot(ctx, monster, &isPlayerSide, &slot)) {
+        isPlayerSide = belongsToPlayer(ctx, monster);
+        slot = 0;
+    }
+
+    ActionRecord record;
+    record.monster = monster;
+    record.parameter = (int16_t)parameter;
+    record.side = isPlayerSide ? 0 : 1;
+    record.slot = (uint8_t)slot;
+    record.kind = (uint8_t)kind;
+    record.reserved = 0;
+    record.orderKey = makeOrderKey(kind, monster->speed);
+
+    if (!enqueue(&ctx->actionQueue, &record)) {
+        printf("ERRO: fila de ações cheia\n");
+        return false;
+    }
+    return true;
+}
+
+// Prepara o contexto para uma nova batalha
+void beginBattle(BattleContext* ctx, MonsterList* playerTeam, MonsterList* opponentTeam) {
+    if (ctx == NULL) {
+        return;
+    }
+
+    // Configurar os times
+    ctx->playerTeam = playerTeam;
+    ctx->opponentTeam = opponentTeam;
+
+    // Monstros em campo: o current e, em duplas e triplas, os próximos de pé
+    memset(ctx->playerActive, 0, sizeof(ctx->playerActive));
+    memset(ctx->opponentActive, 0, sizeof(ctx->opponentActive));
+    fillActiveSlots(ctx, true);
+    fillActiveSlots(ctx, false);
+
+    // Resetar contadores e estado
+    ctx->turn = 1;
+    ctx->battleState = BATTLE_INTRO;
+    ctx->playerTurn = true;
+    ctx->itemUsed = false;
+    ctx->playerItemUsed = false;
+    ctx->botItemUsed = false;
+    ctx->selectedAttack = 0;
+    ctx->selectedAction = 0;
+    ctx->botPotionUsed = false;
+    ctx->botRandomItemUsed = false;
+    ctx->playerPotionUsed = false;
+    ctx->playerRandomItemUsed = false;
+
+    // Escolher um item aleatório para a batalha
+    ctx->itemType = rollRandomItem(ctx);
+
+    // Limpar estruturas de dados
+    clearQueue(&ctx->actionQueue);
+    clearStack(ctx->effectStack);
+    ctx->actionQueueReady = false;
+
+    // Resetar mensagens e animações
+    memset(ctx->battleMessage, 0, sizeof(ctx->battleMessage));
+    memset(&ctx->currentMessage, 0, sizeof(ctx->currentMessage));
+    memset(&ctx->currentAnimation, 0, sizeof(ctx->currentAnimation));
+    ctx->stateTransitionDelay = 0.0f;
+
+    ctx->aiLastAction = -1;
+    ctx->aiActionRepeatCount = 0;
+    ctx->aiLastAttack = -1;
+    ctx->aiAttackRepeatCount = 0;
+}
+
+void setBattleEventHandler(BattleContext* ctx, BattleEventHandler handler, void* userData) {
+    if (ctx == NULL) {
+        return;
+    }
+
+    ctx->eventHandler = handler;
+    ctx->eventUserData = userData;
+}
+
+void setBattleChanceHandler(BattleContext* ctx, BattleChanceHandler handler, void* userData) {
+    if (ctx == NULL) {
+        return;
+    }
+
+    ctx->chanceHandler = handler;
+    ctx->chanceUserData = userData;
+}
+
+// Sorteio de sucesso/falha com a chance em porcentagem
+static bool rollChance(BattleContext* ctx, BattleChance chance, int percent) {
+    if (ctx->chanceHandler != NULL) {
+        return ctx->chanceHandler(chance, percent, ctx->chanceUserData) != 0;
+    }
+    return battleRngRange(&ctx->rng, 100) < percent;
+}
+
+// Executa um ataque
+void executeAttack(BattleContext* ctx, PokeMonster* attacker, PokeMonster* defender, int attackIndex) {
+    if (attacker == NULL || defender == NULL || attackIndex < 0 || attackIndex >= 4) {
+        return;
+    }
+
+    // Verificar se o monstro pode atacar
+    if (attacker->statusCondition == STATUS_SLEEPING) {
+        sprintf(ctx->battleMessage, "%s está dormindo e não pode atacar!", attacker->name);
+        return;
+    }
+
+    if (attacker->statusCondition == STATUS_PARALYZED) {
+        // 25% de chance de não conseguir atacar
+        if (rollChance(ctx, BATTLE_CHANCE_PARALYSIS, 25)) {
+            sprintf(ctx->battleMessage, "%s está paralisado e não conseguiu atacar!", attacker->name);
+            return;
+        }
+    }
+
+    // Verificar se o ataque tem PP
+    Attack* attack = &attacker->attacks[attackIndex];
+    if (attack->ppCurrent <= 0) {
+        sprintf(ctx->battleMessage, "%s tentou usar %s, mas não tem mais PP!",
+                attacker->name, attack->name);
+        return;
+    }
+
+    // Consumir PP
+    attack->ppCurrent--;
+
+    // Verificar acerto (baseado na precisão)
+    if (!rollChance(ctx, BATTLE_CHANCE_HIT, attack->accuracy)) {
+        sprintf(ctx->battleMessage, "%s usou %s, mas errou!", attacker->name, attack->name);
+        return;
+    }
+
+    // Gerar descrição do ataque (apenas para ataques bem-sucedidos)
+    char* description = generateAttackDescription(ctx, attacker, defender, attack);
+    if (description) {
+        strncpy(ctx->battleMessage, description, sizeof(ctx->battleMessage) - 1);
+        free(description);
+    } else {
+        sprintf(ctx->battleMessage, "%s usou %s!", attacker->name, attack->name);
+    }
+
+    // Efeito visual do ataque
+    emitBattleEvent(ctx, BATTLE_EVENT_ATTACK, attacker, defender, 0, attack, false);
+
+    // Calcular dano (se for um ataque de dano)
+    if (attack->power > 0) {
+    int damage = calculateDamage(ctx, attacker, defender, attack);
+
+    // Verificar crítico (5% de chance)
+    bool isCritical = rollChance(ctx, BATTLE_CHANCE_CRITICAL, 5);
+    if (isCritical) {
+        damage = damage * 3 / 2;
+    }
+
+    // Aplicar dano
+    defender->hp -= damage;
+    if (defender->hp < 0) {
+        defender->hp = 0;
+    }
+
+    BATTLE_DEBUG(ctx, "[DAMAGE] %s recebeu %d de dano%s\n",
+           defender->name, damage, isCritical ? " (CRÍTICO)" : "");
+
+    // Shake, número de dano e sons ficam com a camada de apresentação
+    emitBattleEvent(ctx, BATTLE_EVENT_DAMAGE, attacker, defender, damage, attack, isCritical);
+
+    // Adicionar informação de dano à mensagem
+    char damageText[50];
+    if (isCritical) {
+        sprintf(damageText, " Acerto crítico! Causou %d de dano!", damage);
+    } else {
+        sprintf(damageText, " Causou %d de dano!", damage);
+    }
+    strncat(ctx->battleMessage, damageText, sizeof(ctx->battleMessage) - strlen(ctx->battleMessage) - 1);
+}
+
+    // Verificar e aplicar efeito de status (com chance)
+    if (attack->statusEffect > 0 && attack->statusChance > 0) {
+        if (rollChance(ctx, BATTLE_CHANCE_STATUS, attack->statusChance)) {
+            applyStatusEffect(ctx, defender, attack->statusEffect, attack->statusPower, 3);
+
+            // Efeito visual de status
+            emitBattleEvent(ctx, BATTLE_EVENT_STATUS, attacker, defender, attack->statusEffect, attack, false);
+
+            // Adicionar informação de status à mensagem
+            char statusText[50];
+            switch (attack->statusEffect) {
+                case STATUS_ATK_DOWN: sprintf(statusText, " Reduziu o ataque!"); break;
+                case STATUS_DEF_DOWN: sprintf(statusText, " Reduziu a defesa!"); break;
+                case STATUS_SPD_DOWN: sprintf(statusText, " Reduziu a velocidade!"); break;
+                case STATUS_PARALYZED: sprintf(statusText, " Causou paralisia!"); break;
+                case STATUS_SLEEPING: sprintf(statusText, " Causou sono!"); break;
+                case STATUS_BURNING: sprintf(statusText, " Causou queimadura!"); break;
+                default: statusText[0] = '\0'; break;
+            }
+
+            strncat(ctx->battleMessage, statusText, sizeof(ctx->battleMessage) - strlen(ctx->battleMessage) - 1);
+        }
+    }
+
+    // Verificar se o monstro desmaiou
+    if (isMonsterFainted(defender)) {
+        // Efeito visual e som de desmaio
+        emitBattleEvent(ctx, BATTLE_EVENT_FAINT, attacker, defender, 0, attack, false);
+
+        char faintedText[50];
+        sprintf(faintedText, " %s desmaiou!", defender->name);
+        strncat(ctx->battleMessage, faintedText, sizeof(ctx->battleMessage) - strlen(ctx->battleMessage) - 1);
+
+        // Em duplas e triplas o espaço fica vazio até o próximo turno; em
+        // simples a troca acontece na hora
+        bool singles = (ctx->format == BATTLE_FORMAT_SINGLES);
+
+        // Se o monstro do jogador desmaiou
+        if (singles && defender == ctx->playerTeam->current) {
+            // Forçar troca imediatamente
+            ctx->battleState = BATTLE_FORCED_SWITCH;
+            ctx->playerTurn = true; // Dar controle ao jogador
+
+            // Limpar ações pendentes
+            clearQueue(&ctx->actionQueue);
+            ctx->actionQueueReady = false;
+
+            // Atualizar mensagem
+            strcpy(ctx->battleMessage, "Seu Pokémon desmaiou! Escolha outro!");
+        }
+
+        // Se o monstro do bot desmaiou
+        else if (singles && defender == ctx->opponentTeam->current) {
+            // Limpar TODA a fila de ações para o turno atual
+            // Isso garante que nenhum ataque aconteça após a troca
+            clearQueue(&ctx->actionQueue);
+
+            // O bot troca automaticamente
+            PokeMonster* newMonster = NULL;
+            PokeMonster* current = ctx->opponentTeam->first;
+            while (current != NULL) {
+                if (!isMonsterFainted(current)) {
+                    newMonster = current;
+                    break;
+                }
+                current = current->next;
+            }
+
+            if (newMonster != NULL && newMonster != ctx->opponentTeam->current) {
+                switchMonster(ctx->opponentTeam, newMonster);
+                char switchText[64];
+                sprintf(switchText, " Oponente enviou %s!", newMonster->name);
+                strncat(ctx->battleMessage, switchText, sizeof(ctx->battleMessage) - strlen(ctx->battleMessage) - 1);
+            }
+        }
+    }
+}
+
+/**
+ * Executa a troca de monstro
+ */
+void executeMonsterSwitch(BattleContext* ctx, PokeMonster* monster, int targetIndex) {
+    MonsterList* team = NULL;
+    bool isPlayer = false;
+
+    // Determinar qual time (em campo não precisa percorrer as listas)
+    bool activeSide;
+    if (findActiveSlot(ctx, monster, &activeSide, NULL)) {
+        team = activeSide ? ctx->playerTeam : ctx->opponentTeam;
+        isPlayer = activeSide;
+    } else {
+        if (monster) {
+            BATTLE_DEBUG(ctx, "DEBUG: Monster %s não é o atual de nenhum time, detectando time...\n", monster->name);
+
+            // Verificar se monster pertence ao time do jogador
+            PokeMonster* current = ctx->playerTeam->first;
+            while (current) {
+                if (current == monster) {
+                    team = ctx->playerTeam;
+                    isPlayer = true;
+                    BATTLE_DEBUG(ctx, "DEBUG: Monster %s pertence ao time do jogador\n", monster->name);
+                    break;
+                }
+                current = current->next;
+            }
+
+            // Se não encontrou no time do jogador, verificar no time do oponente
+            if (team == NULL) {
+                current = ctx->opponentTeam->first;
+                while (current) {
+                    if (current == monster) {
+                        team = ctx->opponentTeam;
+                        BATTLE_DEBUG(ctx, "DEBUG: Monster %s pertence ao time do oponente\n", monster->name);
+                        break;
+                    }
+                    current = current->next;
+                }
+            }
+        }
+    }
+
+    if (team == NULL) {
+        printf("ERRO: Não foi possível determinar o time em executeMonsterSwitch\n");
+        return;
+    }
+
+    // IMPORTANTE: Armazenar explicitamente o nome do monstro que está saindo da batalha
+    char currentMonsterName[32] = {0};
+    if (team->current) {
+        strcpy(currentMonsterName, team->current->name);
+    } else {
+        strcpy(currentMonsterName, "???");
+    }
+
+    BATTLE_DEBUG(ctx, "DEBUG: Trocando %s (time %s) para monstro no índice %d\n",
+           currentMonsterName, isPlayer ? "jogador" : "oponente", targetIndex);
+
+    // Encontrar o monstro alvo pelo índice
+    PokeMonster* newMonster = NULL;
+    PokeMonster* current = team->first;
+    int count = 0;
+
+    while (current != NULL) {
+        if (count == targetIndex) {
+            newMonster = current;
+            break;
+        }
+        current = current->next;
+        count++;
+    }
+
+    // Em duplas e triplas não dá para trocar por quem já está em campo
+    if (newMonster != NULL && ctx->format != BATTLE_FORMAT_SINGLES && isMonsterActive(ctx, newMonster)) {
+        sprintf(ctx->battleMessage, "%s já está em campo!", newMonster->name);
+        return;
+    }
+
+    // Verificar se encontrou o monstro e se ele não está desmaiado
+    if (newMonster != NULL && !isMonsterFainted(newMonster)) {
+        // Trocar para o novo monstro (no espaço de quem sai)
+        bool side;
+        int slot;
+        if (ctx->format != BATTLE_FORMAT_SINGLES && findActiveSlot(ctx, monster, &side, &slot)) {
+            setActiveMonster(ctx, side, slot, newMonster);
+        } else {
+            switchMonster(team, newMonster);
+        }
+
+        // Formatar mensagem de troca - usando o nome armazenado
+        if (isPlayer) {
+            sprintf(ctx->battleMessage, "Vai, %s!",newMonster->name);
+        } else {
+            sprintf(ctx->battleMessage, "O oponente trocou para %s!", newMonster->name);
+        }
+
+        BATTLE_DEBUG(ctx, "DEBUG: Troca realizada de %s para %s (isPlayer=%d)\n",
+               currentMonsterName, newMonster->name, isPlayer);
+    } else {
+        // Informar erro ao trocar
+        if (newMonster == NULL) {
+            printf("ERRO: Não foi possível encontrar o monstro com índice %d\n", targetIndex);
+            sprintf(ctx->battleMessage, "Não foi possível realizar a troca!");
+        } else if (isMonsterFainted(newMonster)) {
+            printf("ERRO: Tentativa de trocar para monstro desmaiado: %s\n", newMonster->name);
+            sprintf(ctx->battleMessage, "%s está desmaiado e não pode entrar em batalha!", newMonster->name);
+        }
+    }
+}
+
+/**
+ * Executa o uso de um item
+ */
+void executeItemUse(BattleContext* ctx, PokeMonster* user, ItemType itemType) {
+    // Usar o item no usuário apropriado
+    useItem(ctx, itemType, user);
+
+    // A mensagem já é definida na função useItem
+
+    // Se o item foi usado pelo bot/oponente e foi um Cartão Vermelho,
+    // ele afetará o jogador, não o bot
+    if (user == ctx->opponentTeam->current && itemType == ITEM_RED_CARD) {
+        // A lógica específica já está em useItem
+    }
+}
+
+int getActionPriority(int action) {
+    switch (action) {
+        case 1: return 1; // Troca - maior prioridade
+        case 2: return 2; // Item - média prioridade
+        case 0:
+        default: return 3; // Ataque - menor prioridade
+    }
+}
+
+static void siftTurnOrder(ActionRecord* records, int root, int count) {
+    while (true) {
+        int child = 2 * root + 1;
+        if (child >= count) {
+            return;
+        }
+
+        // Heap de quem age por último (menor chave), para a ordenação sair
+        // do primeiro ao último
+        if (child + 1 < count && records[child + 1].orderKey < records[child].orderKey) {
+            child++;
+        }
+        if (records[root].orderKey <= records[child].orderKey) {
+            return;
+        }
+
+        ActionRecord temp = records[root];
+        records[root] = records[child];
+        records[child] = temp;
+        root = child;
+    }
+}
+
+void sortTurnOrder(BattleContext* ctx, ActionRecord* records, int count) {
+    if (records == NULL || count < 2) {
+        return;
+    }
+
+    // Heapsort: O(n log n) no pior caso, no próprio vetor
+    for (int i = count / 2 - 1; i >= 0; i--) {
+        siftTurnOrder(records, i, count);
+    }
+    for (int end = count - 1; end > 0; end--) {
+        ActionRecord temp = records[0];
+        records[0] = records[end];
+        records[end] = temp;
+        siftTurnOrder(records, 0, end);
+    }
+
+    // Empates de chave: embaralhar cada grupo com o gerador da batalha
+    // (Fisher-Yates). O heapsort não é estável, mas a ordem dentro do grupo
+    // é sorteada de qualquer forma
+    int groupStart = 0;
+    for (int i = 1; i <= count; i++) {
+        if (i < count && records[i].orderKey == records[groupStart].orderKey) {
+            continue;
+        }
+
+        for (int j = i - 1; j > groupStart && ctx != NULL; j--) {
+            int k = groupStart + battleRngRange(&ctx->rng, j - groupStart + 1);
+            ActionRecord temp = records[j];
+            records[j] = records[k];
+            records[k] = temp;
+        }
+        groupStart = i;
+    }
+}
+
+// Define a ordem das ações do turno e recoloca na fila
+void determineAndExecuteTurnOrder(BattleContext* ctx) {
+    if (ctx == NULL || isQueueEmpty(&ctx->actionQueue)) {
+        return;
+    }
+
+    BATTLE_DEBUG(ctx, "[DEBUG] Ordenando ações. Contagem atual na fila: %d\n",
+           ctx->actionQueue.count);
+
+    ActionRecord records[ACTION_QUEUE_CAPACITY];
+    int count = 0;
+    bool onlySwitches = true;
+
+    // Retirar todas as ações da fila
+    ActionRecord record;
+    while (dequeue(&ctx->actionQueue, &record)) {
+        if (record.monster == NULL) {
+            continue;
+        }
+        onlySwitches = onlySwitches && record.kind == 1;
+        records[count++] = record;
+    }
+
+    BATTLE_DEBUG(ctx, "[DEBUG] Extraídas %d ações da fila\n", count);
+
+    sortTurnOrder(ctx, records, count);
+
+    // Caso especial: todos trocam de monstro no mesmo turno. As trocas são
+    // feitas aqui mesmo e as mensagens aparecem juntas
+    if (count > 1 && onlySwitches) {
+        BATTLE_DEBUG(ctx, "[DEBUG] Caso especial: todos trocam de monstro no mesmo turno\n");
+
+        char combinedMessage[256] = "";
+        for (int i = 0; i < count; i++) {
+            executeMonsterSwitch(ctx, records[i].monster, records[i].parameter);
+            if (i > 0) {
+                strncat(combinedMessage, "\n", sizeof(combinedMessage) - strlen(combinedMessage) - 1);
+            }
+            strncat(combinedMessage, ctx->battleMessage, sizeof(combinedMessage) - strlen(combinedMessage) - 1);
+        }
+        strncpy(ctx->battleMessage, combinedMessage, sizeof(ctx->battleMessage) - 1);
+        ctx->battleMessage[sizeof(ctx->battleMessage) - 1] = '\0';
+        return;
+    }
+
+    // Recolocar na fila na ordem correta
+    for (int i = 0; i < count; i++) {
+        enqueue(&ctx->actionQueue, &records[i]);
+        BATTLE_DEBUG(ctx, "[DEBUG] Recolocando ação %d na fila: tipo=%d, param=%d, monstro=%s (chave %u)\n",
+            i, records[i].kind, records[i].parameter, records[i].monster->name, records[i].orderKey);
+    }
+}
+
+// Executa um turno completo de uma vez (mesma sequência de updateBattle)
+void resolveTurn(BattleContext* ctx) {
+    if (ctx == NULL || ctx->playerTeam == NULL || ctx->opponentTeam == NULL) {
+        return;
+    }
+
+    determineAndExecuteTurnOrder(ctx);
+
+    ActionRecord record;
+    while (dequeue(&ctx->actionQueue, &record)) {
+        PokeMonster* monster = record.monster;
+        bool isPlayerSide = (record.side == 0);
+
+        // Monstro desmaiado não age
+        if (isMonsterFainted(monster)) {
+            continue;
+        }
+
+        switch (record.kind) {
+            case 0:
+                // Quem saiu de campo (Cartão Vermelho, por exemplo) não ataca mais
+                if (getActiveMonster(ctx, isPlayerSide, record.slot) != monster) {
+                    break;
+                }
+                executeAttack(ctx, monster, chooseAttackTargetForSlot(ctx, isPlayerSide, record.slot),
+                              record.parameter);
+                break;
+            case 1:
+                executeMonsterSwitch(ctx, monster, record.parameter);
+                break;
+            case 2:
+                executeItemUse(ctx, monster, (ItemType)record.parameter);
+                break;
+        }
+    }
+
+    processTurnEnd(ctx);
+    ctx->turn++;
+    clearQueue(&ctx->actionQueue);
+    ctx->actionQueueReady = false;
+}
+
+// Processa o final do turno (efeitos de status, etc.)
+void processTurnEnd(BattleContext* ctx) {
+    if (ctx == NULL) {
+        return;
+    }
+
+    BATTLE_DEBUG(ctx, "\n[DEBUG TURN] === PROCESSANDO FIM DE TURNO %d ===\n", ctx->turn);
+
+    // Resetar flag de item usado para o próximo turno
+    ctx->playerItemUsed = false;
+    ctx->botItemUsed = false;
+
+    // Processar efeitos de status ativos para o jogador
+    for (int slot = 0; slot < (int)ctx->format; slot++) {
+        PokeMonster* monster = getActiveMonster(ctx, true, slot);
+        if (monster != NULL) {
+            BATTLE_DEBUG(ctx, "[DEBUG TURN] Processando status do jogador...\n");
+            processStatusEffects(ctx, monster);
+        }
+    }
+
+    // Processar efeitos de status ativos para o oponente
+    for (int slot = 0; slot < (int)ctx->format; slot++) {
+        PokeMonster* monster = getActiveMonster(ctx, false, slot);
+        if (monster != NULL) {
+            BATTLE_DEBUG(ctx, "[DEBUG TURN] Processando status do oponente...\n");
+            processStatusEffects(ctx, monster);
+        }
+    }
+
+    BATTLE_DEBUG(ctx, "[DEBUG TURN] ==============================\n\n");
+}
+
+// Processa efeitos de status no final do turno
+void processStatusEffects(BattleContext* ctx, PokeMonster* monster) {
+    if (monster == NULL || monster->statusCondition == STATUS_NONE) {
+        return;
+    }
+
+    BATTLE_DEBUG(ctx, "\n[DEBUG STATUS] === Processando Status ===\n");
+    BATTLE_DEBUG(ctx, "[DEBUG STATUS] Monstro: %s\n", monster->name);
+    BATTLE_DEBUG(ctx, "[DEBUG STATUS] Status atual: %d\n", monster->statusCondition);
+    BATTLE_DEBUG(ctx, "[DEBUG STATUS] Turnos restantes ANTES: %d\n", monster->statusTurns);
+
+    // Primeiro, aplicar efeitos do status atual
+    switch (monster->statusCondition) {
+        case STATUS_BURNING:
+            {
+                int damage = monster->maxHp / 8;
+                if (damage < 1) damage = 1;
+                monster->hp -= damage;
+
+                if (monster->hp < 0) monster->hp = 0;
+
+                // Efeito visual de queimadura contínua
+                emitBattleEvent(ctx, BATTLE_EVENT_STATUS_TICK, NULL, monster, STATUS_BURNING, NULL, false);
+
+                sprintf(ctx->battleMessage, "%s sofreu %d de dano por estar em chamas!",
+                       monster->name, damage);
+            }
+            break;
+
+        case STATUS_SLEEPING:
+            BATTLE_DEBUG(ctx, "[DEBUG STATUS] %s está dormindo (não pode atacar)\n", monster->name);
+
+            // Efeito visual de sono contínuo
+            emitBattleEvent(ctx, BATTLE_EVENT_STATUS_TICK, NULL, monster, STATUS_SLEEPING, NULL, false);
+            break;
+
+        case STATUS_PARALYZED:
+            BATTLE_DEBUG(ctx, "[DEBUG STATUS] %s está paralisado\n", monster->name);
+
+            // Efeito visual de paralisia contínuo
+            emitBattleEvent(ctx, BATTLE_EVENT_STATUS_TICK, NULL, monster, STATUS_PARALYZED, NULL, false);
+            break;
+    }
+
+    // Decrementar turnos restantes
+    if (monster->statusTurns > 0) {
+        monster->statusTurns--;
+        BATTLE_DEBUG(ctx, "[DEBUG STATUS] Turnos restantes DEPOIS do decremento: %d\n", monster->statusTurns);
+
+        // Se chegou a 0, remover o status
+        if (monster->statusTurns == 0) {
+            BATTLE_DEBUG(ctx, "[DEBUG STATUS] *** STATUS DEVE EXPIRAR AGORA ***\n");
+
+            // Mensagem específica para cada status
+            switch (monster->statusCondition) {
+                case STATUS_SLEEPING:
+                    sprintf(ctx->battleMessage, "%s acordou!", monster->name);
+                    BATTLE_DEBUG(ctx, "[DEBUG STATUS] ACORDANDO %s\n", monster->name);
+                    break;
+                case STATUS_PARALYZED:
+                    sprintf(ctx->battleMessage, "%s não está mais paralisado!", monster->name);
+                    monster->speed *= 2;
+                    break;
+                case STATUS_BURNING:
+                    sprintf(ctx->battleMessage, "%s não está mais em chamas!", monster->name);
+                    break;
+                default:
+                    sprintf(ctx->battleMessage, "O status de %s acabou!", monster->name);
+                    break;
+            }
+
+            // Remover o status
+            monster->statusCondition = STATUS_NONE;
+            BATTLE_DEBUG(ctx, "[DEBUG STATUS] Status removido! Novo status: %d\n", monster->statusCondition);
+        }
+    }
+    BATTLE_DEBUG(ctx, "[DEBUG STATUS] ===========================\n\n");
+}
+
+// Aplica efeitos de status
+void applyStatusEffect(BattleContext* ctx, PokeMonster* target, int statusEffect, int statusPower, int duration) {
+    if (target == NULL || statusEffect <= 0) {
+        return;
+    }
+
+    // Se duration não foi especificado, usar valores padrão
+    if (duration <= 0) {
+        switch (statusEffect) {
+            case STATUS_SLEEPING:
+                duration = 2 + battleRngRange(&ctx->rng, 2); // 2-3 turnos
+                break;
+            case STATUS_BURNING:
+                duration = 3 + battleRngRange(&ctx->rng, 3); // 3-5 turnos
+                break;
+            case STATUS_PARALYZED:
+                duration = 2 + battleRngRange(&ctx->rng, 2); // 2-3 turnos
+                break;
+            default:
+                duration = 3; // Padrão 3 turnos
+                break;
+        }
+    }
+
+    BATTLE_DEBUG(ctx, "\n[DEBUG APPLY] === APLICANDO STATUS ===\n");
+    BATTLE_DEBUG(ctx, "[DEBUG APPLY] Alvo: %s\n", target->name);
+    BATTLE_DEBUG(ctx, "[DEBUG APPLY] Status: %d\n", statusEffect);
+    BATTLE_DEBUG(ctx, "[DEBUG APPLY] Duração: %d turnos\n", duration);
+
+    // Status principais não se sobrepõem
+    if (target->statusCondition > STATUS_SPD_DOWN &&
+        statusEffect > STATUS_SPD_DOWN &&
+        target->statusCondition != STATUS_NONE) {
+        BATTLE_DEBUG(ctx, "[DEBUG APPLY] BLOQUEADO: %s já tem status %d\n",
+               target->name, target->statusCondition);
+        return;
+    }
+
+    // Aplicar o status
+    target->statusCondition = statusEffect;
+    target->statusTurns = duration;
+    target->statusCounter = 0; // Resetar contador
+
+    BATTLE_DEBUG(ctx, "[DEBUG APPLY] Status aplicado com sucesso!\n");
+    BATTLE_DEBUG(ctx, "[DEBUG APPLY] =========================\n\n");
+
+    // Aplicar o efeito imediato
+    switch (statusEffect) {
+        case STATUS_ATK_DOWN: // Reduzir ataque
+            target->attack = target->attack * (100 - statusPower) / 100;
+            break;
+        case STATUS_DEF_DOWN: // Reduzir defesa
+            target->defense = target->defense * (100 - statusPower) / 100;
+            break;
+        case STATUS_SPD_DOWN: // Reduzir velocidade
+            target->speed = target->speed * (100 - statusPower) / 100;
+            break;
+        case STATUS_PARALYZED: // Paralisia (reduz velocidade)
+            target->speed = target->speed / 2;
+            break;
+        case STATUS_SLEEPING: // Dormindo (nada extra a fazer)
+        case STATUS_BURNING:  // Em chamas (dano no final do turno)
+            break;
+        default:
+            break;
+    }
+
+    // Salvar na pilha para processamento futuro
+    push(ctx->effectStack, statusEffect, duration, statusPower, target);
+}
+
+/**
+ * Sorteia um tipo de item aleatório para a batalha
+ */
+ItemType rollRandomItem(BattleContext* ctx) {
+    int roll = battleRngRange(&ctx->rng, 3); // 0, 1 ou 2
+    return (ItemType)roll;
+}
+
+/**
+ * Verifica se a batalha acabou
+ */
+bool isBattleOver(BattleContext* ctx) {
+    if (ctx == NULL ||
+        ctx->playerTeam == NULL ||
+        ctx->opponentTeam == NULL) {
+        return true;
+    }
+
+    // Verificar se todos os monstros de um time estão incapacitados
+    bool playerHasActiveMontser = false;
+    bool opponentHasActiveMonster = false;
+
+    // Verificar time do jogador
+    PokeMonster* current = ctx->playerTeam->first;
+    while (current != NULL) {
+        if (!isMonsterFainted(current)) {
+            playerHasActiveMontser = true;
+            break;
+        }
+        current = current->next;
+    }
+
+    // Verificar time do oponente
+    current = ctx->opponentTeam->first;
+    while (current != NULL) {
+        if (!isMonsterFainted(current)) {
+            opponentHasActiveMonster = true;
+            break;
+        }
+        current = current->next;
+    }
+
+    return (!playerHasActiveMontser || !opponentHasActiveMonster);
+}
+
+/**
+ * Determina o vencedor da batalha
+ */
+int getBattleWinner(BattleContext* ctx) {
+    if (ctx == NULL ||
+        ctx->playerTeam == NULL ||
+        ctx->opponentTeam == NULL) {
+        return 0;
+    }
+
+    bool playerHasActiveMontser = false;
+    bool opponentHasActiveMonster = false;
+
+    // Verificar time do jogador
+    PokeMonster* current = ctx->playerTeam->first;
+    while (current != NULL) {
+        if (!isMonsterFainted(current)) {
+            playerHasActiveMontser = true;
+            break;
+        }
+        current = current->next;
+    }
+
+    // Verificar time do oponente
+    current = ctx->opponentTeam->first;
+    while (current != NULL) {
+        if (!isMonsterFainted(current)) {
+            opponentHasActiveMonster = true;
+            break;
+        }
+        current = current->next;
+    }
+
+    if (!playerHasActiveMontser && !opponentHasActiveMonster) {
+        return 0; // Empate (raro)
+    } else if (!playerHasActiveMontser) {
+        return 2; // Oponente venceu
+    } else if (!opponentHasActiveMonster) {
+        return 1; // Jogador venceu
+    }
+
+    return 0; // Batalha ainda em andamento
+}
+
+/**
+ * Calcula o dano de um ataque
+ */
+int calculateDamage(BattleContext* ctx, PokeMonster* attacker, PokeMonster* defender, Attack* attack) {
+    if (attacker == NULL || defender == NULL || attack == NULL || attack->power == 0) {
+        return 0;
+    }
+
+    // Variação aleatória (85-100%)
+    int variation = ctx->chanceHandler != NULL ?
+        ctx->chanceHandler(BATTLE_CHANCE_DAMAGE_ROLL, 0, ctx->chanceUserData) :
+        battleRngRange(&ctx->rng, 16);
+    return calculateDamageWithRoll(attacker, defender, attack, 85 + variation);
+}
+
+/**
+ * Dano para uma variação aleatória já sorteada (85-100), só com inteiros
+ */
+int calculateDamageWithRoll(const PokeMonster* attacker, const PokeMonster* defender,
+                            const Attack* attack, int randomPercent) {
+    if (attacker == NULL || defender == NULL || attack == NULL || attack->power == 0) {
+        return 0;
+    }
+
+    // Fórmula básica de dano (similar à dos jogos Pokémon):
+    // Dano = (((2 * Nível / 5 + 2) * Poder * Ataque / Defesa) / 50 + 2) * Modificadores
+
+    // Como não temos níveis, vamos simplificar: Poder * Ataque / Defesa / 50 + 5.
+    // Os modificadores entram como frações inteiras e a divisão é feita uma vez
+    // só no final, em 64 bits: resultado exato e igual em qualquer compilador
+    int defense = defender->defense > 0 ? defender->defense : 1;
+    int64_t numerator = (int64_t)attack->power * attacker->attack + 250 * (int64_t)defense;
+    int64_t denominator = 50 * (int64_t)defense;
+
+    // Modificador de tipo: potência de 2, aplicada com deslocamento
+    int exponent = calculateTypeExponent(attack->type, defender->type1, defender->type2);
+    if (exponent == TYPE_EXPONENT_IMMUNE) {
+        numerator = 0;
+    } else if (exponent > 0) {
+        numerator <<= exponent;
+    } else {
+        denominator <<= -exponent;
+    }
+
+    // Bônus de Tipo Mesmo (Same Type Attack Bonus - STAB): 3/2
+    if (attack->type == attacker->type1 || attack->type == attacker->type2) {
+        numerator *= 3;
+        denominator *= 2;
+    }
+
+    numerator *= randomPercent;
+    denominator *= 100;
+
+    // Voltar para inteiro (trunca, como o cast de antes) com dano mínimo de 1
+    int result = (int)(numerator / denominator);
+    if (result < 1) {
+        result = 1;
+    }
+
+    return result;
+}
+
+/**
+ * Verifica se um monstro está incapacitado
+ */
+bool isMonsterFainted(PokeMonster* monster) {
+    return (monster == NULL || monster->hp <= 0);
+}
+
+/**
+ * Troca o monstro atual por outro
+ */
+void switchMonster(MonsterList* team, PokeMonster* newMonster) {
+    if (team == NULL || newMonster == NULL) {
+        return;
+    }
+
+    team->current = newMonster;
+}
+
+/**
+ * Usa um item
+ */
+void useItem(BattleContext* ctx, ItemType itemType, PokeMonster* target) {
+    if (target == NULL) {
+        printf("ERRO: Tentativa de usar item com target NULL\n");
+        return;
+    }
+
+    BATTLE_DEBUG(ctx, "[useItem] Usando item %d no monstro %s\n", itemType, target->name);
+
+    switch (itemType) {
+        case ITEM_POTION:
+            // Calcular quanto de HP pode ser curado
+        {
+            int hpToHeal = 20; // Máximo que a poção pode curar
+            int hpMissing = target->maxHp - target->hp; // Quanto de HP está faltando
+
+            // Curar apenas o necessário
+            if (hpMissing < hpToHeal) {
+                hpToHeal = hpMissing;
+            }
+
+            // Aplicar a cura
+            target->hp += hpToHeal;
+
+            // Garantir que o HP não ultrapasse o máximo
+            if (target->hp > target->maxHp) {
+                target->hp = target->maxHp;
+            }
+
+            // Efeito visual de cura
+            emitBattleEvent(ctx, BATTLE_EVENT_HEAL, target, target, hpToHeal, NULL, false);
+
+            // Mensagem informando quanto foi curado
+            if (hpToHeal > 0) {
+                sprintf(ctx->battleMessage, "Poção usada! %s recuperou %d de HP!", target->name, hpToHeal);
+            } else {
+                sprintf(ctx->battleMessage, "Poção usada! %s já está com HP máximo!", target->name);
+            }
+
+            // Debug para verificar o HP após usar a poção
+            BATTLE_DEBUG(ctx, "[useItem] Após usar poção: %s HP = %d/%d\n", target->name, target->hp, target->maxHp);
+        }
+            break;
+
+       case ITEM_RED_CARD:
+{
+    // Determinar o alvo do cartão vermelho
+    PokeMonster* affectedMonster = NULL;
+    MonsterList* affectedTeam = NULL;
+
+    // Verificar quem usou o item e quem deve ser afetado
+    if (target == ctx->playerTeam->current) {
+        // Jogador usou o item, afeta o oponente
+        affectedMonster = ctx->opponentTeam->current;
+        affectedTeam = ctx->opponentTeam;
+        sprintf(ctx->battleMessage, "Cartão Vermelho usado! Forçando o oponente a trocar!");
+    } else {
+        // Oponente usou o item, afeta o jogador
+        affectedMonster = ctx->playerTeam->current;
+        affectedTeam = ctx->playerTeam;
+        sprintf(ctx->battleMessage, "Oponente usou Cartão Vermelho! Seu Pokémon foi forçado a sair!");
+    }
+
+    // Verificar se há outros monstros disponíveis para troca
+    bool hasValidMonsters = false;
+    PokeMonster* current = affectedTeam->first;
+    int validMonsterIndex = -1;
+    int index = 0;
+
+    while (current != NULL) {
+        if (!isMonsterFainted(current) && current != affectedMonster) {
+            hasValidMonsters = true;
+            if (validMonsterIndex == -1) {
+                validMonsterIndex = index; // Guarda o índice do primeiro válido
+            }
+        }
+        current = current->next;
+        index++;
+    }
+
+    if (hasValidMonsters) {
+        // Limpar TODA a fila de ações para o turno atual
+        // Isso garante que nenhum ataque aconteça após a troca
+        clearQueue(&ctx->actionQueue);
+
+        // Fazer a troca imediatamente
+        PokeMonster* oldMonster = affectedTeam->current; // Guardar o Pokémon anterior para referência
+        executeMonsterSwitch(ctx, affectedMonster, validMonsterIndex);
+
+        // Atualizar mensagem informando a troca
+        if (affectedTeam == ctx->playerTeam) {
+            sprintf(ctx->battleMessage, "Cartão Vermelho usado! Seu %s foi substituído por %s!",
+                   oldMonster->name, affectedTeam->current->name);
+
+            // Como o jogador foi afetado, ele perde a vez de atacar
+            ctx->playerTurn = false;
+        } else {
+            sprintf(ctx->battleMessage, "Cartão Vermelho usado! Oponente trocou para %s!",
+                   affectedTeam->current->name);
+
+            // Como o oponente foi afetado, ele perde a vez de atacar
+            // (o jogador pode atacar normalmente)
+            ctx->playerTurn = true;
+        }
+
+        // Marcar que a ação da fila está completa
+        ctx->actionQueueReady = true;
+
+        // Definir que o próximo estado deve ser exibir a mensagem da troca
+        ctx->battleState = BATTLE_MESSAGE_DISPLAY;
+    } else {
+        // Não há outros monstros para trocar
+        sprintf(ctx->battleMessage, "Cartão Vermelho usado, mas não há outros Pokémon disponíveis!");
+    }
+}
+break;
+
+        case ITEM_COIN:
+            // 50% de chance de curar todo HP, 50% de chance de morrer
+            if (battleRngRange(&ctx->rng, 2) == 0) {
+                // Cura total
+                target->hp = target->maxHp;
+
+                // Efeito visual de cura massiva
+                emitBattleEvent(ctx, BATTLE_EVENT_FULL_HEAL, target, target, target->maxHp, NULL, false);
+
+                sprintf(ctx->battleMessage, "Moeda da Sorte: CARA! %s recuperou todo o HP!", target->name);
+            } else {
+                // HP = 0
+                target->hp = 0;
+
+                // Efeito visual de desmaiado
+                emitBattleEvent(ctx, BATTLE_EVENT_FAINT, target, target, 0, NULL, false);
+
+                sprintf(ctx->battleMessage, "Moeda da Sorte: COROA! %s desmaiou!", target->name);
+
+                // Se o jogador desmaiou, forçar troca
+                if (target == ctx->playerTeam->current) {
+                    ctx->battleState = BATTLE_FORCED_SWITCH;
+                    ctx->playerTurn = true;
+                }
+                // Se o oponente desmaiou, realizar troca automática
+                else if (target == ctx->opponentTeam->current) {
+                    // Verificar se há outros monstros disponíveis
+                    PokeMonster* newMonster = NULL;
+                    PokeMonster* current = ctx->opponentTeam->first;
+
+                    // Encontrar o próximo monstro não desmaiado
+                    while (current != NULL) {
+                        if (!isMonsterFainted(current) && current != target) {
+                            newMonster = current;
+                            break;
+                        }
+                        current = current->next;
+                    }
+
+                    // Se encontrou um monstro para trocar
+                    if (newMonster != NULL) {
+                        // Trocar para o novo monstro
+                        switchMonster(ctx->opponentTeam, newMonster);
+
+                        // Adicionar informação sobre a troca à mensagem
+                        char switchText[128];
+                        sprintf(switchText, " Oponente enviou %s!", newMonster->name);
+                        strncat(ctx->battleMessage, switchText, sizeof(ctx->battleMessage) - strlen(ctx->battleMessage) - 1);
+                    }
+                    // Se não houver mais monstros, a batalha terminará automaticamente na próxima verificação
+                }
+            }
+            break;
+
+        default:
+            sprintf(ctx->battleMessage, "Item desconhecido usado!");
+            break;
+    }
+
+    // Marcar o item como usado pelo usuário correto
+    if (target == ctx->playerTeam->current) {
+        BATTLE_DEBUG(ctx, "[useItem] Item usado pelo jogador\n");
+        ctx->playerItemUsed = true;
+    } else if (target == ctx->opponentTeam->current) {
+        BATTLE_DEBUG(ctx, "[useItem] Item usado pelo oponente\n");
+        ctx->botItemUsed = true;
+    }
+
+    if (target == ctx->playerTeam->current) {
+        BATTLE_DEBUG(ctx, "[useItem] Item usado pelo jogador\n");
+        ctx->playerItemUsed = true;
+
+        // Mesmo controle por batalha para o lado do jogador (bots do simulador)
+        if (itemType == ITEM_POTION) {
+            ctx->playerPotionUsed = true;
+        } else if (itemType == ITEM_RED_CARD || itemType == ITEM_COIN) {
+            ctx->playerRandomItemUsed = true;
+        }
+    } else if (target == ctx->opponentTeam->current) {
+        BATTLE_DEBUG(ctx, "[useItem] Item usado pelo oponente\n");
+        ctx->botItemUsed = true;
+
+        // Marcar o tipo específico de item como usado pelo bot
+        if (itemType == ITEM_POTION) {
+            ctx->botPotionUsed = true;
+            BATTLE_DEBUG(ctx, "[useItem] Bot marcou poção como usada\n");
+        } else if (itemType == ITEM_RED_CARD || itemType == ITEM_COIN) {
+            ctx->botRandomItemUsed = true;
+            BATTLE_DEBUG(ctx, "[useItem] Bot marcou item aleatório como usado\n");
+        }
+    }
+}
+
+bool hasActiveMonstersLeft(MonsterList* team) {
+    if (team == NULL) {
+        return false;
+    }
+
+    PokeMonster* current = team->first;
+    while (current != NULL) {
+        if (!isMonsterFainted(current)) {
+            return true;
+        }
+        current = current->next;
+    }
+
+    return false;
+}
+
+// Gera uma descrição textual para o ataque
+char* generateAttackDescription(BattleContext* ctx, PokeMonster* attacker, PokeMonster* defender, Attack* attack) {
+    if (attacker == NULL || defender == NULL || attack == NULL) {
+        return strdup("Um ataque foi realizado!");
+    }
+    
+    // Buffer para a mensagem
+    char* description = (char*)malloc(256);
+    if (description == NULL) {
+        return strdup("Erro de memória!");
+    }
+    
+    // Escolher um formato de mensagem aleatoriamente
+    int format = battleRngRange(&ctx->rng, 5);
+    
+    switch (format) {
+        case 0:
+            sprintf(description, "%s usou %s!", attacker->name, attack->name);
+            break;
+        case 1:
+            sprintf(description, "%s atacou com %s!", attacker->name, attack->name);
+            break;
+        case 2:
+            sprintf(description, "%s lançou %s contra %s!", attacker->name, attack->name, defender->name);
+            break;
+        case 3:
+            sprintf(description, "Um poderoso %s foi usado por %s!", attack->name, attacker->name);
+            break;
+        case 4:
+            sprintf(description, "%s executou %s com eficiência!", attacker->name, attack->name);
+            break;
+        default:
+            sprintf(description, "%s usou %s!", attacker->name, attack->name);
+            break;
+    }
+    
+    return description;
+}
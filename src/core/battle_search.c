@@ -0,0 +1,576 @@
+/**
+ * PokeBattle - Bot de busca (expectimax)
+ *
+ * Cada turno simulado roda as regras de verdade (resolveTurn) num clone do
+ * contexto. Os sorteios dos ataques passam pelo handler de chance: a busca
+ * força um ramo por vez e percorre todos como um odômetro, voltando ao
+ * estado do início do turno com restoreBattleSnapshot.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "battle_search.h"
+#include "battle_hash.h"
+#include "battle_snapshot.h"
+#include "battle_bot.h"
+#include "monster_data.h"
+
+// Sorteios acompanhados por turno (os seguintes usam o resultado mais provável)
+#define SEARCH_MAX_CHANCES 16
+
+// Caminhos de chance menos prováveis que isso não se ramificam mais. No
+// primeiro turno a busca é fina; nos seguintes, só os ramos que pesam
+#define SEARCH_MIN_PROBABILITY_ROOT 0.02
+#define SEARCH_MIN_PROBABILITY_DEEP 0.15
+
+// Abaixo da raiz só as melhores ações pela estimativa rápida entram
+#define SEARCH_INNER_ACTIONS 4
+
+// Turnos simulados entre consultas ao relógio
+#define SEARCH_CLOCK_INTERVAL 16
+
+// Variação do dano em três faixas: meio (5-10), baixa (0-4) e alta (11-15).
+// Depois do primeiro turno só a faixa do meio
+static const int damageRollValue[3] = { 7, 2, 13 };
+static const double damageRollProbability[3] = { 6.0 / 16.0, 5.0 / 16.0, 5.0 / 16.0 };
+
+// Ramos escolhidos para os sorteios de um turno
+typedef struct {
+    unsigned char choice[SEARCH_MAX_CHANCES];
+    unsigned char branches[SEARCH_MAX_CHANCES];
+    int count;
+    int position;
+    double probability;
+    double minProbability;
+    int damageBranches;
+} ChanceCursor;
+
+typedef struct {
+    BattleContext* ctx;
+    bool isPlayerSide;
+    BattleSnapshot states[SEARCH_MAX_DEPTH + 1];
+    ChanceCursor cursors[SEARCH_MAX_DEPTH];
+    ChanceCursor* cursor;
+
+    struct timespec deadline;
+    bool hasDeadline;
+    bool timeUp;
+    long turns;
+
+    // Tabela de transposição (opcional) e hash de cada nível
+    TranspositionTable* table;
+    BattleHasher hasher;
+    uint64_t hashes[SEARCH_MAX_DEPTH + 1];
+    long tableProbes;
+    long tableHits;
+} SearchState;
+
+static const SearchLimits difficultyLimits[SEARCH_DIFFICULTY_COUNT] = {
+    { 1, 1, NULL },
+    { 5, SEARCH_MAX_DEPTH, NULL },
+    { 12, SEARCH_MAX_DEPTH, NULL },
+    { 16, SEARCH_MAX_DEPTH, NULL }
+};
+
+static const char* difficultyNames[SEARCH_DIFFICULTY_COUNT] = { "FÁCIL", "NORMAL", "DIFÍCIL", "MESTRE" };
+
+SearchLimits getDifficultySearchLimits(int difficultyIndex) {
+    if (difficultyIndex < 0) difficultyIndex = 0;
+    if (difficultyIndex >= SEARCH_DIFFICULTY_COUNT) difficultyIndex = SEARCH_DIFFICULTY_COUNT - 1;
+    return difficultyLimits[difficultyIndex];
+}
+
+const char* getDifficultyName(int difficultyIndex) {
+    if (difficultyIndex < 0 || difficultyIndex >= SEARCH_DIFFICULTY_COUNT) {
+        return "?";
+    }
+    return difficultyNames[difficultyIndex];
+}
+
+// Ramos de um sorteio, o mais provável primeiro
+static int chanceBranchCount(const ChanceCursor* cursor, BattleChance chance, int percent) {
+    if (chance == BATTLE_CHANCE_DAMAGE_ROLL) {
+        return cursor->damageBranches;
+    }
+    return (percent <= 0 || percent >= 100) ? 1 : 2;
+}
+
+static int chanceBranchValue(BattleChance chance, int percent, int branch, double* probability) {
+    if (chance == BATTLE_CHANCE_DAMAGE_ROLL) {
+        *probability = damageRollProbability[branch];
+        return damageRollValue[branch];
+    }
+
+    // Sucesso/falha: o ramo 0 é o resultado mais provável
+    bool likelySuccess = percent >= 50;
+    bool success = (branch == 0) ? likelySuccess : !likelySuccess;
+    *probability = success ? percent / 100.0 : 1.0 - percent / 100.0;
+    return success ? 1 : 0;
+}
+
+static int searchChance(BattleChance chance, int percent, void* userData) {
+    SearchState* state = (SearchState*)userData;
+    ChanceCursor* cursor = state->cursor;
+    int index = cursor->position++;
+    double probability;
+
+    if (index >= SEARCH_MAX_CHANCES) {
+        return chanceBranchValue(chance, percent, 0, &probability);
+    }
+
+    if (index >= cursor->count) {
+        // Sorteio novo: começa pelo ramo mais provável. Caminho já improvável
+        // não se divide mais
+        cursor->count = index + 1;
+        cursor->choice[index] = 0;
+        cursor->branches[index] = (cursor->probability < cursor->minProbability) ?
+                                  1 : (unsigned char)chanceBranchCount(cursor, chance, percent);
+    }
+
+    int value = chanceBranchValue(chance, percent, cursor->choice[index], &probability);
+    if (chance == BATTLE_CHANCE_DAMAGE_ROLL && cursor->branches[index] == 1) {
+        return value;
+    }
+    if (cursor->branches[index] > 1) {
+        cursor->probability *= probability;
+    }
+    return value;
+}
+
+static bool checkClock(SearchState* state) {
+    if (!state->hasDeadline || state->turns % SEARCH_CLOCK_INTERVAL != 0) {
+        return state->timeUp;
+    }
+
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    if (now.tv_sec > state->deadline.tv_sec ||
+        (now.tv_sec == state->deadline.tv_sec && now.tv_nsec >= state->deadline.tv_nsec)) {
+        state->timeUp = true;
+    }
+    return state->timeUp;
+}
+
+int generateSearchActions(BattleContext* ctx, bool isPlayerSide, SearchAction* actions) {
+    MonsterList* team = isPlayerSide ? ctx->playerTeam : ctx->opponentTeam;
+    PokeMonster* self = team->current;
+    int count = 0;
+
+    if (self == NULL || isMonsterFainted(self)) {
+        return 0;
+    }
+
+    for (int i = 0; i < 4; i++) {
+        if (self->attacks[i].ppCurrent > 0) {
+            actions[count++] = (SearchAction){ 0, i, 0.0f };
+        }
+    }
+    if (count == 0) {
+        actions[count++] = (SearchAction){ 0, 0, 0.0f };
+    }
+
+    int index = 0;
+    for (PokeMonster* current = team->first; current != NULL && count < SEARCH_MAX_ACTIONS; current = current->next, index++) {
+        if (current != self && !isMonsterFainted(current)) {
+            actions[count++] = (SearchAction){ 1, index, 0.0f };
+        }
+    }
+
+    bool potionUsed = isPlayerSide ? ctx->playerPotionUsed : ctx->botPotionUsed;
+    bool randomItemUsed = isPlayerSide ? ctx->playerRandomItemUsed : ctx->botRandomItemUsed;
+    if (!potionUsed && self->hp < self->maxHp && count < SEARCH_MAX_ACTIONS) {
+        actions[count++] = (SearchAction){ 2, ITEM_POTION, 0.0f };
+    }
+    if (!randomItemUsed && ctx->itemType != ITEM_POTION && count < SEARCH_MAX_ACTIONS) {
+        actions[count++] = (SearchAction){ 2, ctx->itemType, 0.0f };
+    }
+
+    // Ataques pelo dano esperado contra o adversário em campo; trocas e
+    // itens depois. Ordenação por inserção: são no máximo 11
+    MonsterList* foeTeam = isPlayerSide ? ctx->opponentTeam : ctx->playerTeam;
+    PokeMonster* foe = foeTeam->current;
+    for (int i = 0; i < count; i++) {
+        if (actions[i].kind == 0 && foe != NULL) {
+            Attack* attack = &self->attacks[actions[i].parameter];
+            actions[i].order = (float)attack->power * attack->accuracy *
+                               calculateTypeEffectiveness(attack->type, foe->type1, foe->type2);
+        } else {
+            actions[i].order = -1.0f - actions[i].kind;
+        }
+
+        SearchAction current = actions[i];
+        int j = i - 1;
+        while (j >= 0 && actions[j].order < current.order) {
+            actions[j + 1] = actions[j];
+            j--;
+        }
+        actions[j + 1] = current;
+    }
+    return count;
+}
+
+static double teamHealth(MonsterList* team, int* alive) {
+    double health = 0.0;
+    *alive = 0;
+    for (PokeMonster* current = team->first; current != NULL; current = current->next) {
+        if (current->maxHp > 0 && current->hp > 0) {
+            health += (double)current->hp / current->maxHp;
+            (*alive)++;
+        }
+    }
+    return team->count > 0 ? health / team->count : 0.0;
+}
+
+double evaluateBattleState(BattleContext* ctx, bool isPlayerSide) {
+    int winner = isBattleOver(ctx) ? getBattleWinner(ctx) : -1;
+    if (winner >= 0) {
+        if (winner == 0) return 0.0;
+        return ((winner == 1) == isPlayerSide) ? 1.0 : -1.0;
+    }
+
+    int myAlive, foeAlive;
+    MonsterList* mine = isPlayerSide ? ctx->playerTeam : ctx->opponentTeam;
+    MonsterList* theirs = isPlayerSide ? ctx->opponentTeam : ctx->playerTeam;
+    double health = teamHealth(mine, &myAlive) - teamHealth(theirs, &foeAlive);
+    int size = mine->count > theirs->count ? mine->count : theirs->count;
+    double alive = size > 0 ? (double)(myAlive - foeAlive) / size : 0.0;
+    return 0.5 * health + 0.45 * alive;
+}
+
+void playSearchTurn(BattleContext* ctx, bool isPlayerSide, const SearchAction* mine, const SearchAction* theirs) {
+    PokeMonster* self = getActiveMonster(ctx, isPlayerSide, 0);
+    PokeMonster* foe = getActiveMonster(ctx, !isPlayerSide, 0);
+
+    if (mine != NULL && self != NULL) {
+        queueBattleAction(ctx, mine->kind, mine->parameter, self);
+    }
+    if (theirs != NULL && foe != NULL) {
+        queueBattleAction(ctx, theirs->kind, theirs->parameter, foe);
+    }
+    resolveTurn(ctx);
+
+    // Quem desmaiou é substituído como no simulador headless
+    for (int side = 0; side < 2; side++) {
+        PokeMonster* active = getActiveMonster(ctx, side == 0, 0);
+        if (active == NULL || isMonsterFainted(active)) {
+            PokeMonster* next = chooseBotReplacement(ctx, side == 0, BOT_POLICY_SIMPLE);
+            if (next != NULL) {
+                setActiveMonster(ctx, side == 0, 0, next);
+            }
+        }
+    }
+}
+
+static double evaluateState(SearchState* state) {
+    return evaluateBattleState(state->ctx, state->isPlayerSide);
+}
+
+static double searchDecision(SearchState* state, int depth, int remaining, double alpha, double beta,
+                             SearchAction* bestAction);
+
+// Valor esperado de um par de ações: média sobre todos os ramos de chance.
+// Para cedo quando a média já não pode entrar na janela (alpha, beta)
+static double searchChanceNode(SearchState* state, int depth, int remaining,
+                               const SearchAction* mine, const SearchAction* theirs,
+                               double alpha, double beta) {
+    ChanceCursor* cursor = &state->cursors[depth];
+    cursor->count = 0;
+    cursor->minProbability = depth == 0 ? SEARCH_MIN_PROBABILITY_ROOT : SEARCH_MIN_PROBABILITY_DEEP;
+    cursor->damageBranches = depth == 0 ? 3 : 1;
+
+    double sum = 0.0;
+    double unexplored = 1.0;
+
+    while (true) {
+        restoreBattleSnapshot(state->ctx, &state->states[depth]);
+        cursor->position = 0;
+        cursor->probability = 1.0;
+        state->cursor = cursor;
+        playSearchTurn(state->ctx, state->isPlayerSide, mine, theirs);
+        state->turns++;
+
+        double probability = cursor->probability;
+        double value;
+        if (remaining <= 1 || isBattleOver(state->ctx)) {
+            value = evaluateState(state);
+        } else {
+            // Janela do filho (Star1): fora dela a média já sai da janela
+            // deste nó, não importa o valor dos ramos que faltam
+            double others = unexplored - probability;
+            double childAlpha = (alpha - sum - others) / probability;
+            double childBeta = (beta - sum + others) / probability;
+            if (childAlpha < -1.0) childAlpha = -1.0;
+            if (childBeta > 1.0) childBeta = 1.0;
+
+            captureBattleSnapshot(state->ctx, &state->states[depth + 1]);
+            value = searchDecision(state, depth + 1, remaining - 1, childAlpha, childBeta, NULL);
+        }
+        if (checkClock(state)) {
+            return 0.0;
+        }
+
+        sum += probability * value;
+        unexplored -= probability;
+        if (sum - unexplored >= beta) return sum - unexplored;
+        if (sum + unexplored <= alpha) return sum + unexplored;
+
+        // Próximo ramo: o último sorteio que ainda tem ramos avança
+        int index = cursor->count - 1;
+        while (index >= 0 && cursor->choice[index] + 1 >= cursor->branches[index]) {
+            index--;
+        }
+        if (index < 0) {
+            break;
+        }
+        cursor->choice[index]++;
+        cursor->count = index + 1;
+    }
+
+    return sum;
+}
+
+// Modelo do adversário: ataques com peso proporcional ao dano estimado
+// (85% do total) e trocas e itens divididos igualmente no resto
+#define SEARCH_REPLY_ATTACK_SHARE 0.85
+
+static void replyWeights(const SearchAction* replies, int count, double* weights) {
+    double attackScore = 0.0;
+    int attacks = 0;
+    for (int i = 0; i < count; i++) {
+        if (replies[i].kind == 0) {
+            attackScore += replies[i].order;
+            attacks++;
+        }
+    }
+
+    int others = count - attacks;
+    double attackShare = others == 0 ? 1.0 : (attacks == 0 ? 0.0 : SEARCH_REPLY_ATTACK_SHARE);
+    for (int i = 0; i < count; i++) {
+        if (replies[i].kind != 0) {
+            weights[i] = (1.0 - attackShare) / others;
+        } else if (attackScore > 0.0) {
+            weights[i] = attackShare * replies[i].order / attackScore;
+        } else {
+            weights[i] = attackShare / attacks;
+        }
+    }
+}
+
+// Nó de decisão: a melhor ação de quem busca, com a resposta do adversário
+// como média pelo modelo acima. bestAction (se não NULL) vem com a ação a
+// tentar primeiro e volta com a melhor
+static double searchDecision(SearchState* state, int depth, int remaining, double alpha, double beta,
+                             SearchAction* bestAction) {
+    BattleContext* ctx = state->ctx;
+    restoreBattleSnapshot(ctx, &state->states[depth]);
+    if (isBattleOver(ctx)) {
+        return evaluateState(state);
+    }
+
+    // O mesmo estado por outro caminho (os dois trocam e destrocam, por
+    // exemplo) já pode ter sido buscado
+    TranspositionEntry entry;
+    bool hasEntry = false;
+    SearchAction hint = { -1, -1, 0.0f };
+    if (state->table != NULL) {
+        if (depth > 0) {
+            state->hashes[depth] = updateBattleHash(&state->hasher, state->hashes[depth - 1],
+                                                    &state->states[depth - 1], &state->states[depth]);
+        }
+        state->tableProbes++;
+        hasEntry = probeTransposition(state->table, state->hashes[depth], &entry);
+        if (hasEntry) {
+            state->tableHits++;
+            hint = (SearchAction){ entry.action, entry.parameter, 0.0f };
+
+            // Na raiz a busca precisa da ação, então não para aqui
+            if (depth > 0 && entry.depth >= remaining) {
+                if (entry.bound == TT_BOUND_EXACT ||
+                    (entry.bound == TT_BOUND_LOWER && entry.value >= beta) ||
+                    (entry.bound == TT_BOUND_UPPER && entry.value <= alpha)) {
+                    return entry.value;
+                }
+            }
+        }
+    }
+    if (bestAction != NULL) {
+        hint = *bestAction;
+    }
+
+    SearchAction mine[SEARCH_MAX_ACTIONS];
+    SearchAction theirs[SEARCH_MAX_ACTIONS];
+    double weights[SEARCH_MAX_ACTIONS];
+    int mineCount = generateSearchActions(ctx, state->isPlayerSide, mine);
+    int theirsCount = generateSearchActions(ctx, !state->isPlayerSide, theirs);
+    if (mineCount == 0) {
+        return evaluateState(state);
+    }
+    if (depth > 0) {
+        if (mineCount > SEARCH_INNER_ACTIONS) mineCount = SEARCH_INNER_ACTIONS;
+        if (theirsCount > SEARCH_INNER_ACTIONS) theirsCount = SEARCH_INNER_ACTIONS;
+    }
+    replyWeights(theirs, theirsCount, weights);
+
+    // Melhor ação da iteração anterior (ou da tabela) primeiro: corta mais cedo
+    if (hint.kind >= 0) {
+        for (int i = 1; i < mineCount; i++) {
+            if (mine[i].kind == hint.kind && mine[i].parameter == hint.parameter) {
+                SearchAction first = mine[i];
+                memmove(&mine[1], &mine[0], i * sizeof(SearchAction));
+                mine[0] = first;
+                break;
+            }
+        }
+    }
+
+    double best = -1.0;
+    int bestIndex = 0;
+    bool found = false;
+    for (int i = 0; i < mineCount; i++) {
+        double floor = alpha > best ? alpha : best;
+        double sum = 0.0;
+        double unexplored = 1.0;
+
+        if (theirsCount == 0) {
+            sum = searchChanceNode(state, depth, remaining, &mine[i], NULL, floor, beta);
+            unexplored = 0.0;
+        }
+        for (int j = 0; j < theirsCount; j++) {
+            double weight = weights[j];
+            if (weight <= 0.0) {
+                continue;
+            }
+
+            // Mesma janela Star1 dos nós de chance
+            double others = unexplored - weight;
+            double childAlpha = (floor - sum - others) / weight;
+            double childBeta = (beta - sum + others) / weight;
+            if (childAlpha < -1.0) childAlpha = -1.0;
+            if (childBeta > 1.0) childBeta = 1.0;
+
+            double value = searchChanceNode(state, depth, remaining, &mine[i], &theirs[j],
+                                            childAlpha, childBeta);
+            if (state->timeUp) {
+                return best;
+            }
+
+            sum += weight * value;
+            unexplored -= weight;
+            if (sum - unexplored >= beta) {
+                sum -= unexplored;
+                break;
+            }
+            if (sum + unexplored <= floor) {
+                sum += unexplored;
+                break;
+            }
+        }
+
+        if (!found || sum > best) {
+            best = sum;
+            bestIndex = i;
+            found = true;
+            if (bestAction != NULL) {
+                *bestAction = mine[i];
+            }
+        }
+        if (best >= beta) {
+            break;
+        }
+    }
+
+    if (state->table != NULL && !state->timeUp) {
+        entry.value = (float)best;
+        entry.depth = remaining;
+        entry.bound = best >= beta ? TT_BOUND_LOWER : (best <= alpha ? TT_BOUND_UPPER : TT_BOUND_EXACT);
+        entry.action = mine[bestIndex].kind;
+        entry.parameter = mine[bestIndex].parameter;
+        storeTransposition(state->table, state->hashes[depth], &entry);
+    }
+    return best;
+}
+
+bool chooseSearchAction(BattleContext* ctx, bool isPlayerSide, const SearchLimits* limits,
+                        SearchResult* result) {
+    memset(result, 0, sizeof(SearchResult));
+    if (ctx == NULL || limits == NULL) {
+        return false;
+    }
+
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+
+    // O clone começa com os logs das regras desligados (só atrapalhariam)
+    SearchState state;
+    memset(&state, 0, sizeof(SearchState));
+    state.ctx = cloneBattleContext(ctx);
+    state.isPlayerSide = isPlayerSide;
+    if (state.ctx == NULL) {
+        chooseBotAction(ctx, isPlayerSide, BOT_POLICY_SIMPLE, &result->action, &result->parameter);
+        return false;
+    }
+    setBattleChanceHandler(state.ctx, searchChance, &state);
+
+    if (limits->timeBudgetMs > 0) {
+        state.hasDeadline = true;
+        state.deadline = start;
+        state.deadline.tv_sec += limits->timeBudgetMs / 1000;
+        state.deadline.tv_nsec += (long)(limits->timeBudgetMs % 1000) * 1000000L;
+        if (state.deadline.tv_nsec >= 1000000000L) {
+            state.deadline.tv_sec++;
+            state.deadline.tv_nsec -= 1000000000L;
+        }
+    }
+
+    captureBattleSnapshot(state.ctx, &state.states[0]);
+    if (limits->table != NULL && initBattleHasher(&state.hasher, state.ctx)) {
+        state.table = limits->table;
+        state.hashes[0] = hashBattleSnapshot(&state.hasher, &state.states[0]);
+    }
+
+    // Aprofundamento iterativo: só vale o resultado de profundidade completa
+    int maxDepth = limits->maxDepth;
+    if (maxDepth < 1) maxDepth = 1;
+    if (maxDepth > SEARCH_MAX_DEPTH) maxDepth = SEARCH_MAX_DEPTH;
+
+    SearchAction best = { 0, 0, 0.0f };
+    bool hasBest = false;
+    for (int depth = 1; depth <= maxDepth; depth++) {
+        SearchAction candidate = best;
+        double value = searchDecision(&state, 0, depth, -1.0, 1.0, &candidate);
+        if (state.timeUp) {
+            break;
+        }
+
+        best = candidate;
+        hasBest = true;
+        result->depthReached = depth;
+        result->value = value;
+
+        // Resultado decidido: olhar mais fundo não muda nada
+        if (value >= 1.0 || value <= -1.0) {
+            break;
+        }
+    }
+
+    if (hasBest) {
+        result->action = best.kind;
+        result->parameter = best.parameter;
+    } else {
+        // Nem um turno coube no tempo: heurística simples, no clone
+        restoreBattleSnapshot(state.ctx, &state.states[0]);
+        setBattleChanceHandler(state.ctx, NULL, NULL);
+        chooseBotAction(state.ctx, isPlayerSide, BOT_POLICY_SIMPLE, &result->action, &result->parameter);
+    }
+    result->turnsSimulated = state.turns;
+    result->tableProbes = state.tableProbes;
+    result->tableHits = state.tableHits;
+
+    freeBattleContextClone(state.ctx);
+
+    struct timespec end;
+    timespec_get(&end, TIME_UTC);
+    result->elapsedMs = (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+    return hasBest;
+}
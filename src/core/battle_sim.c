@@ -0,0 +1,151 @@
+/**
+ * PokeBattle - Batalhas headless
+ *
+ * Mesmo fluxo de turnos do jogo (escolha dos dois lados, ordem, execução,
+ * fim de turno), mas sem pausas, mensagens na tela nem efeitos.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "battle_sim.h"
+#include "monster_data.h"
+
+bool parseTeamSpec(const char* text, TeamSpec* spec) {
+    if (text == NULL || spec == NULL) {
+        return false;
+    }
+
+    memset(spec, 0, sizeof(TeamSpec));
+
+    if (strncmp(text, "random:", 7) == 0) {
+        spec->randomCount = atoi(text + 7);
+        return spec->randomCount > 0 && spec->randomCount <= SIM_MAX_TEAM_SIZE &&
+               spec->randomCount <= getMonsterCount();
+    }
+
+    char buffer[256];
+    strncpy(buffer, text, sizeof(buffer) - 1);
+    buffer[sizeof(buffer) - 1] = '\0';
+
+    for (char* token = strtok(buffer, ","); token != NULL; token = strtok(NULL, ",")) {
+        if (spec->count >= SIM_MAX_TEAM_SIZE) {
+            printf("ERRO: time com mais de %d monstros\n", SIM_MAX_TEAM_SIZE);
+            return false;
+        }
+
+        // Número: índice no banco; caso contrário, nome do monstro
+        char* end = NULL;
+        long index = strtol(token, &end, 10);
+        if (end != token && *end == '\0') {
+            if (index < 0 || index >= getMonsterCount()) {
+                printf("ERRO: índice de monstro inválido: %ld\n", index);
+                return false;
+            }
+            spec->indices[spec->count++] = (int)index;
+            continue;
+        }
+
+        PokeMonster* monster = getMonsterByName(token);
+        if (monster == NULL) {
+            printf("ERRO: monstro não encontrado: %s\n", token);
+            return false;
+        }
+        spec->indices[spec->count++] = (int)(monster - monsterDB.monsters);
+    }
+
+    return spec->count > 0;
+}
+
+MonsterList* createTeamFromSpec(const TeamSpec* spec, BattleRng* rng) {
+    MonsterList* team = createMonsterList();
+    if (team == NULL) {
+        return NULL;
+    }
+
+    if (spec->randomCount > 0) {
+        // Sorteio sem repetição
+        int chosen[SIM_MAX_TEAM_SIZE];
+        int chosenCount = 0;
+        while (chosenCount < spec->randomCount) {
+            int index = battleRngRange(rng, getMonsterCount());
+            bool repeated = false;
+            for (int i = 0; i < chosenCount; i++) {
+                if (chosen[i] == index) {
+                    repeated = true;
+                    break;
+                }
+            }
+            if (repeated) continue;
+
+            chosen[chosenCount++] = index;
+            addMonsterQuiet(team, createMonsterCopy(getMonsterByIndex(index)));
+        }
+    } else {
+        for (int i = 0; i < spec->count; i++) {
+            addMonsterQuiet(team, createMonsterCopy(getMonsterByIndex(spec->indices[i])));
+        }
+    }
+
+    return team;
+}
+
+// Preenche os espaços vazios ou com monstro desmaiado. Espaço sem
+// substituto fica como está (o lado pode continuar com os outros)
+static void replaceFaintedMonsters(BattleContext* ctx, bool isPlayerSide, BotPolicy policy) {
+    for (int slot = 0; slot < (int)ctx->format; slot++) {
+        PokeMonster* monster = getActiveMonster(ctx, isPlayerSide, slot);
+        if (monster != NULL && !isMonsterFainted(monster)) {
+            continue;
+        }
+
+        PokeMonster* replacement = chooseBotReplacementForSlot(ctx, isPlayerSide, slot, policy);
+        if (replacement != NULL) {
+            setActiveMonster(ctx, isPlayerSide, slot, replacement);
+        }
+    }
+}
+
+// Enfileira a ação de cada monstro de pé de um lado
+static void chooseSideActions(BattleContext* ctx, bool isPlayerSide, BotPolicy policy) {
+    for (int slot = 0; slot < (int)ctx->format; slot++) {
+        PokeMonster* monster = getActiveMonster(ctx, isPlayerSide, slot);
+        if (monster == NULL || isMonsterFainted(monster)) {
+            continue;
+        }
+
+        int action, parameter;
+        chooseBotActionForSlot(ctx, isPlayerSide, slot, policy, &action, &parameter);
+        queueBattleAction(ctx, action, parameter, monster);
+    }
+}
+
+int playHeadlessBattle(BattleContext* ctx, MonsterList* playerTeam, MonsterList* opponentTeam,
+                       BotPolicy playerPolicy, BotPolicy opponentPolicy, int maxTurns) {
+    if (ctx == NULL || playerTeam == NULL || opponentTeam == NULL) {
+        return 0;
+    }
+
+    beginBattle(ctx, playerTeam, opponentTeam);
+    ctx->battleState = BATTLE_SELECT_ACTION;
+
+    int winner = continueHeadlessBattle(ctx, playerPolicy, opponentPolicy, maxTurns);
+    ctx->battleState = BATTLE_OVER;
+    return winner;
+}
+
+int continueHeadlessBattle(BattleContext* ctx, BotPolicy playerPolicy, BotPolicy opponentPolicy, int maxTurns) {
+    while (!isBattleOver(ctx) && ctx->turn <= maxTurns) {
+        replaceFaintedMonsters(ctx, true, playerPolicy);
+        replaceFaintedMonsters(ctx, false, opponentPolicy);
+
+        // O jogador escolhe primeiro, como na fila do jogo
+        chooseSideActions(ctx, true, playerPolicy);
+        chooseSideActions(ctx, false, opponentPolicy);
+
+        ctx->actionQueueReady = true;
+        resolveTurn(ctx);
+    }
+
+    return getBattleWinner(ctx);
+}
@@ -0,0 +1,219 @@
+/**
+ * PokeBattle - Fotografia da batalha
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "battle_snapshot.h"
+#include "monster_data.h"
+
+static bool fitsInt16(int value) {
+    return value >= INT16_MIN && value <= INT16_MAX;
+}
+
+static bool fitsInt8(int value) {
+    return value >= INT8_MIN && value <= INT8_MAX;
+}
+
+static bool captureMonster(const PokeMonster* monster, MonsterSnapshot* out) {
+    if (!fitsInt16(monster->hp) || !fitsInt16(monster->attack) ||
+        !fitsInt16(monster->defense) || !fitsInt16(monster->speed) ||
+        !fitsInt8(monster->statusCondition) || !fitsInt8(monster->statusCounter) ||
+        !fitsInt8(monster->statusTurns)) {
+        return false;
+    }
+
+    out->hp = (int16_t)monster->hp;
+    out->attack = (int16_t)monster->attack;
+    out->defense = (int16_t)monster->defense;
+    out->speed = (int16_t)monster->speed;
+    for (int i = 0; i < 4; i++) {
+        int pp = monster->attacks[i].ppCurrent;
+        if (pp < 0 || pp > UINT8_MAX) {
+            return false;
+        }
+        out->pp[i] = (uint8_t)pp;
+    }
+    out->statusCondition = (int8_t)monster->statusCondition;
+    out->statusCounter = (int8_t)monster->statusCounter;
+    out->statusTurns = (int8_t)monster->statusTurns;
+    out->reserved = 0;
+    return true;
+}
+
+static void restoreMonster(PokeMonster* monster, const MonsterSnapshot* in) {
+    monster->hp = in->hp;
+    monster->attack = in->attack;
+    monster->defense = in->defense;
+    monster->speed = in->speed;
+    for (int i = 0; i < 4; i++) {
+        monster->attacks[i].ppCurrent = in->pp[i];
+    }
+    monster->statusCondition = in->statusCondition;
+    monster->statusCounter = in->statusCounter;
+    monster->statusTurns = in->statusTurns;
+}
+
+// Monstro em campo no espaço (o espaço 0 é sempre o current do time)
+static PokeMonster* activeAt(const BattleContext* ctx, int side, int slot) {
+    if (slot == 0) {
+        MonsterList* team = side == 0 ? ctx->playerTeam : ctx->opponentTeam;
+        return team ? team->current : NULL;
+    }
+    return side == 0 ? ctx->playerActive[slot] : ctx->opponentActive[slot];
+}
+
+static bool captureTeam(const BattleContext* ctx, int side, TeamSnapshot* out) {
+    const MonsterList* team = side == 0 ? ctx->playerTeam : ctx->opponentTeam;
+    if (team == NULL) {
+        return false;
+    }
+
+    PokeMonster* members[SNAPSHOT_MAX_TEAM];
+    int count = 0;
+    for (PokeMonster* current = team->first; current != NULL; current = current->next) {
+        if (count >= SNAPSHOT_MAX_TEAM || !captureMonster(current, &out->monsters[count])) {
+            return false;
+        }
+        members[count++] = current;
+    }
+    out->count = (uint8_t)count;
+
+    for (int slot = 0; slot < BATTLE_MAX_ACTIVE; slot++) {
+        PokeMonster* active = slot < (int)ctx->format ? activeAt(ctx, side, slot) : NULL;
+        out->active[slot] = SNAPSHOT_NO_MONSTER;
+        for (int i = 0; i < count; i++) {
+            if (members[i] == active) {
+                out->active[slot] = (uint8_t)i;
+                break;
+            }
+        }
+    }
+
+    out->itemUsed = side == 0 ? ctx->playerItemUsed : ctx->botItemUsed;
+    out->potionUsed = side == 0 ? ctx->playerPotionUsed : ctx->botPotionUsed;
+    out->randomItemUsed = side == 0 ? ctx->playerRandomItemUsed : ctx->botRandomItemUsed;
+    out->reserved = 0;
+    return true;
+}
+
+bool captureBattleSnapshot(const BattleContext* ctx, BattleSnapshot* snapshot) {
+    if (ctx == NULL || snapshot == NULL) {
+        return false;
+    }
+
+    memset(snapshot, 0, sizeof(BattleSnapshot));
+    snapshot->rng = ctx->rng;
+    snapshot->turn = ctx->turn;
+    snapshot->format = (uint8_t)ctx->format;
+    snapshot->itemType = (uint8_t)ctx->itemType;
+    snapshot->itemUsed = ctx->itemUsed;
+
+    return captureTeam(ctx, 0, &snapshot->teams[0]) &&
+           captureTeam(ctx, 1, &snapshot->teams[1]);
+}
+
+static bool restoreTeam(BattleContext* ctx, int side, const TeamSnapshot* in) {
+    MonsterList* team = side == 0 ? ctx->playerTeam : ctx->opponentTeam;
+    if (team == NULL || team->count != in->count) {
+        return false;
+    }
+
+    PokeMonster* members[SNAPSHOT_MAX_TEAM];
+    int count = 0;
+    for (PokeMonster* current = team->first; current != NULL && count < in->count; current = current->next) {
+        restoreMonster(current, &in->monsters[count]);
+        members[count++] = current;
+    }
+
+    PokeMonster** active = side == 0 ? ctx->playerActive : ctx->opponentActive;
+    for (int slot = 0; slot < BATTLE_MAX_ACTIVE; slot++) {
+        PokeMonster* monster = in->active[slot] < count ? members[in->active[slot]] : NULL;
+        if (slot == 0) {
+            team->current = monster;
+        }
+        active[slot] = monster;
+    }
+
+    if (side == 0) {
+        ctx->playerItemUsed = in->itemUsed;
+        ctx->playerPotionUsed = in->potionUsed;
+        ctx->playerRandomItemUsed = in->randomItemUsed;
+    } else {
+        ctx->botItemUsed = in->itemUsed;
+        ctx->botPotionUsed = in->potionUsed;
+        ctx->botRandomItemUsed = in->randomItemUsed;
+    }
+    return true;
+}
+
+bool restoreBattleSnapshot(BattleContext* ctx, const BattleSnapshot* snapshot) {
+    if (ctx == NULL || snapshot == NULL) {
+        return false;
+    }
+
+    if (!restoreTeam(ctx, 0, &snapshot->teams[0]) || !restoreTeam(ctx, 1, &snapshot->teams[1])) {
+        printf("ERRO: os times não correspondem à fotografia da batalha\n");
+        return false;
+    }
+
+    ctx->rng = snapshot->rng;
+    ctx->turn = snapshot->turn;
+    ctx->format = (BattleFormat)snapshot->format;
+    ctx->itemType = snapshot->itemType;
+    ctx->itemUsed = snapshot->itemUsed;
+    clearQueue(&ctx->actionQueue);
+    return true;
+}
+
+static MonsterList* copyTeam(const MonsterList* source) {
+    MonsterList* team = createMonsterList();
+    if (team == NULL || source == NULL) {
+        return team;
+    }
+
+    for (PokeMonster* current = source->first; current != NULL; current = current->next) {
+        PokeMonster* copy = createMonsterCopy(current);
+        if (copy == NULL) {
+            freeMonsterList(team);
+            return NULL;
+        }
+        addMonsterQuiet(team, copy);
+    }
+    return team;
+}
+
+BattleContext* cloneBattleContext(const BattleContext* source) {
+    BattleSnapshot snapshot;
+    if (source == NULL || !captureBattleSnapshot(source, &snapshot)) {
+        return NULL;
+    }
+
+    BattleContext* clone = createBattleContext();
+    if (clone == NULL) {
+        return NULL;
+    }
+    // Clones servem às buscas e simulações, que não logam
+    clone->debugLog = false;
+
+    clone->playerTeam = copyTeam(source->playerTeam);
+    clone->opponentTeam = copyTeam(source->opponentTeam);
+    clone->battleState = source->battleState;
+    if (clone->playerTeam == NULL || clone->opponentTeam == NULL ||
+        !restoreBattleSnapshot(clone, &snapshot)) {
+        freeBattleContextClone(clone);
+        return NULL;
+    }
+    return clone;
+}
+
+void freeBattleContextClone(BattleContext* clone) {
+    if (clone == NULL) {
+        return;
+    }
+
+    freeMonsterList(clone->playerTeam);
+    freeMonsterList(clone->opponentTeam);
+    freeBattleContext(clone);
+}
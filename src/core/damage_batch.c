@@ -0,0 +1,295 @@
+/**
+ * PokeBattle - Dano em lote
+ *
+ * O dano de uma variação r é floor(N * r / D), com N e D inteiros montados
+ * como em calculateDamageWithRoll. Nas versões SIMD a conta é feita em
+ * double (todos os valores cabem exatos em 53 bits): o quociente vem de uma
+ * multiplicação pelo inverso de D e é corrigido em no máximo uma unidade
+ * comparando q * D com N, então o resultado continua exato.
+ */
+
+#include <stddef.h>
+#include "damage_batch.h"
+#include "monster_data.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define DAMAGE_BATCH_X86 1
+    #include <immintrin.h>
+#endif
+
+// Denominador comum sem a defesa e sem o STAB: 50 * ponto fixo do tipo * 100%
+#define DAMAGE_BATCH_DENOMINATOR (50.0 * DAMAGE_FIXED_ONE * 100.0)
+
+static DamageKernel selectedKernel = DAMAGE_KERNEL_AUTO;
+
+static const char* kernelNames[DAMAGE_KERNEL_COUNT] = {"auto", "scalar", "sse4.1", "avx2"};
+
+int addDamageBatchMoves(DamageMoveBatch* moves, const PokeMonster* attacker) {
+    if (moves == NULL || attacker == NULL) {
+        return 0;
+    }
+
+    int added = 0;
+    for (int i = 0; i < 4 && moves->count < DAMAGE_BATCH_MAX; i++) {
+        const Attack* attack = &attacker->attacks[i];
+        int slot = moves->count++;
+        moves->power[slot] = attack->power;
+        moves->attack[slot] = attacker->attack;
+        moves->type[slot] = attack->type;
+        moves->stab[slot] = (attack->type == attacker->type1 || attack->type == attacker->type2) ? 1 : 0;
+        added++;
+    }
+    return added;
+}
+
+bool addDamageBatchDefender(DamageDefenderBatch* defenders, const PokeMonster* defender) {
+    if (defenders == NULL || defender == NULL || defenders->count >= DAMAGE_BATCH_MAX) {
+        return false;
+    }
+
+    int slot = defenders->count++;
+    defenders->defense[slot] = defender->defense;
+    defenders->type1[slot] = defender->type1;
+    defenders->type2[slot] = defender->type2;
+    return true;
+}
+
+// Multiplicadores de tipo do golpe contra cada defensor (ponto fixo)
+static void fillTypeMultipliers(const DamageDefenderBatch* defenders, int moveType, double* multipliers) {
+    for (int d = 0; d < defenders->count; d++) {
+        multipliers[d] = calculateTypeEffectivenessFixed((MonsterType)moveType,
+                                                         (MonsterType)defenders->type1[d],
+                                                         (MonsterType)defenders->type2[d]);
+    }
+}
+
+static void clearMoveRow(DamageBatchResult* result, int move, int defenderCount) {
+    for (int d = 0; d < defenderCount; d++) {
+        result->minDamage[move][d] = 0;
+        result->maxDamage[move][d] = 0;
+        result->expectedDamage[move][d] = 0.0f;
+    }
+}
+
+// Uma combinação golpe x defensor, só com inteiros (também usada nas sobras
+// das versões SIMD)
+static void computeDamagePair(const DamageMoveBatch* moves, const DamageDefenderBatch* defenders,
+                              int m, int d, int64_t typeMultiplier, DamageBatchResult* result) {
+    int64_t defense = defenders->defense[d] > 0 ? defenders->defense[d] : 1;
+    int64_t numerator = ((int64_t)moves->power[m] * moves->attack[m] + 250 * defense) * typeMultiplier;
+    int64_t denominator = 50 * defense * DAMAGE_FIXED_ONE * 100;
+    if (moves->stab[m]) {
+        numerator *= 3;
+        denominator *= 2;
+    }
+
+    int sum = 0;
+    for (int r = 85; r <= 100; r++) {
+        int damage = (int)(numerator * r / denominator);
+        if (damage < 1) damage = 1;
+        if (r == 85) result->minDamage[m][d] = damage;
+        if (r == 100) result->maxDamage[m][d] = damage;
+        sum += damage;
+    }
+    result->expectedDamage[m][d] = sum / 16.0f;
+}
+
+static void computeDamageBatchScalar(const DamageMoveBatch* moves, const DamageDefenderBatch* defenders,
+                                     DamageBatchResult* result) {
+    double multipliers[DAMAGE_BATCH_MAX];
+
+    for (int m = 0; m < moves->count; m++) {
+        if (moves->power[m] == 0) {
+            clearMoveRow(result, m, defenders->count);
+            continue;
+        }
+
+        fillTypeMultipliers(defenders, moves->type[m], multipliers);
+        for (int d = 0; d < defenders->count; d++) {
+            computeDamagePair(moves, defenders, m, d, (int64_t)multipliers[d], result);
+        }
+    }
+}
+
+#ifdef DAMAGE_BATCH_X86
+
+__attribute__((target("avx2")))
+static void computeDamageBatchAvx2(const DamageMoveBatch* moves, const DamageDefenderBatch* defenders,
+                                   DamageBatchResult* result) {
+    double multipliers[DAMAGE_BATCH_MAX];
+    const __m256d one = _mm256_set1_pd(1.0);
+
+    for (int m = 0; m < moves->count; m++) {
+        if (moves->power[m] == 0) {
+            clearMoveRow(result, m, defenders->count);
+            continue;
+        }
+
+        fillTypeMultipliers(defenders, moves->type[m], multipliers);
+
+        double stabNumerator = moves->stab[m] ? 3.0 : 1.0;
+        double stabDenominator = moves->stab[m] ? 2.0 : 1.0;
+        __m256d powerTimesAttack = _mm256_set1_pd((double)moves->power[m] * moves->attack[m]);
+        __m256d numeratorScale = _mm256_set1_pd(stabNumerator);
+        __m256d denominatorScale = _mm256_set1_pd(DAMAGE_BATCH_DENOMINATOR * stabDenominator);
+
+        int d = 0;
+        for (; d + 4 <= defenders->count; d += 4) {
+            __m256d defense = _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i*)&defenders->defense[d]));
+            defense = _mm256_max_pd(defense, one);
+
+            __m256d numerator = _mm256_add_pd(powerTimesAttack, _mm256_mul_pd(defense, _mm256_set1_pd(250.0)));
+            numerator = _mm256_mul_pd(numerator, _mm256_loadu_pd(&multipliers[d]));
+            numerator = _mm256_mul_pd(numerator, numeratorScale);
+            __m256d denominator = _mm256_mul_pd(defense, denominatorScale);
+            __m256d inverse = _mm256_div_pd(one, denominator);
+
+            __m256d sum = _mm256_setzero_pd();
+            __m256d minimum = one, maximum = one;
+            for (int r = 85; r <= 100; r++) {
+                __m256d value = _mm256_mul_pd(numerator, _mm256_set1_pd((double)r));
+                __m256d q = _mm256_floor_pd(_mm256_mul_pd(value, inverse));
+
+                // Corrigir o arredondamento do inverso: q * D <= N < (q + 1) * D
+                __m256d next = _mm256_add_pd(q, one);
+                q = _mm256_add_pd(q, _mm256_and_pd(_mm256_cmp_pd(_mm256_mul_pd(next, denominator), value, _CMP_LE_OQ), one));
+                q = _mm256_sub_pd(q, _mm256_and_pd(_mm256_cmp_pd(_mm256_mul_pd(q, denominator), value, _CMP_GT_OQ), one));
+
+                q = _mm256_max_pd(q, one);
+                if (r == 85) minimum = q;
+                if (r == 100) maximum = q;
+                sum = _mm256_add_pd(sum, q);
+            }
+
+            _mm_storeu_si128((__m128i*)&result->minDamage[m][d], _mm256_cvtpd_epi32(minimum));
+            _mm_storeu_si128((__m128i*)&result->maxDamage[m][d], _mm256_cvtpd_epi32(maximum));
+            _mm_storeu_ps(&result->expectedDamage[m][d], _mm256_cvtpd_ps(_mm256_mul_pd(sum, _mm256_set1_pd(1.0 / 16.0))));
+        }
+
+        for (; d < defenders->count; d++) {
+            computeDamagePair(moves, defenders, m, d, (int64_t)multipliers[d], result);
+        }
+    }
+}
+
+__attribute__((target("sse4.1")))
+static void computeDamageBatchSse41(const DamageMoveBatch* moves, const DamageDefenderBatch* defenders,
+                                    DamageBatchResult* result) {
+    double multipliers[DAMAGE_BATCH_MAX];
+    const __m128d one = _mm_set1_pd(1.0);
+
+    for (int m = 0; m < moves->count; m++) {
+        if (moves->power[m] == 0) {
+            clearMoveRow(result, m, defenders->count);
+            continue;
+        }
+
+        fillTypeMultipliers(defenders, moves->type[m], multipliers);
+
+        double stabNumerator = moves->stab[m] ? 3.0 : 1.0;
+        double stabDenominator = moves->stab[m] ? 2.0 : 1.0;
+        __m128d powerTimesAttack = _mm_set1_pd((double)moves->power[m] * moves->attack[m]);
+        __m128d numeratorScale = _mm_set1_pd(stabNumerator);
+        __m128d denominatorScale = _mm_set1_pd(DAMAGE_BATCH_DENOMINATOR * stabDenominator);
+
+        int d = 0;
+        for (; d + 2 <= defenders->count; d += 2) {
+            __m128d defense = _mm_cvtepi32_pd(_mm_loadl_epi64((const __m128i*)&defenders->defense[d]));
+            defense = _mm_max_pd(defense, one);
+
+            __m128d numerator = _mm_add_pd(powerTimesAttack, _mm_mul_pd(defense, _mm_set1_pd(250.0)));
+            numerator = _mm_mul_pd(numerator, _mm_loadu_pd(&multipliers[d]));
+            numerator = _mm_mul_pd(numerator, numeratorScale);
+            __m128d denominator = _mm_mul_pd(defense, denominatorScale);
+            __m128d inverse = _mm_div_pd(one, denominator);
+
+            __m128d sum = _mm_setzero_pd();
+            __m128d minimum = one, maximum = one;
+            for (int r = 85; r <= 100; r++) {
+                __m128d value = _mm_mul_pd(numerator, _mm_set1_pd((double)r));
+                __m128d q = _mm_floor_pd(_mm_mul_pd(value, inverse));
+
+                __m128d next = _mm_add_pd(q, one);
+                q = _mm_add_pd(q, _mm_and_pd(_mm_cmple_pd(_mm_mul_pd(next, denominator), value), one));
+                q = _mm_sub_pd(q, _mm_and_pd(_mm_cmpgt_pd(_mm_mul_pd(q, denominator), value), one));
+
+                q = _mm_max_pd(q, one);
+                if (r == 85) minimum = q;
+                if (r == 100) maximum = q;
+                sum = _mm_add_pd(sum, q);
+            }
+
+            _mm_storel_epi64((__m128i*)&result->minDamage[m][d], _mm_cvtpd_epi32(minimum));
+            _mm_storel_epi64((__m128i*)&result->maxDamage[m][d], _mm_cvtpd_epi32(maximum));
+            __m128 expected = _mm_cvtpd_ps(_mm_mul_pd(sum, _mm_set1_pd(1.0 / 16.0)));
+            _mm_storel_pi((__m64*)&result->expectedDamage[m][d], expected);
+        }
+
+        for (; d < defenders->count; d++) {
+            computeDamagePair(moves, defenders, m, d, (int64_t)multipliers[d], result);
+        }
+    }
+}
+
+#endif // DAMAGE_BATCH_X86
+
+bool isDamageKernelSupported(DamageKernel kernel) {
+    switch (kernel) {
+        case DAMAGE_KERNEL_AUTO:
+        case DAMAGE_KERNEL_SCALAR:
+            return true;
+#ifdef DAMAGE_BATCH_X86
+        case DAMAGE_KERNEL_SSE41:
+            return __builtin_cpu_supports("sse4.1");
+        case DAMAGE_KERNEL_AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+DamageKernel getDamageBatchKernel(void) {
+    if (selectedKernel != DAMAGE_KERNEL_AUTO) {
+        return selectedKernel;
+    }
+    if (isDamageKernelSupported(DAMAGE_KERNEL_AVX2)) return DAMAGE_KERNEL_AVX2;
+    if (isDamageKernelSupported(DAMAGE_KERNEL_SSE41)) return DAMAGE_KERNEL_SSE41;
+    return DAMAGE_KERNEL_SCALAR;
+}
+
+bool setDamageBatchKernel(DamageKernel kernel) {
+    if (kernel < 0 || kernel >= DAMAGE_KERNEL_COUNT || !isDamageKernelSupported(kernel)) {
+        return false;
+    }
+    selectedKernel = kernel;
+    return true;
+}
+
+const char* getDamageKernelName(DamageKernel kernel) {
+    if (kernel < 0 || kernel >= DAMAGE_KERNEL_COUNT) {
+        return "?";
+    }
+    return kernelNames[kernel];
+}
+
+void computeDamageBatch(const DamageMoveBatch* moves, const DamageDefenderBatch* defenders,
+                        DamageBatchResult* result) {
+    if (moves == NULL || defenders == NULL || result == NULL) {
+        return;
+    }
+
+    switch (getDamageBatchKernel()) {
+#ifdef DAMAGE_BATCH_X86
+        case DAMAGE_KERNEL_AVX2:
+            computeDamageBatchAvx2(moves, defenders, result);
+            break;
+        case DAMAGE_KERNEL_SSE41:
+            computeDamageBatchSse41(moves, defenders, result);
+            break;
+#endif
+        default:
+            computeDamageBatchScalar(moves, defenders, result);
+            break;
+    }
+}
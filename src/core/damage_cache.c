@@ -0,0 +1,130 @@
+/**
+ * PokeBattle - Distribuição exata de dano por confronto
+ */
+
+#include <string.h>
+#include "damage_cache.h"
+
+static void fillDistribution(DamageDistribution* distribution, const PokeMonster* attacker,
+                             const PokeMonster* defender, const Attack* attack) {
+    memset(distribution, 0, sizeof(DamageDistribution));
+    distribution->attackStat = (int16_t)attacker->attack;
+    distribution->defenseStat = (int16_t)defender->defense;
+    distribution->accuracy = (uint8_t)(attack->accuracy < 0 ? 0 : (attack->accuracy > 100 ? 100 : attack->accuracy));
+    distribution->hasDamage = attack->power > 0;
+    if (!distribution->hasDamage) {
+        return;
+    }
+
+    // calculateDamageWithRoll só cresce com a variação: as entradas já saem em ordem
+    for (int roll = 0; roll < DAMAGE_ROLLS; roll++) {
+        int damage = calculateDamageWithRoll(attacker, defender, attack, 85 + roll);
+        distribution->rolls[roll] = (uint16_t)(damage > UINT16_MAX ? UINT16_MAX : damage);
+    }
+}
+
+static int memberIndex(const DamageCache* cache, int side, const PokeMonster* monster) {
+    for (int i = 0; i < cache->counts[side]; i++) {
+        if (cache->members[side][i] == monster) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void buildDamageCache(DamageCache* cache, BattleContext* ctx) {
+    memset(cache, 0, sizeof(DamageCache));
+    if (ctx == NULL) {
+        return;
+    }
+
+    for (int side = 0; side < 2; side++) {
+        MonsterList* team = side == 0 ? ctx->playerTeam : ctx->opponentTeam;
+        for (PokeMonster* current = team ? team->first : NULL;
+             current != NULL && cache->counts[side] < DAMAGE_CACHE_MAX_TEAM; current = current->next) {
+            cache->members[side][cache->counts[side]++] = current;
+        }
+    }
+
+    for (int side = 0; side < 2; side++) {
+        for (int a = 0; a < cache->counts[side]; a++) {
+            for (int d = 0; d < cache->counts[1 - side]; d++) {
+                PokeMonster* attacker = cache->members[side][a];
+                PokeMonster* defender = cache->members[1 - side][d];
+                for (int m = 0; m < 4; m++) {
+                    fillDistribution(&cache->entries[side][a][d][m], attacker, defender, &attacker->attacks[m]);
+                }
+            }
+        }
+    }
+}
+
+const DamageDistribution* getDamageDistribution(DamageCache* cache, const PokeMonster* attacker,
+                                                const PokeMonster* defender, int attackIndex) {
+    if (cache == NULL || attacker == NULL || defender == NULL || attackIndex < 0 || attackIndex >= 4) {
+        return NULL;
+    }
+
+    int side = 0;
+    int a = memberIndex(cache, 0, attacker);
+    if (a < 0) {
+        side = 1;
+        a = memberIndex(cache, 1, attacker);
+    }
+    int d = a >= 0 ? memberIndex(cache, 1 - side, defender) : -1;
+    if (d < 0) {
+        return NULL;
+    }
+
+    // Só um status que mexe em ataque ou defesa invalida a entrada
+    DamageDistribution* distribution = &cache->entries[side][a][d][attackIndex];
+    if (distribution->attackStat != attacker->attack || distribution->defenseStat != defender->defense) {
+        fillDistribution(distribution, attacker, defender, &attacker->attacks[attackIndex]);
+        cache->refreshes++;
+    }
+    cache->lookups++;
+    return distribution;
+}
+
+double getDamageChanceAtLeast(const DamageDistribution* distribution, int damage) {
+    if (distribution == NULL) {
+        return 0.0;
+    }
+    if (damage <= 0) {
+        return 1.0;
+    }
+    if (!distribution->hasDamage) {
+        return 0.0;
+    }
+
+    int normal = 0, critical = 0;
+    for (int roll = 0; roll < DAMAGE_ROLLS; roll++) {
+        if (distribution->rolls[roll] >= damage) normal++;
+        if (distribution->rolls[roll] * 3 / 2 >= damage) critical++;
+    }
+    return distribution->accuracy / 100.0 * (0.95 * normal + 0.05 * critical) / DAMAGE_ROLLS;
+}
+
+double getExpectedDamage(const DamageDistribution* distribution) {
+    if (distribution == NULL || !distribution->hasDamage) {
+        return 0.0;
+    }
+
+    double total = 0.0;
+    for (int roll = 0; roll < DAMAGE_ROLLS; roll++) {
+        total += 0.95 * distribution->rolls[roll] + 0.05 * (distribution->rolls[roll] * 3 / 2);
+    }
+    return distribution->accuracy / 100.0 * total / DAMAGE_ROLLS;
+}
+
+double getKoProbability(DamageCache* cache, const PokeMonster* attacker, const PokeMonster* defender,
+                        int attackIndex) {
+    const DamageDistribution* distribution = getDamageDistribution(cache, attacker, defender, attackIndex);
+    if (distribution == NULL || attacker->attacks[attackIndex].ppCurrent <= 0 ||
+        attacker->statusCondition == STATUS_SLEEPING || defender->hp <= 0) {
+        return 0.0;
+    }
+
+    double chance = getDamageChanceAtLeast(distribution, defender->hp);
+    return attacker->statusCondition == STATUS_PARALYZED ? chance * 0.75 : chance;
+}
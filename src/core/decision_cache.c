@@ -0,0 +1,378 @@
+/**
+ * PokeBattle - Cache persistente de decisões da IA
+ *
+ * Formato do arquivo (little-endian, como a máquina que gravou):
+ *   DecisionCacheHeader
+ *   DecisionCacheEntry slots[1 << log2Slots]
+ * Chave 0 marca entrada vazia. Uma chave procura em até
+ * DECISION_CACHE_PROBES entradas seguidas a partir de key & (slots - 1);
+ * cheias todas, a gravação substitui a mais antiga.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "decision_cache.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define DECISION_CACHE_MAGIC "PBDC"
+#define DECISION_CACHE_VERSION 1
+#define DECISION_CACHE_PROBES 8
+#define DECISION_CACHE_MIN_LOG2 8
+#define DECISION_CACHE_MAX_LOG2 24
+
+// Faixas de HP em campo e no banco
+#define DECISION_CACHE_HP_BUCKETS 8
+#define DECISION_CACHE_BENCH_HP_BUCKETS 4
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t log2Slots;
+    uint32_t reserved;
+    uint64_t totalHits;
+    uint64_t totalMisses;
+} DecisionCacheHeader;
+
+typedef struct {
+    uint64_t key;
+    int64_t storedAt;       // Segundos desde a época
+    uint32_t hits;          // Desde a última gravação
+    int8_t action;
+    int8_t attackIndex;
+    int8_t switchIndex;
+    uint8_t reserved;
+} DecisionCacheEntry;
+
+struct DecisionCache {
+    uint8_t* base;
+    size_t size;
+    DecisionCacheHeader* header;
+    DecisionCacheEntry* entries;
+    uint64_t mask;
+    DecisionCacheConfig config;
+    DecisionCacheStats stats;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+};
+
+static size_t getCacheFileSize(int log2Slots) {
+    return sizeof(DecisionCacheHeader) + ((size_t)1 << log2Slots) * sizeof(DecisionCacheEntry);
+}
+
+// Arquivo deste formato e com o tamanho que o cabeçalho diz
+static bool isValidCacheFile(const DecisionCacheHeader* header, size_t fileSize) {
+    return memcmp(header->magic, DECISION_CACHE_MAGIC, 4) == 0 &&
+           header->version == DECISION_CACHE_VERSION &&
+           header->log2Slots >= DECISION_CACHE_MIN_LOG2 && header->log2Slots <= DECISION_CACHE_MAX_LOG2 &&
+           fileSize == getCacheFileSize((int)header->log2Slots);
+}
+
+static void unmapCache(DecisionCache* cache) {
+#ifdef _WIN32
+    if (cache->base != NULL) {
+        FlushViewOfFile(cache->base, 0);
+        UnmapViewOfFile(cache->base);
+    }
+    if (cache->mapping != NULL) CloseHandle(cache->mapping);
+    if (cache->file != INVALID_HANDLE_VALUE) CloseHandle(cache->file);
+#else
+    if (cache->base != NULL) {
+        msync(cache->base, cache->size, MS_SYNC);
+        munmap(cache->base, cache->size);
+    }
+#endif
+    cache->base = NULL;
+}
+
+// Mapeia o arquivo para leitura e escrita. Se ele não existe ou não é deste
+// formato, é recriado vazio com o tamanho da configuração
+static bool mapCache(DecisionCache* cache, const char* path, int log2Slots) {
+    bool fresh = false;
+#ifdef _WIN32
+    cache->mapping = NULL;
+    cache->file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, OPEN_ALWAYS,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (cache->file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    // Lê o cabeçalho para decidir se o arquivo serve
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(cache->file, &size)) {
+        return false;
+    }
+    DecisionCacheHeader header;
+    DWORD got = 0;
+    memset(&header, 0, sizeof(header));
+    ReadFile(cache->file, &header, sizeof(header), &got, NULL);
+    cache->size = (size_t)size.QuadPart;
+    if (got != sizeof(header) || !isValidCacheFile(&header, cache->size)) {
+        cache->size = getCacheFileSize(log2Slots);
+        LARGE_INTEGER end;
+        end.QuadPart = (LONGLONG)cache->size;
+        if (!SetFilePointerEx(cache->file, end, NULL, FILE_BEGIN) || !SetEndOfFile(cache->file)) {
+            return false;
+        }
+        fresh = true;
+    }
+
+    cache->mapping = CreateFileMappingA(cache->file, NULL, PAGE_READWRITE, 0, 0, NULL);
+    if (cache->mapping == NULL) {
+        return false;
+    }
+    cache->base = (uint8_t*)MapViewOfFile(cache->mapping, FILE_MAP_WRITE, 0, 0, 0);
+    if (cache->base == NULL) {
+        return false;
+    }
+#else
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return false;
+    }
+
+    DecisionCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    bool valid = info.st_size >= (off_t)sizeof(header) &&
+                 pread(fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header) &&
+                 isValidCacheFile(&header, (size_t)info.st_size);
+    if (valid) {
+        cache->size = (size_t)info.st_size;
+    } else {
+        // Truncar antes zera o conteúdo antigo
+        cache->size = getCacheFileSize(log2Slots);
+        if (ftruncate(fd, 0) != 0 || ftruncate(fd, (off_t)cache->size) != 0) {
+            close(fd);
+            return false;
+        }
+        fresh = true;
+    }
+
+    void* base = mmap(NULL, cache->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+    cache->base = (uint8_t*)base;
+#endif
+
+    cache->header = (DecisionCacheHeader*)cache->base;
+    if (fresh) {
+        memset(cache->base, 0, cache->size);
+        memcpy(cache->header->magic, DECISION_CACHE_MAGIC, 4);
+        cache->header->version = DECISION_CACHE_VERSION;
+        cache->header->log2Slots = (uint32_t)log2Slots;
+    }
+    return true;
+}
+
+DecisionCache* openDecisionCache(const char* path, const DecisionCacheConfig* config) {
+    if (path == NULL || config == NULL || config->policy == DECISION_CACHE_OFF) {
+        return NULL;
+    }
+
+    DecisionCache* cache = (DecisionCache*)calloc(1, sizeof(DecisionCache));
+    if (cache == NULL) {
+        return NULL;
+    }
+#ifdef _WIN32
+    cache->file = INVALID_HANDLE_VALUE;
+#endif
+    cache->config = *config;
+
+    int log2Slots = config->log2Slots;
+    if (log2Slots < DECISION_CACHE_MIN_LOG2) log2Slots = DECISION_CACHE_MIN_LOG2;
+    if (log2Slots > DECISION_CACHE_MAX_LOG2) log2Slots = DECISION_CACHE_MAX_LOG2;
+
+    if (!mapCache(cache, path, log2Slots)) {
+        printf("ERRO: não foi possível abrir o cache de decisões %s\n", path);
+        unmapCache(cache);
+        free(cache);
+        return NULL;
+    }
+
+    cache->entries = (DecisionCacheEntry*)(cache->base + sizeof(DecisionCacheHeader));
+    cache->stats.capacity = 1L << cache->header->log2Slots;
+    cache->mask = (uint64_t)cache->stats.capacity - 1;
+    for (long i = 0; i < cache->stats.capacity; i++) {
+        if (cache->entries[i].key != 0) {
+            cache->stats.entries++;
+        }
+    }
+    return cache;
+}
+
+void closeDecisionCache(DecisionCache* cache) {
+    if (cache == NULL) {
+        return;
+    }
+    unmapCache(cache);
+    free(cache);
+}
+
+static uint64_t hashBytes(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;   // FNV-1a
+    }
+    return hash;
+}
+
+// Faixa de HP: 0 só para desmaiado, depois 1..buckets
+static uint8_t getHpBucket(const PokeMonster* monster, int buckets) {
+    if (monster->hp <= 0 || monster->maxHp <= 0) {
+        return 0;
+    }
+    int bucket = (monster->hp * buckets + monster->maxHp - 1) / monster->maxHp;
+    return (uint8_t)(bucket < 1 ? 1 : (bucket > buckets ? buckets : bucket));
+}
+
+// A espécie vai pelo nome, que não muda com a ordem do banco
+static uint64_t hashSpecies(uint64_t hash, const PokeMonster* monster) {
+    return hashBytes(hash, monster->name, strlen(monster->name) + 1);
+}
+
+uint64_t getDecisionCacheKey(const BattleContext* ctx, bool isPlayerSide) {
+    const MonsterList* team = isPlayerSide ? ctx->playerTeam : ctx->opponentTeam;
+    const MonsterList* foeTeam = isPlayerSide ? ctx->opponentTeam : ctx->playerTeam;
+    const PokeMonster* self = team->current;
+    const PokeMonster* foe = foeTeam->current;
+
+    uint64_t hash = 1469598103934665603ULL;
+    hash = hashSpecies(hash, self);
+    hash = hashSpecies(hash, foe);
+
+    // Em campo: HP, status e PP (0, 1, 2 ou mais; só o fim dos PP muda a jogada)
+    uint8_t field[10];
+    field[0] = getHpBucket(self, DECISION_CACHE_HP_BUCKETS);
+    field[1] = getHpBucket(foe, DECISION_CACHE_HP_BUCKETS);
+    field[2] = (uint8_t)self->statusCondition;
+    field[3] = (uint8_t)foe->statusCondition;
+    for (int i = 0; i < 4; i++) {
+        int pp = self->attacks[i].ppCurrent;
+        field[4 + i] = (uint8_t)(pp < 0 ? 0 : (pp > 2 ? 2 : pp));
+    }
+
+    // Itens que o lado ainda pode usar
+    bool potionUsed = isPlayerSide ? ctx->playerPotionUsed : ctx->botPotionUsed;
+    bool randomItemUsed = isPlayerSide ? ctx->playerRandomItemUsed : ctx->botRandomItemUsed;
+    field[8] = (uint8_t)((potionUsed ? 1 : 0) | (randomItemUsed ? 2 : 0));
+    field[9] = (uint8_t)ctx->itemType;
+    hash = hashBytes(hash, field, sizeof(field));
+
+    // Banco por posição (a troca guardada é uma posição): espécie e HP em faixas
+    int index = 0;
+    for (const PokeMonster* monster = team->first; monster != NULL; monster = monster->next, index++) {
+        if (monster == self) {
+            uint8_t marker = 0xFF;
+            hash = hashBytes(hash, &marker, 1);
+            continue;
+        }
+        uint8_t bucket = getHpBucket(monster, DECISION_CACHE_BENCH_HP_BUCKETS);
+        hash = hashSpecies(hash, monster);
+        hash = hashBytes(hash, &bucket, 1);
+    }
+
+    return hash != 0 ? hash : 1;
+}
+
+static bool isEntryExpired(const DecisionCache* cache, const DecisionCacheEntry* entry, int64_t now) {
+    return cache->config.ttlSeconds > 0 && now - entry->storedAt > cache->config.ttlSeconds;
+}
+
+bool lookupDecisionCache(DecisionCache* cache, uint64_t key, CachedDecision* decision) {
+    if (cache == NULL || cache->config.policy != DECISION_CACHE_READ_WRITE) {
+        return false;
+    }
+
+    int64_t now = (int64_t)time(NULL);
+    for (int probe = 0; probe < DECISION_CACHE_PROBES; probe++) {
+        DecisionCacheEntry* entry = &cache->entries[(key + probe) & cache->mask];
+        if (entry->key == 0) {
+            break;
+        }
+        if (entry->key != key) {
+            continue;
+        }
+
+        if (isEntryExpired(cache, entry, now)) {
+            cache->stats.expired++;
+            break;
+        }
+
+        entry->hits++;
+        if (cache->config.refreshEvery > 0 && entry->hits % (uint32_t)cache->config.refreshEvery == 0) {
+            cache->stats.refreshes++;
+            break;
+        }
+
+        decision->action = entry->action;
+        decision->attackIndex = entry->attackIndex;
+        decision->switchIndex = entry->switchIndex;
+        cache->stats.hits++;
+        cache->header->totalHits++;
+        return true;
+    }
+
+    cache->stats.misses++;
+    cache->header->totalMisses++;
+    return false;
+}
+
+void storeDecisionCache(DecisionCache* cache, uint64_t key, const CachedDecision* decision) {
+    if (cache == NULL || cache->config.policy == DECISION_CACHE_OFF || key == 0) {
+        return;
+    }
+
+    // A própria chave, uma entrada vazia ou, sem nenhuma das duas, a mais antiga
+    DecisionCacheEntry* target = NULL;
+    for (int probe = 0; probe < DECISION_CACHE_PROBES; probe++) {
+        DecisionCacheEntry* entry = &cache->entries[(key + probe) & cache->mask];
+        if (entry->key == key || entry->key == 0) {
+            target = entry;
+            break;
+        }
+        if (target == NULL || entry->storedAt < target->storedAt) {
+            target = entry;
+        }
+    }
+
+    if (target->key == 0) {
+        cache->stats.entries++;
+    }
+    target->key = key;
+    target->storedAt = (int64_t)time(NULL);
+    target->hits = 0;
+    target->action = (int8_t)decision->action;
+    target->attackIndex = (int8_t)decision->attackIndex;
+    target->switchIndex = (int8_t)decision->switchIndex;
+    cache->stats.stores++;
+}
+
+DecisionCacheStats getDecisionCacheStats(const DecisionCache* cache) {
+    DecisionCacheStats stats;
+    memset(&stats, 0, sizeof(stats));
+    if (cache == NULL) {
+        return stats;
+    }
+    stats = cache->stats;
+    stats.totalHits = (long)cache->header->totalHits;
+    stats.totalMisses = (long)cache->header->totalMisses;
+    return stats;
+}
@@ -0,0 +1,569 @@
+/**
+ * PokeBattle - Tabela de finais 1x1
+ *
+ * Formato do arquivo (little-endian, como a máquina que gerou):
+ *   EndgameHeader
+ *   int16_t  maxHp[n]              (completado até múltiplo de 8 bytes)
+ *   uint64_t offsets[n * n]        primeira entrada de cada par (meu, dele)
+ *   uint16_t entries[...]          por par: [meu HP - 1][HP dele - 1]
+ * Cada entrada: bits 2-15 chance de vitória (0..16383), bits 0-1 ataque.
+ *
+ * Programação dinâmica de um par: V(a, b) é a chance de vitória com HP a
+ * contra b. Um turno só diminui HP, então V(a, b) depende de estados com
+ * HP menor ou igual; a linha a é feita da esquerda para a direita. Quando
+ * os dois ataques não causam dano o estado se repete (V aparece dos dois
+ * lados), resolvido por iteração.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "endgame_table.h"
+#include "monster_data.h"
+#include "work_pool.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define ENDGAME_MAGIC "PBEG"
+#define ENDGAME_VERSION 1
+#define ENDGAME_PROBABILITY_MAX 16383
+
+// Resultados distintos de um ataque: 16 variações, com e sem crítico, e o erro
+#define ENDGAME_MAX_OUTCOMES 33
+
+// Iterações do estado que se repete (converge rápido: a chance de repetir
+// é a de os dois errarem)
+#define ENDGAME_LOOP_ITERATIONS 200
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t monsterCount;
+    uint32_t reserved;
+    uint64_t fingerprint;
+} EndgameHeader;
+
+struct EndgameTable {
+    const uint8_t* base;
+    size_t size;
+    int count;
+    const int16_t* maxHp;
+    const uint64_t* offsets;
+    const uint16_t* entries;
+    uint64_t entryCount;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+};
+
+// Dano de um ataque contra um defensor: valores distintos > 0 e a chance
+// de não causar dano (erro ou ataque de status)
+typedef struct {
+    int count;
+    int damage[ENDGAME_MAX_OUTCOMES];
+    double probability[ENDGAME_MAX_OUTCOMES];
+    double noDamage;
+} DamageOutcomes;
+
+// Impressão digital do banco: nomes, tipos, atributos e ataques
+static uint64_t databaseFingerprint(void) {
+    uint64_t hash = 1469598103934665603ULL;   // FNV-1a
+    for (int i = 0; i < monsterDB.count; i++) {
+        const PokeMonster* monster = &monsterDB.monsters[i];
+        int values[6 + 4 * 3] = {
+            monster->type1, monster->type2, monster->maxHp,
+            monster->attack, monster->defense, monster->speed
+        };
+        for (int a = 0; a < 4; a++) {
+            values[6 + a * 3] = monster->attacks[a].type;
+            values[7 + a * 3] = monster->attacks[a].power;
+            values[8 + a * 3] = monster->attacks[a].accuracy;
+        }
+
+        for (const char* c = monster->name; *c != '\0'; c++) {
+            hash = (hash ^ (uint8_t)*c) * 1099511628211ULL;
+        }
+        for (size_t v = 0; v < sizeof(values) / sizeof(values[0]); v++) {
+            hash = (hash ^ (uint32_t)values[v]) * 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+static void addOutcome(DamageOutcomes* outcomes, int damage, double probability) {
+    for (int i = 0; i < outcomes->count; i++) {
+        if (outcomes->damage[i] == damage) {
+            outcomes->probability[i] += probability;
+            return;
+        }
+    }
+    outcomes->damage[outcomes->count] = damage;
+    outcomes->probability[outcomes->count] = probability;
+    outcomes->count++;
+}
+
+// Mesmos sorteios de executeAttack: acerto, variação de 85 a 100% e 5% de crítico
+static void buildDamageOutcomes(const PokeMonster* attacker, const PokeMonster* defender,
+                                const Attack* attack, DamageOutcomes* outcomes) {
+    memset(outcomes, 0, sizeof(DamageOutcomes));
+    int accuracy = attack->accuracy < 0 ? 0 : (attack->accuracy > 100 ? 100 : attack->accuracy);
+    double hit = accuracy / 100.0;
+
+    if (attack->power <= 0) {
+        outcomes->noDamage = 1.0;
+        return;
+    }
+
+    outcomes->noDamage = 1.0 - hit;
+    for (int roll = 0; roll < 16; roll++) {
+        int damage = calculateDamageWithRoll(attacker, defender, attack, 85 + roll);
+        addOutcome(outcomes, damage, hit * 0.95 / 16.0);
+        addOutcome(outcomes, damage * 3 / 2, hit * 0.05 / 16.0);
+    }
+}
+
+static int orderSpeed(const PokeMonster* monster) {
+    return monster->speed < 0x3FFF ? monster->speed : 0x3FFF;
+}
+
+static uint16_t packEntry(double probability, int attackIndex) {
+    if (probability < 0.0) probability = 0.0;
+    if (probability > 1.0) probability = 1.0;
+    int quantized = (int)(probability * ENDGAME_PROBABILITY_MAX + 0.5);
+    return (uint16_t)((quantized << 2) | (attackIndex & 0x3));
+}
+
+// Resolve o par (me contra foe) e escreve maxHp(me) * maxHp(foe) entradas
+static void solvePair(const PokeMonster* me, const PokeMonster* foe, float* scratch, uint16_t* out) {
+    DamageOutcomes mine[4], theirs[4];
+    for (int i = 0; i < 4; i++) {
+        buildDamageOutcomes(me, foe, &me->attacks[i], &mine[i]);
+        buildDamageOutcomes(foe, me, &foe->attacks[i], &theirs[i]);
+    }
+
+    int myMax = me->maxHp;
+    int foeMax = foe->maxHp;
+    int stride = foeMax + 1;
+    size_t plane = (size_t)(myMax + 1) * stride;
+
+    // V, depois U[i] (meu ataque i já resolvido) e W[j] (o dele)
+    float* value = scratch;
+    float* afterMine[4];
+    float* afterTheirs[4];
+    for (int i = 0; i < 4; i++) {
+        afterMine[i] = scratch + plane * (1 + i);
+        afterTheirs[i] = scratch + plane * (5 + i);
+    }
+
+    int mySpeed = orderSpeed(me), foeSpeed = orderSpeed(foe);
+    double meFirst = mySpeed > foeSpeed ? 1.0 : (mySpeed < foeSpeed ? 0.0 : 0.5);
+
+    for (int b = 0; b <= foeMax; b++) value[b] = 0.0f;
+    for (int a = 1; a <= myMax; a++) value[a * stride] = 1.0f;
+
+    for (int a = 1; a <= myMax; a++) {
+        for (int b = 1; b <= foeMax; b++) {
+            double minePart[4], theirsPart[4];
+            double reward[4][4], repeat[4][4];
+
+            // Só a parte com dano: o estado (a, b) ainda não tem valor
+            for (int i = 0; i < 4; i++) {
+                double sum = 0.0;
+                for (int k = 0; k < mine[i].count; k++) {
+                    int left = b - mine[i].damage[k];
+                    sum += mine[i].probability[k] * (left <= 0 ? 1.0 : value[a * stride + left]);
+                }
+                minePart[i] = sum;
+            }
+            for (int j = 0; j < 4; j++) {
+                double sum = 0.0;
+                for (int k = 0; k < theirs[j].count; k++) {
+                    int left = a - theirs[j].damage[k];
+                    sum += theirs[j].probability[k] * (left <= 0 ? 0.0 : value[left * stride + b]);
+                }
+                theirsPart[j] = sum;
+            }
+
+            for (int i = 0; i < 4; i++) {
+                for (int j = 0; j < 4; j++) {
+                    double r = 0.0;
+                    if (meFirst > 0.0) {
+                        // Eu ataco; se ele fica de pé, ele responde
+                        double first = mine[i].noDamage * theirsPart[j];
+                        for (int k = 0; k < mine[i].count; k++) {
+                            int left = b - mine[i].damage[k];
+                            first += mine[i].probability[k] * (left <= 0 ? 1.0 : afterTheirs[j][a * stride + left]);
+                        }
+                        r += meFirst * first;
+                    }
+                    if (meFirst < 1.0) {
+                        double second = theirs[j].noDamage * minePart[i];
+                        for (int k = 0; k < theirs[j].count; k++) {
+                            int left = a - theirs[j].damage[k];
+                            second += theirs[j].probability[k] * (left <= 0 ? 0.0 : afterMine[i][left * stride + b]);
+                        }
+                        r += (1.0 - meFirst) * second;
+                    }
+                    reward[i][j] = r;
+                    repeat[i][j] = mine[i].noDamage * theirs[j].noDamage;
+                }
+            }
+
+            // Melhor ataque contra a pior resposta; v aparece dos dois lados
+            double v = 0.5;
+            int best = 0;
+            for (int iteration = 0; iteration < ENDGAME_LOOP_ITERATIONS; iteration++) {
+                double next = -1.0;
+                for (int i = 0; i < 4; i++) {
+                    double worst = 2.0;
+                    for (int j = 0; j < 4; j++) {
+                        double m = reward[i][j] + repeat[i][j] * v;
+                        if (m < worst) worst = m;
+                    }
+                    if (worst > next) {
+                        next = worst;
+                        best = i;
+                    }
+                }
+                bool done = next - v < 1e-7 && v - next < 1e-7;
+                v = next;
+                if (done) break;
+            }
+
+            size_t index = (size_t)a * stride + b;
+            value[index] = (float)v;
+            for (int i = 0; i < 4; i++) {
+                afterMine[i][index] = (float)(minePart[i] + mine[i].noDamage * v);
+                afterTheirs[i][index] = (float)(theirsPart[i] + theirs[i].noDamage * v);
+            }
+            out[(size_t)(a - 1) * foeMax + (b - 1)] = packEntry(v, best);
+        }
+    }
+}
+
+typedef struct {
+    int monster;
+    const uint64_t* offsets;
+    uint16_t* entries;
+    int maxHp;                 // Maior HP do banco (tamanho do rascunho)
+    bool failed;
+} EndgameTask;
+
+// Uma tarefa por monstro: todos os confrontos dele
+static void solveMonsterTask(void* arg, int workerIndex) {
+    (void)workerIndex;
+    EndgameTask* task = (EndgameTask*)arg;
+    size_t plane = (size_t)(task->maxHp + 1) * (task->maxHp + 1);
+    float* scratch = (float*)malloc(plane * 9 * sizeof(float));
+    if (scratch == NULL) {
+        task->failed = true;
+        return;
+    }
+
+    int count = monsterDB.count;
+    for (int foe = 0; foe < count; foe++) {
+        solvePair(&monsterDB.monsters[task->monster], &monsterDB.monsters[foe], scratch,
+                  task->entries + task->offsets[task->monster * count + foe]);
+    }
+    free(scratch);
+}
+
+static size_t maxHpBytes(int count) {
+    return ((size_t)count * sizeof(int16_t) + 7) & ~(size_t)7;
+}
+
+bool buildEndgameTable(const char* path, int threads, EndgameBuildStats* stats) {
+    EndgameBuildStats local;
+    if (stats == NULL) stats = &local;
+    memset(stats, 0, sizeof(EndgameBuildStats));
+
+    int count = monsterDB.count;
+    if (count <= 0 || monsterDB.monsters == NULL) {
+        printf("ERRO: banco de monstros vazio\n");
+        return false;
+    }
+
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+
+    int16_t* maxHp = (int16_t*)calloc(1, maxHpBytes(count));
+    uint64_t* offsets = (uint64_t*)malloc((size_t)count * count * sizeof(uint64_t));
+    if (maxHp == NULL || offsets == NULL) {
+        free(maxHp);
+        free(offsets);
+        return false;
+    }
+
+    int largest = 1;
+    for (int i = 0; i < count; i++) {
+        int hp = monsterDB.monsters[i].maxHp;
+        if (hp <= 0 || hp > INT16_MAX) {
+            printf("ERRO: HP máximo inválido para %s: %d\n", monsterDB.monsters[i].name, hp);
+            free(maxHp);
+            free(offsets);
+            return false;
+        }
+        maxHp[i] = (int16_t)hp;
+        if (hp > largest) largest = hp;
+    }
+
+    uint64_t total = 0;
+    for (int i = 0; i < count; i++) {
+        for (int j = 0; j < count; j++) {
+            offsets[i * count + j] = total;
+            total += (uint64_t)maxHp[i] * maxHp[j];
+        }
+    }
+
+    uint16_t* entries = (uint16_t*)malloc(total * sizeof(uint16_t));
+    EndgameTask* tasks = (EndgameTask*)calloc(count, sizeof(EndgameTask));
+    if (entries == NULL || tasks == NULL) {
+        printf("ERRO: sem memória para a tabela de finais (%llu estados)\n", (unsigned long long)total);
+        free(maxHp);
+        free(offsets);
+        free(entries);
+        free(tasks);
+        return false;
+    }
+
+    WorkPool* pool = createWorkPool(threads);
+    for (int i = 0; i < count; i++) {
+        tasks[i] = (EndgameTask){ i, offsets, entries, largest, false };
+        if (pool != NULL) {
+            submitWorkTask(pool, solveMonsterTask, &tasks[i]);
+        } else {
+            solveMonsterTask(&tasks[i], 0);
+        }
+    }
+    if (pool != NULL) {
+        waitWorkPool(pool);
+        freeWorkPool(pool);
+    }
+
+    bool ok = true;
+    for (int i = 0; i < count; i++) {
+        ok = ok && !tasks[i].failed;
+    }
+
+    FILE* file = ok ? fopen(path, "wb") : NULL;
+    if (ok && file == NULL) {
+        printf("ERRO: não foi possível criar %s\n", path);
+        ok = false;
+    }
+    if (file != NULL) {
+        EndgameHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, ENDGAME_MAGIC, 4);
+        header.version = ENDGAME_VERSION;
+        header.monsterCount = (uint32_t)count;
+        header.fingerprint = databaseFingerprint();
+
+        ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+             fwrite(maxHp, maxHpBytes(count), 1, file) == 1 &&
+             fwrite(offsets, sizeof(uint64_t), (size_t)count * count, file) == (size_t)count * count &&
+             fwrite(entries, sizeof(uint16_t), total, file) == total;
+        if (fclose(file) != 0) ok = false;
+        if (!ok) printf("ERRO: falha ao gravar %s\n", path);
+    }
+
+    stats->pairs = (long)count * count;
+    stats->states = (long)total;
+    stats->fileBytes = sizeof(EndgameHeader) + maxHpBytes(count) +
+                       (size_t)count * count * sizeof(uint64_t) + total * sizeof(uint16_t);
+
+    struct timespec end;
+    timespec_get(&end, TIME_UTC);
+    stats->elapsedMs = (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+
+    free(maxHp);
+    free(offsets);
+    free(entries);
+    free(tasks);
+    return ok;
+}
+
+static void unmapTable(EndgameTable* table) {
+#ifdef _WIN32
+    if (table->base != NULL) UnmapViewOfFile(table->base);
+    if (table->mapping != NULL) CloseHandle(table->mapping);
+    if (table->file != INVALID_HANDLE_VALUE) CloseHandle(table->file);
+#else
+    if (table->base != NULL) munmap((void*)table->base, table->size);
+#endif
+}
+
+static bool mapTable(EndgameTable* table, const char* path) {
+#ifdef _WIN32
+    table->mapping = NULL;
+    table->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (table->file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(table->file, &size) || size.QuadPart == 0) {
+        return false;
+    }
+    table->size = (size_t)size.QuadPart;
+    table->mapping = CreateFileMappingA(table->file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (table->mapping == NULL) {
+        return false;
+    }
+    table->base = (const uint8_t*)MapViewOfFile(table->mapping, FILE_MAP_READ, 0, 0, 0);
+    return table->base != NULL;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return false;
+    }
+    table->size = (size_t)info.st_size;
+    void* base = mmap(NULL, table->size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+    table->base = (const uint8_t*)base;
+    return true;
+#endif
+}
+
+EndgameTable* openEndgameTable(const char* path) {
+    if (path == NULL) {
+        return NULL;
+    }
+
+    EndgameTable* table = (EndgameTable*)calloc(1, sizeof(EndgameTable));
+    if (table == NULL) {
+        return NULL;
+    }
+#ifdef _WIN32
+    table->file = INVALID_HANDLE_VALUE;
+#endif
+
+    if (!mapTable(table, path)) {
+        unmapTable(table);
+        free(table);
+        return NULL;
+    }
+
+    // Cabeçalho, banco de monstros e tamanhos
+    const EndgameHeader* header = (const EndgameHeader*)table->base;
+    int count = monsterDB.count;
+    size_t prefix = sizeof(EndgameHeader) + maxHpBytes(count) + (size_t)count * count * sizeof(uint64_t);
+    bool valid = table->size >= sizeof(EndgameHeader) &&
+                 memcmp(header->magic, ENDGAME_MAGIC, 4) == 0 &&
+                 header->version == ENDGAME_VERSION &&
+                 header->monsterCount == (uint32_t)count &&
+                 header->fingerprint == databaseFingerprint() &&
+                 table->size >= prefix;
+    if (valid) {
+        table->count = count;
+        table->maxHp = (const int16_t*)(table->base + sizeof(EndgameHeader));
+        table->offsets = (const uint64_t*)(table->base + sizeof(EndgameHeader) + maxHpBytes(count));
+        table->entries = (const uint16_t*)(table->base + prefix);
+        table->entryCount = (table->size - prefix) / sizeof(uint16_t);
+
+        size_t last = (size_t)count * count - 1;
+        valid = table->offsets[last] + (uint64_t)table->maxHp[count - 1] * table->maxHp[count - 1] <= table->entryCount;
+    }
+
+    if (!valid) {
+        printf("ERRO: %s não é uma tabela de finais para este banco de monstros (gere de novo com pokebattle-endgame)\n", path);
+        unmapTable(table);
+        free(table);
+        return NULL;
+    }
+    return table;
+}
+
+void closeEndgameTable(EndgameTable* table) {
+    if (table == NULL) {
+        return;
+    }
+    unmapTable(table);
+    free(table);
+}
+
+bool probeEndgame(const EndgameTable* table, int myMonster, int foeMonster, int myHp, int foeHp,
+                  EndgameResult* result) {
+    if (table == NULL || myMonster < 0 || myMonster >= table->count ||
+        foeMonster < 0 || foeMonster >= table->count) {
+        return false;
+    }
+
+    int myMax = table->maxHp[myMonster];
+    int foeMax = table->maxHp[foeMonster];
+    if (myHp < 1 || myHp > myMax || foeHp < 1 || foeHp > foeMax) {
+        return false;
+    }
+
+    uint16_t entry = table->entries[table->offsets[myMonster * table->count + foeMonster] +
+                                    (uint64_t)(myHp - 1) * foeMax + (foeHp - 1)];
+    result->winProbability = (float)(entry >> 2) / ENDGAME_PROBABILITY_MAX;
+    result->attackIndex = entry & 0x3;
+    return true;
+}
+
+// Único monstro de pé do time, se for o que está em campo
+static PokeMonster* lastMonster(MonsterList* team) {
+    PokeMonster* alive = NULL;
+    for (PokeMonster* current = team->first; current != NULL; current = current->next) {
+        if (!isMonsterFainted(current)) {
+            if (alive != NULL) {
+                return NULL;
+            }
+            alive = current;
+        }
+    }
+    return alive == team->current ? alive : NULL;
+}
+
+// Índice no banco, se o monstro está como no banco (sem status nem
+// atributos alterados)
+static int databaseIndex(const PokeMonster* monster) {
+    if (monster->statusCondition != STATUS_NONE) {
+        return -1;
+    }
+
+    PokeMonster* species = getMonsterByName(monster->name);
+    if (species == NULL || species->maxHp != monster->maxHp || species->attack != monster->attack ||
+        species->defense != monster->defense || species->speed != monster->speed) {
+        return -1;
+    }
+    return (int)(species - monsterDB.monsters);
+}
+
+bool lookupEndgame(const EndgameTable* table, BattleContext* ctx, bool isPlayerSide, EndgameResult* result) {
+    if (table == NULL || ctx == NULL || ctx->format != BATTLE_FORMAT_SINGLES ||
+        ctx->playerTeam == NULL || ctx->opponentTeam == NULL) {
+        return false;
+    }
+
+    PokeMonster* self = lastMonster(isPlayerSide ? ctx->playerTeam : ctx->opponentTeam);
+    PokeMonster* foe = lastMonster(isPlayerSide ? ctx->opponentTeam : ctx->playerTeam);
+    if (self == NULL || foe == NULL) {
+        return false;
+    }
+
+    int myIndex = databaseIndex(self);
+    int foeIndex = databaseIndex(foe);
+    if (myIndex < 0 || foeIndex < 0 ||
+        !probeEndgame(table, myIndex, foeIndex, self->hp, foe->hp, result)) {
+        return false;
+    }
+    return self->attacks[result->attackIndex].ppCurrent > 0;
+}
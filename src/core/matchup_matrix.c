@@ -0,0 +1,164 @@
+/**
+ * PokeBattle - Matriz de confrontos do banco
+ *
+ * Para cada lado, turnos até o nocaute = HP do outro / melhor dano esperado
+ * por turno. Quem é mais rápido bate antes, então ganha meio turno. A nota
+ * de A é a fração tB / (tA + tB): 0.5 quando os dois precisam do mesmo
+ * tempo, perto de 1 quando A derruba B bem antes de cair.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "matchup_matrix.h"
+#include "damage_batch.h"
+#include "monster_data.h"
+
+// Atacantes por lote: 4 golpes cada
+#define MATCHUP_ATTACKERS_PER_BATCH (DAMAGE_BATCH_MAX / 4)
+
+// Fator médio do crítico (5% de chance, dano x1,5)
+#define MATCHUP_CRITICAL_FACTOR 1.025f
+
+MatchupMatrix matchupMatrix = {0};
+
+void freeMatchupMatrix(void) {
+    free(matchupMatrix.score);
+    free(matchupMatrix.bestAttack);
+    free(matchupMatrix.averageScore);
+    memset(&matchupMatrix, 0, sizeof(MatchupMatrix));
+}
+
+// Melhor dano esperado por turno de cada atacante contra cada defensor,
+// já com precisão e crítico
+static void computeBestDamage(int count, float* bestDamage, uint8_t* bestAttack, DamageBatchResult* batch) {
+    for (int first = 0; first < count; first += MATCHUP_ATTACKERS_PER_BATCH) {
+        int last = first + MATCHUP_ATTACKERS_PER_BATCH < count ? first + MATCHUP_ATTACKERS_PER_BATCH : count;
+        DamageMoveBatch moves = {0};
+        for (int a = first; a < last; a++) {
+            addDamageBatchMoves(&moves, &monsterDB.monsters[a]);
+        }
+
+        for (int firstDefender = 0; firstDefender < count; firstDefender += DAMAGE_BATCH_MAX) {
+            DamageDefenderBatch defenders = {0};
+            for (int d = firstDefender; d < count && defenders.count < DAMAGE_BATCH_MAX; d++) {
+                addDamageBatchDefender(&defenders, &monsterDB.monsters[d]);
+            }
+            computeDamageBatch(&moves, &defenders, batch);
+
+            for (int a = first; a < last; a++) {
+                const PokeMonster* attacker = &monsterDB.monsters[a];
+                for (int d = 0; d < defenders.count; d++) {
+                    float best = 0.0f;
+                    int bestIndex = 0;
+                    for (int m = 0; m < 4; m++) {
+                        float damage = batch->expectedDamage[(a - first) * 4 + m][d] *
+                                       attacker->attacks[m].accuracy / 100.0f;
+                        if (damage > best) {
+                            best = damage;
+                            bestIndex = m;
+                        }
+                    }
+                    bestDamage[a * count + firstDefender + d] = best * MATCHUP_CRITICAL_FACTOR;
+                    bestAttack[a * count + firstDefender + d] = (uint8_t)bestIndex;
+                }
+            }
+        }
+    }
+}
+
+void buildMatchupMatrix(void) {
+    freeMatchupMatrix();
+    int count = monsterDB.count;
+    if (count <= 0 || monsterDB.monsters == NULL) {
+        return;
+    }
+
+    float* bestDamage = malloc(sizeof(float) * count * count);
+    DamageBatchResult* batch = malloc(sizeof(DamageBatchResult));
+    matchupMatrix.score = malloc(sizeof(float) * count * count);
+    matchupMatrix.bestAttack = malloc(sizeof(uint8_t) * count * count);
+    matchupMatrix.averageScore = malloc(sizeof(float) * count);
+    if (bestDamage == NULL || batch == NULL || matchupMatrix.score == NULL ||
+        matchupMatrix.bestAttack == NULL || matchupMatrix.averageScore == NULL) {
+        printf("ERRO: Falha ao alocar a matriz de confrontos\n");
+        free(bestDamage);
+        free(batch);
+        freeMatchupMatrix();
+        return;
+    }
+    matchupMatrix.count = count;
+
+    computeBestDamage(count, bestDamage, matchupMatrix.bestAttack, batch);
+    free(batch);
+
+    for (int a = 0; a < count; a++) {
+        const PokeMonster* attacker = &monsterDB.monsters[a];
+        float total = 0.0f;
+        for (int d = 0; d < count; d++) {
+            const PokeMonster* defender = &monsterDB.monsters[d];
+            float damageA = bestDamage[a * count + d];
+            float damageB = bestDamage[d * count + a];
+
+            // Sem dano nenhum o lado nunca vence; os dois sem dano empatam
+            float turnsA = damageA > 0.0f ? defender->maxHp / damageA : INFINITY;
+            float turnsB = damageB > 0.0f ? attacker->maxHp / damageB : INFINITY;
+            float score;
+            if (isinf(turnsA) && isinf(turnsB)) {
+                score = 0.5f;
+            } else if (isinf(turnsA)) {
+                score = 0.0f;
+            } else if (isinf(turnsB)) {
+                score = 1.0f;
+            } else {
+                if (attacker->speed > defender->speed) {
+                    turnsA -= 0.5f;
+                } else if (defender->speed > attacker->speed) {
+                    turnsB -= 0.5f;
+                }
+                // Um golpe só já basta: não deixa a conta passar de zero
+                turnsA = turnsA > 0.25f ? turnsA : 0.25f;
+                turnsB = turnsB > 0.25f ? turnsB : 0.25f;
+                score = turnsB / (turnsA + turnsB);
+            }
+            matchupMatrix.score[a * count + d] = score;
+            total += score;
+        }
+        matchupMatrix.averageScore[a] = total / count;
+    }
+
+    free(bestDamage);
+}
+
+int getSpeciesIndex(const PokeMonster* monster) {
+    if (monster == NULL || monsterDB.monsters == NULL) {
+        return -1;
+    }
+
+    // O índice herdado basta quando o nome confere; senão procura pelo nome
+    int index = monster->speciesIndex;
+    if (index >= 0 && index < monsterDB.count && strcmp(monsterDB.monsters[index].name, monster->name) == 0) {
+        return index;
+    }
+    PokeMonster* species = getMonsterByName(monster->name);
+    return species != NULL ? (int)(species - monsterDB.monsters) : -1;
+}
+
+float getMatchupScore(const PokeMonster* attacker, const PokeMonster* defender) {
+    int a = getSpeciesIndex(attacker);
+    int d = getSpeciesIndex(defender);
+    if (a < 0 || d < 0 || a >= matchupMatrix.count || d >= matchupMatrix.count) {
+        return 0.5f;
+    }
+    return getMatchupScoreByIndex(a, d);
+}
+
+int getMatchupBestAttack(const PokeMonster* attacker, const PokeMonster* defender) {
+    int a = getSpeciesIndex(attacker);
+    int d = getSpeciesIndex(defender);
+    if (a < 0 || d < 0 || a >= matchupMatrix.count || d >= matchupMatrix.count) {
+        return -1;
+    }
+    return matchupMatrix.bestAttack[a * matchupMatrix.count + d];
+}
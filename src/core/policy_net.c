@@ -0,0 +1,626 @@
+/**
+ * PokeBattle - Rede de política local
+ *
+ * Entradas (todas entre 0 e 1, do ponto de vista de quem decide):
+ *   monstro em campo   HP, tipos (18), status (6), quem é mais rápido,
+ *                      ataque, defesa e velocidade; por ataque: tem PP,
+ *                      PP restante, dano esperado / HP do adversário,
+ *                      chance de nocaute, nocaute garantido, precisão,
+ *                      chance de status, efetividade e poder
+ *   adversário         HP, tipos, status, dano esperado de cada ataque
+ *                      contra o monstro em campo, a maior chance de
+ *                      nocaute e se ele garante o nocaute
+ *   time (6 posições)  existe, de pé, HP, em campo, nota do confronto
+ *                      contra o adversário, dano esperado que sofreria,
+ *                      chance de nocautear o adversário e se é mais rápido
+ *   resumo             monstros de pé e HP total de cada lado, itens
+ *                      disponíveis e o turno
+ *
+ * Quantização: entradas e ativações viram inteiros de 0 a 127 (a escala
+ * das ativações é recalculada a cada camada pelo maior valor), pesos são
+ * int8 com uma escala por linha. O produto u8 x s8 cabe em 16 bits aos
+ * pares (2 * 127 * 127 < 32767), o que permite usar maddubs no SIMD.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "policy_net.h"
+#include "battle_search.h"
+#include "matchup_matrix.h"
+#include "monster_data.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define POLICY_NET_X86 1
+    #include <immintrin.h>
+#endif
+
+#define POLICY_NET_MAGIC "PBNN"
+#define POLICY_NET_VERSION 1
+#define POLICY_SAMPLES_MAGIC "PBSP"
+#define POLICY_SAMPLES_VERSION 1
+
+// Maior valor de uma entrada ou ativação quantizada
+#define POLICY_NET_QUANT_MAX 127
+
+// Monstros por time cobertos pelas entradas
+#define POLICY_NET_TEAM_SLOTS 6
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t inputs;
+    uint32_t hidden;
+    uint32_t outputs;
+    uint32_t layers;
+} PolicyNetHeader;
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t inputs;
+    uint32_t reserved;
+    uint64_t count;
+} PolicySamplesHeader;
+
+typedef struct {
+    int8_t* weights;     // rows x cols
+    float* scales;       // Escala dos pesos de cada linha
+    float* biases;
+} QuantizedLayer;
+
+struct PolicyNet {
+    QuantizedLayer layers[POLICY_NET_LAYERS];
+};
+
+static const int layerRows[POLICY_NET_LAYERS] = { POLICY_NET_HIDDEN, POLICY_NET_HIDDEN, POLICY_NET_OUTPUTS };
+static const int layerCols[POLICY_NET_LAYERS] = { POLICY_NET_INPUTS, POLICY_NET_HIDDEN, POLICY_NET_HIDDEN };
+
+typedef void (*DotRowsKernel)(const uint8_t* input, const int8_t* weights, int rows, int cols, int32_t* out);
+
+// Produto de input por cada linha de weights (cols múltiplo de 32)
+static void dotRowsScalar(const uint8_t* input, const int8_t* weights, int rows, int cols, int32_t* out) {
+    for (int r = 0; r < rows; r++) {
+        const int8_t* row = weights + (size_t)r * cols;
+        int32_t sum = 0;
+        for (int c = 0; c < cols; c++) {
+            sum += (int32_t)input[c] * row[c];
+        }
+        out[r] = sum;
+    }
+}
+
+#ifdef POLICY_NET_X86
+
+__attribute__((target("avx2")))
+static void dotRowsAvx2(const uint8_t* input, const int8_t* weights, int rows, int cols, int32_t* out) {
+    const __m256i ones = _mm256_set1_epi16(1);
+
+    for (int r = 0; r < rows; r++) {
+        const int8_t* row = weights + (size_t)r * cols;
+        __m256i sum = _mm256_setzero_si256();
+        for (int c = 0; c < cols; c += 32) {
+            __m256i x = _mm256_loadu_si256((const __m256i*)(input + c));
+            __m256i w = _mm256_loadu_si256((const __m256i*)(row + c));
+            sum = _mm256_add_epi32(sum, _mm256_madd_epi16(_mm256_maddubs_epi16(x, w), ones));
+        }
+
+        __m128i half = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+        half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0x4E));
+        half = _mm_add_epi32(half, _mm_shuffle_epi32(half, 0xB1));
+        out[r] = _mm_cvtsi128_si32(half);
+    }
+}
+
+__attribute__((target("sse4.1")))
+static void dotRowsSse41(const uint8_t* input, const int8_t* weights, int rows, int cols, int32_t* out) {
+    const __m128i ones = _mm_set1_epi16(1);
+
+    for (int r = 0; r < rows; r++) {
+        const int8_t* row = weights + (size_t)r * cols;
+        __m128i sum = _mm_setzero_si128();
+        for (int c = 0; c < cols; c += 16) {
+            __m128i x = _mm_loadu_si128((const __m128i*)(input + c));
+            __m128i w = _mm_loadu_si128((const __m128i*)(row + c));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_maddubs_epi16(x, w), ones));
+        }
+
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4E));
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xB1));
+        out[r] = _mm_cvtsi128_si32(sum);
+    }
+}
+
+#endif // POLICY_NET_X86
+
+static DotRowsKernel selectedKernel = NULL;
+static const char* selectedKernelName = "scalar";
+
+static DotRowsKernel getDotRowsKernel(void) {
+    if (selectedKernel != NULL) {
+        return selectedKernel;
+    }
+
+    DotRowsKernel kernel = dotRowsScalar;
+    const char* name = "scalar";
+#ifdef POLICY_NET_X86
+    if (__builtin_cpu_supports("avx2")) {
+        kernel = dotRowsAvx2;
+        name = "avx2";
+    } else if (__builtin_cpu_supports("sse4.1")) {
+        kernel = dotRowsSse41;
+        name = "sse4.1";
+    }
+#endif
+    // Corrida inofensiva entre threads: todas escrevem o mesmo valor
+    selectedKernelName = name;
+    selectedKernel = kernel;
+    return kernel;
+}
+
+const char* getPolicyNetKernelName(void) {
+    getDotRowsKernel();
+    return selectedKernelName;
+}
+
+void freePolicyNet(PolicyNet* net) {
+    if (net == NULL) {
+        return;
+    }
+    for (int i = 0; i < POLICY_NET_LAYERS; i++) {
+        free(net->layers[i].weights);
+        free(net->layers[i].scales);
+        free(net->layers[i].biases);
+    }
+    free(net);
+}
+
+PolicyNet* loadPolicyNet(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+
+    PolicyNetHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, POLICY_NET_MAGIC, 4) != 0 || header.version != POLICY_NET_VERSION ||
+        header.inputs != POLICY_NET_INPUTS || header.hidden != POLICY_NET_HIDDEN ||
+        header.outputs != POLICY_NET_OUTPUTS || header.layers != POLICY_NET_LAYERS) {
+        printf("ERRO: %s não é um arquivo de pesos desta versão\n", path);
+        fclose(file);
+        return NULL;
+    }
+
+    PolicyNet* net = calloc(1, sizeof(PolicyNet));
+    bool ok = net != NULL;
+    for (int i = 0; ok && i < POLICY_NET_LAYERS; i++) {
+        QuantizedLayer* layer = &net->layers[i];
+        size_t rows = (size_t)layerRows[i];
+        size_t weightCount = rows * layerCols[i];
+        layer->weights = malloc(weightCount);
+        layer->scales = malloc(rows * sizeof(float));
+        layer->biases = malloc(rows * sizeof(float));
+        ok = layer->weights != NULL && layer->scales != NULL && layer->biases != NULL &&
+             fread(layer->scales, sizeof(float), rows, file) == rows &&
+             fread(layer->biases, sizeof(float), rows, file) == rows &&
+             fread(layer->weights, 1, weightCount, file) == weightCount;
+    }
+    fclose(file);
+
+    if (!ok) {
+        printf("ERRO: %s está incompleto\n", path);
+        freePolicyNet(net);
+        return NULL;
+    }
+    return net;
+}
+
+bool savePolicyNet(const char* path, const PolicyNetLayerWeights layers[POLICY_NET_LAYERS]) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        printf("ERRO: não foi possível criar %s\n", path);
+        return false;
+    }
+
+    PolicyNetHeader header = {
+        { 'P', 'B', 'N', 'N' }, POLICY_NET_VERSION,
+        POLICY_NET_INPUTS, POLICY_NET_HIDDEN, POLICY_NET_OUTPUTS, POLICY_NET_LAYERS
+    };
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+
+    for (int i = 0; ok && i < POLICY_NET_LAYERS; i++) {
+        int rows = layerRows[i];
+        int cols = layerCols[i];
+        float scales[POLICY_NET_HIDDEN];
+        int8_t quantized[POLICY_NET_HIDDEN * POLICY_NET_INPUTS];
+
+        // Escala simétrica por linha: o maior peso em módulo vira 127
+        for (int r = 0; r < rows; r++) {
+            const float* row = layers[i].weights + (size_t)r * cols;
+            float largest = 0.0f;
+            for (int c = 0; c < cols; c++) {
+                largest = fmaxf(largest, fabsf(row[c]));
+            }
+            scales[r] = largest > 0.0f ? largest / POLICY_NET_QUANT_MAX : 1.0f;
+            for (int c = 0; c < cols; c++) {
+                quantized[r * cols + c] = (int8_t)lrintf(row[c] / scales[r]);
+            }
+        }
+
+        ok = fwrite(scales, sizeof(float), rows, file) == (size_t)rows &&
+             fwrite(layers[i].biases, sizeof(float), rows, file) == (size_t)rows &&
+             fwrite(quantized, 1, (size_t)rows * cols, file) == (size_t)rows * cols;
+    }
+
+    if (fclose(file) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        printf("ERRO: falha ao gravar %s\n", path);
+    }
+    return ok;
+}
+
+// Converte valores >= 0 para 0..127 e devolve a escala usada
+static float quantizeActivations(const float* values, int count, uint8_t* quantized) {
+    float largest = 0.0f;
+    for (int i = 0; i < count; i++) {
+        largest = fmaxf(largest, values[i]);
+    }
+    float inverse = largest > 0.0f ? POLICY_NET_QUANT_MAX / largest : 0.0f;
+    for (int i = 0; i < count; i++) {
+        quantized[i] = (uint8_t)(values[i] * inverse + 0.5f);
+    }
+    return largest > 0.0f ? largest / POLICY_NET_QUANT_MAX : 1.0f;
+}
+
+void quantizePolicyFeatures(const float features[POLICY_NET_INPUTS], uint8_t quantized[POLICY_NET_INPUTS]) {
+    for (int i = 0; i < POLICY_NET_INPUTS; i++) {
+        float value = features[i] < 0.0f ? 0.0f : (features[i] > 1.0f ? 1.0f : features[i]);
+        quantized[i] = (uint8_t)(value * POLICY_NET_QUANT_MAX + 0.5f);
+    }
+}
+
+bool savePolicySamples(const char* path, const PolicySample* samples, long count) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        printf("ERRO: não foi possível criar %s\n", path);
+        return false;
+    }
+
+    PolicySamplesHeader header = {
+        { 'P', 'B', 'S', 'P' }, POLICY_SAMPLES_VERSION, POLICY_NET_INPUTS, 0, (uint64_t)count
+    };
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+              fwrite(samples, sizeof(PolicySample), (size_t)count, file) == (size_t)count;
+    if (fclose(file) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        printf("ERRO: falha ao gravar %s\n", path);
+    }
+    return ok;
+}
+
+PolicySample* loadPolicySamples(const char* path, long* count) {
+    *count = 0;
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        printf("ERRO: não foi possível abrir %s\n", path);
+        return NULL;
+    }
+
+    PolicySamplesHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, POLICY_SAMPLES_MAGIC, 4) != 0 || header.version != POLICY_SAMPLES_VERSION ||
+        header.inputs != POLICY_NET_INPUTS) {
+        printf("ERRO: %s não é um arquivo de amostras desta versão\n", path);
+        fclose(file);
+        return NULL;
+    }
+
+    PolicySample* samples = malloc((header.count > 0 ? header.count : 1) * sizeof(PolicySample));
+    if (samples == NULL || fread(samples, sizeof(PolicySample), header.count, file) != header.count) {
+        printf("ERRO: %s está incompleto\n", path);
+        free(samples);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+
+    *count = (long)header.count;
+    return samples;
+}
+
+void evaluatePolicyNet(const PolicyNet* net, const float features[POLICY_NET_INPUTS],
+                       float logits[POLICY_NET_OUTPUTS]) {
+    DotRowsKernel dotRows = getDotRowsKernel();
+    uint8_t input[POLICY_NET_INPUTS];
+    int32_t sums[POLICY_NET_HIDDEN];
+    float activations[POLICY_NET_HIDDEN];
+
+    // Entradas já estão em [0, 1]: escala fixa
+    quantizePolicyFeatures(features, input);
+    float inputScale = 1.0f / POLICY_NET_QUANT_MAX;
+
+    for (int i = 0; i < POLICY_NET_LAYERS; i++) {
+        const QuantizedLayer* layer = &net->layers[i];
+        int rows = layerRows[i];
+        dotRows(input, layer->weights, rows, layerCols[i], sums);
+
+        float* out = (i == POLICY_NET_LAYERS - 1) ? logits : activations;
+        for (int r = 0; r < rows; r++) {
+            out[r] = sums[r] * inputScale * layer->scales[r] + layer->biases[r];
+        }
+        if (out == activations) {
+            for (int r = 0; r < rows; r++) {
+                activations[r] = fmaxf(activations[r], 0.0f);   // ReLU
+            }
+            inputScale = quantizeActivations(activations, rows, input);
+        }
+    }
+}
+
+int getPolicyActionSlot(int kind, int parameter) {
+    switch (kind) {
+        case 0:
+            return (parameter >= 0 && parameter < 4) ? parameter : -1;
+        case 1:
+            return (parameter >= 0 && parameter < POLICY_NET_TEAM_SLOTS) ? POLICY_NET_SLOT_SWITCH + parameter : -1;
+        case 2:
+            return parameter == ITEM_POTION ? POLICY_NET_SLOT_POTION : POLICY_NET_SLOT_ITEM;
+        default:
+            return -1;
+    }
+}
+
+void getPolicySlotAction(const BattleContext* ctx, int slot, int* action, int* parameter) {
+    if (slot >= POLICY_NET_SLOT_SWITCH && slot < POLICY_NET_SLOT_POTION) {
+        *action = 1;
+        *parameter = slot - POLICY_NET_SLOT_SWITCH;
+    } else if (slot == POLICY_NET_SLOT_POTION) {
+        *action = 2;
+        *parameter = ITEM_POTION;
+    } else if (slot == POLICY_NET_SLOT_ITEM) {
+        *action = 2;
+        *parameter = ctx->itemType;
+    } else {
+        *action = 0;
+        *parameter = slot;
+    }
+}
+
+static float clamp01(float value) {
+    return value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+}
+
+static float hpRatio(const PokeMonster* monster) {
+    return monster->maxHp > 0 ? clamp01((float)monster->hp / monster->maxHp) : 0.0f;
+}
+
+// Dano médio de um ataque, com a precisão (variação do meio, sem crítico)
+static float expectedDamage(const PokeMonster* attacker, const PokeMonster* defender, const Attack* attack) {
+    return calculateDamageWithRoll(attacker, defender, attack, 92) * attack->accuracy / 100.0f;
+}
+
+// Maior dano esperado do atacante (só ataques com PP)
+static float bestExpectedDamage(const PokeMonster* attacker, const PokeMonster* defender) {
+    float best = 0.0f;
+    for (int i = 0; i < 4; i++) {
+        if (attacker->attacks[i].ppCurrent > 0) {
+            best = fmaxf(best, expectedDamage(attacker, defender, &attacker->attacks[i]));
+        }
+    }
+    return best;
+}
+
+// Chance de o ataque derrubar o defensor nesta jogada: variações, crítico
+// (5%, x1,5) e precisão, como getKoProbability do cache de dano
+static float koProbability(const PokeMonster* attacker, const PokeMonster* defender, const Attack* attack) {
+    if (attack->ppCurrent <= 0 || attack->power <= 0 || defender->hp <= 0 ||
+        attacker->statusCondition == STATUS_SLEEPING) {
+        return 0.0f;
+    }
+    if (calculateDamageWithRoll(attacker, defender, attack, 100) * 3 / 2 < defender->hp) {
+        return 0.0f;
+    }
+
+    int normal = 0, critical = 0;
+    for (int roll = 85; roll <= 100; roll++) {
+        int damage = calculateDamageWithRoll(attacker, defender, attack, roll);
+        if (damage >= defender->hp) normal++;
+        if (damage * 3 / 2 >= defender->hp) critical++;
+    }
+    float chance = attack->accuracy / 100.0f * (0.95f * normal + 0.05f * critical) / 16.0f;
+    return attacker->statusCondition == STATUS_PARALYZED ? chance * 0.75f : chance;
+}
+
+static float bestKoProbability(const PokeMonster* attacker, const PokeMonster* defender) {
+    float best = 0.0f;
+    for (int i = 0; i < 4; i++) {
+        best = fmaxf(best, koProbability(attacker, defender, &attacker->attacks[i]));
+    }
+    return best;
+}
+
+// Algum ataque com PP derruba o defensor mesmo na menor variação e sem errar
+static bool hasSureKo(const PokeMonster* attacker, const PokeMonster* defender) {
+    for (int i = 0; i < 4; i++) {
+        const Attack* attack = &attacker->attacks[i];
+        if (attack->ppCurrent > 0 && attack->accuracy >= 100 &&
+            calculateDamageWithRoll(attacker, defender, attack, 85) >= defender->hp) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void addMonsterFeatures(float* features, int* n, const PokeMonster* monster) {
+    features[(*n)++] = hpRatio(monster);
+
+    for (int type = 0; type < TYPE_COUNT; type++) {
+        features[(*n)++] = (monster->type1 == type || monster->type2 == type) ? 1.0f : 0.0f;
+    }
+    for (int status = STATUS_ATK_DOWN; status <= STATUS_BURNING; status++) {
+        features[(*n)++] = monster->statusCondition == status ? 1.0f : 0.0f;
+    }
+}
+
+static void addTeamSummary(float* features, int* n, const MonsterList* team) {
+    int alive = 0;
+    float health = 0.0f;
+    for (PokeMonster* current = team->first; current != NULL; current = current->next) {
+        if (!isMonsterFainted(current)) {
+            alive++;
+            health += hpRatio(current);
+        }
+    }
+    features[(*n)++] = team->count > 0 ? (float)alive / team->count : 0.0f;
+    features[(*n)++] = team->count > 0 ? health / team->count : 0.0f;
+}
+
+bool extractPolicyFeatures(BattleContext* ctx, bool isPlayerSide, float features[POLICY_NET_INPUTS],
+                           uint16_t* legalMask) {
+    memset(features, 0, POLICY_NET_INPUTS * sizeof(float));
+    *legalMask = 0;
+
+    if (ctx == NULL || ctx->format != BATTLE_FORMAT_SINGLES) {
+        return false;
+    }
+
+    MonsterList* team = isPlayerSide ? ctx->playerTeam : ctx->opponentTeam;
+    MonsterList* foeTeam = isPlayerSide ? ctx->opponentTeam : ctx->playerTeam;
+    PokeMonster* self = team->current;
+    PokeMonster* foe = foeTeam->current;
+    if (self == NULL || foe == NULL || isMonsterFainted(self) || isMonsterFainted(foe)) {
+        return false;
+    }
+
+    SearchAction actions[SEARCH_MAX_ACTIONS];
+    int actionCount = generateSearchActions(ctx, isPlayerSide, actions);
+    for (int i = 0; i < actionCount; i++) {
+        int slot = getPolicyActionSlot(actions[i].kind, actions[i].parameter);
+        if (slot >= 0) {
+            *legalMask |= (uint16_t)(1u << slot);
+        }
+    }
+
+    int n = 0;
+
+    // Monstro em campo
+    addMonsterFeatures(features, &n, self);
+    features[n++] = self->speed > foe->speed ? 1.0f : (self->speed == foe->speed ? 0.5f : 0.0f);
+    features[n++] = clamp01(self->attack / 300.0f);
+    features[n++] = clamp01(self->defense / 300.0f);
+    features[n++] = clamp01(self->speed / 300.0f);
+
+    for (int i = 0; i < 4; i++) {
+        const Attack* attack = &self->attacks[i];
+        features[n++] = attack->ppCurrent > 0 ? 1.0f : 0.0f;
+        features[n++] = attack->ppMax > 0 ? clamp01((float)attack->ppCurrent / attack->ppMax) : 0.0f;
+        features[n++] = foe->hp > 0 ? clamp01(expectedDamage(self, foe, attack) / foe->hp) : 0.0f;
+        features[n++] = koProbability(self, foe, attack);
+        features[n++] = (attack->accuracy >= 100 &&
+                         calculateDamageWithRoll(self, foe, attack, 85) >= foe->hp) ? 1.0f : 0.0f;
+        features[n++] = clamp01(attack->accuracy / 100.0f);
+        features[n++] = attack->statusEffect > 0 ? clamp01(attack->statusChance / 100.0f) : 0.0f;
+        features[n++] = clamp01(calculateTypeEffectiveness(attack->type, foe->type1, foe->type2) / 4.0f);
+        features[n++] = clamp01(attack->power / 150.0f);
+    }
+
+    // Adversário
+    addMonsterFeatures(features, &n, foe);
+    for (int i = 0; i < 4; i++) {
+        const Attack* attack = &foe->attacks[i];
+        features[n++] = (attack->ppCurrent > 0 && self->hp > 0) ?
+                        clamp01(expectedDamage(foe, self, attack) / self->hp) : 0.0f;
+    }
+    features[n++] = bestKoProbability(foe, self);
+    features[n++] = hasSureKo(foe, self) ? 1.0f : 0.0f;
+
+    // Time, pela posição (a mesma das trocas)
+    PokeMonster* member = team->first;
+    for (int slot = 0; slot < POLICY_NET_TEAM_SLOTS; slot++) {
+        if (member != NULL) {
+            bool alive = !isMonsterFainted(member);
+            features[n++] = 1.0f;
+            features[n++] = alive ? 1.0f : 0.0f;
+            features[n++] = hpRatio(member);
+            features[n++] = member == self ? 1.0f : 0.0f;
+            features[n++] = alive ? getMatchupScore(member, foe) : 0.0f;
+            features[n++] = (alive && member->hp > 0) ? clamp01(bestExpectedDamage(foe, member) / member->hp) : 0.0f;
+            features[n++] = alive ? bestKoProbability(member, foe) : 0.0f;
+            features[n++] = member->speed > foe->speed ? 1.0f : 0.0f;
+            member = member->next;
+        } else {
+            n += 8;
+        }
+    }
+
+    // Resumo
+    addTeamSummary(features, &n, team);
+    addTeamSummary(features, &n, foeTeam);
+
+    bool potionUsed = isPlayerSide ? ctx->playerPotionUsed : ctx->botPotionUsed;
+    bool randomItemUsed = isPlayerSide ? ctx->playerRandomItemUsed : ctx->botRandomItemUsed;
+    features[n++] = potionUsed ? 0.0f : 1.0f;
+    features[n++] = randomItemUsed ? 0.0f : 1.0f;
+    features[n++] = ctx->itemType == ITEM_RED_CARD ? 1.0f : 0.0f;
+    features[n++] = ctx->itemType == ITEM_COIN ? 1.0f : 0.0f;
+    features[n++] = clamp01(ctx->turn / 50.0f);
+
+    return *legalMask != 0;
+}
+
+bool choosePolicyNetAction(const PolicyNet* net, BattleContext* ctx, bool isPlayerSide,
+                           PolicyNetResult* result) {
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+
+    memset(result, 0, sizeof(PolicyNetResult));
+    MonsterList* team = isPlayerSide ? ctx->playerTeam : ctx->opponentTeam;
+    if (team != NULL && team->current != NULL) {
+        for (int i = 0; i < 4; i++) {
+            if (team->current->attacks[i].ppCurrent > 0) {
+                result->parameter = i;
+                result->slot = i;
+                break;
+            }
+        }
+    }
+
+    float features[POLICY_NET_INPUTS];
+    uint16_t legalMask;
+    if (net == NULL || !extractPolicyFeatures(ctx, isPlayerSide, features, &legalMask)) {
+        return false;
+    }
+
+    float logits[POLICY_NET_OUTPUTS];
+    evaluatePolicyNet(net, features, logits);
+
+    int best = -1;
+    for (int i = 0; i < POLICY_NET_OUTPUTS; i++) {
+        if ((legalMask & (1u << i)) && (best < 0 || logits[i] > logits[best])) {
+            best = i;
+        }
+    }
+
+    // Probabilidade (softmax só entre as saídas válidas)
+    double total = 0.0;
+    for (int i = 0; i < POLICY_NET_OUTPUTS; i++) {
+        if (legalMask & (1u << i)) {
+            total += exp(logits[i] - logits[best]);
+        }
+    }
+
+    result->slot = best;
+    result->confidence = (float)(1.0 / total);
+    getPolicySlotAction(ctx, best, &result->action, &result->parameter);
+
+    struct timespec end;
+    timespec_get(&end, TIME_UTC);
+    result->elapsedUs = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3;
+    return true;
+}
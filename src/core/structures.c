@@ -13,7 +13,10 @@
  #include <stdio.h>
  #include <stdlib.h>
  #include <string.h>
- #include "structures.h"
+ #include "core_structures.h"
+ 
+ // Logs de depuração do núcleo (o simulador desliga para rodar em velocidade máxima)
+ bool battleDebugLog = true;
  
  // Funções para a lista duplamente encadeada
  
@@ -50,8 +53,8 @@
      free(list);
  }
  
- // Adiciona um monstro à lista
- void addMonster(MonsterList* list, PokeMonster* monster) {
+ // Liga o monstro ao fim da lista
+ void addMonsterQuiet(MonsterList* list, PokeMonster* monster) {
     if (list == NULL || monster == NULL) {
         printf("Erro: lista ou monstro nulo em addMonster\n"); // Debug
         return;
@@ -73,7 +76,14 @@
      }
      
      list->count++;
-     printf("Monstro %s adicionado. Total na lista: %d\n", monster->name, list->count); // Debug
+ }
+
+ // Adiciona um monstro à lista
+ void addMonster(MonsterList* list, PokeMonster* monster) {
+     addMonsterQuiet(list, monster);
+     if (battleDebugLog && list != NULL && monster != NULL) {
+         printf("Monstro %s adicionado. Total na lista: %d\n", monster->name, list->count); // Debug
+     }
  }
  
  // Remove um monstro da lista
@@ -165,86 +175,38 @@
  
  // Funções para a fila de ações
  
- // Cria uma nova fila de ações
- ActionQueue* createActionQueue(int capacity) {
-     if (capacity <= 0) {
-         capacity = 10; // Capacidade padrão
-     }
-     
-     ActionQueue* queue = (ActionQueue*)malloc(sizeof(ActionQueue));
-     if (queue == NULL) {
-         return NULL;
-     }
-     
-     queue->actions = (int*)malloc(sizeof(int) * capacity);
-     queue->parameters = (int*)malloc(sizeof(int) * capacity);
-     queue->monsters = (PokeMonster**)malloc(sizeof(PokeMonster*) * capacity);
-     
-     if (queue->actions == NULL || queue->parameters == NULL || queue->monsters == NULL) {
-         // Falha ao alocar memória, liberar tudo e retornar NULL
-         if (queue->actions) free(queue->actions);
-         if (queue->parameters) free(queue->parameters);
-         if (queue->monsters) free(queue->monsters);
-         free(queue);
-         return NULL;
-     }
-     
-     queue->front = 0;
-     queue->rear = -1;
-     queue->capacity = capacity;
-     queue->count = 0;
-     
-     return queue;
- }
- 
- // Libera uma fila de ações
- void freeActionQueue(ActionQueue* queue) {
-     if (queue == NULL) {
-         return;
-     }
-     
-     if (queue->actions) free(queue->actions);
-     if (queue->parameters) free(queue->parameters);
-     if (queue->monsters) free(queue->monsters);
-     free(queue);
- }
- 
  // Verifica se a fila está vazia
- bool isQueueEmpty(ActionQueue* queue) {
+ bool isQueueEmpty(const ActionQueue* queue) {
      return (queue == NULL || queue->count == 0);
  }
  
  // Verifica se a fila está cheia
- bool isQueueFull(ActionQueue* queue) {
-     return (queue == NULL || queue->count == queue->capacity);
+ bool isQueueFull(const ActionQueue* queue) {
+     return (queue == NULL || queue->count == ACTION_QUEUE_CAPACITY);
  }
  
- // Adiciona uma ação à fila
- bool enqueue(ActionQueue* queue, int action, int parameter, PokeMonster* monster) {
-     if (queue == NULL || isQueueFull(queue)) {
+ // Adiciona uma ação à fila (cópia do registro)
+ bool enqueue(ActionQueue* queue, const ActionRecord* record) {
+     if (queue == NULL || record == NULL || isQueueFull(queue)) {
          return false;
      }
      
-     queue->rear = (queue->rear + 1) % queue->capacity;
-     queue->actions[queue->rear] = action;
-     queue->parameters[queue->rear] = parameter;
-     queue->monsters[queue->rear] = monster;
+     int rear = (queue->front + queue->count) & (ACTION_QUEUE_CAPACITY - 1);
+     queue->records[rear] = *record;
      queue->count++;
      
      return true;
  }
  
  // Remove uma ação da fila
- bool dequeue(ActionQueue* queue, int* action, int* parameter, PokeMonster** monster) {
+ bool dequeue(ActionQueue* queue, ActionRecord* record) {
      if (queue == NULL || isQueueEmpty(queue)) {
          return false;
      }
      
-     if (action) *action = queue->actions[queue->front];
-     if (parameter) *parameter = queue->parameters[queue->front];
-     if (monster) *monster = queue->monsters[queue->front];
+     if (record) *record = queue->records[queue->front];
      
-     queue->front = (queue->front + 1) % queue->capacity;
+     queue->front = (queue->front + 1) & (ACTION_QUEUE_CAPACITY - 1);
      queue->count--;
      
      return true;
@@ -257,7 +219,6 @@
      }
      
      queue->front = 0;
-     queue->rear = -1;
      queue->count = 0;
  }
  
@@ -0,0 +1,397 @@
+/**
+ * PokeBattle - Sugestão de time
+ *
+ * A nota barata de um time é a média, sobre cada monstro de cada time do
+ * grupo, do max(score[membro][adversário]) entre os três membros: quanto
+ * o time tem uma resposta boa para cada ameaça. Metade do grupo é sorteada
+ * e a outra metade sai dos melhores times nessa nota. A poda fica com os
+ * maxCandidates primeiros nessa nota e descarta ainda quem está mais de
+ * TEAM_BUILDER_MARGIN abaixo do primeiro.
+ *
+ * Cada candidato é uma tarefa do pool com semente própria, então o
+ * resultado final não depende de quantas threads rodaram.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include "team_builder.h"
+#include "battle_sim.h"
+#include "matchup_matrix.h"
+#include "monster_data.h"
+#include "work_pool.h"
+
+#define TEAM_BUILDER_MAX_OPPONENTS 64
+#define TEAM_BUILDER_MAX_TURNS 200
+
+// Diferença máxima de nota barata para o primeiro colocado
+#define TEAM_BUILDER_MARGIN 0.15f
+
+// Os times "do metagame" do grupo saem dos primeiros nessa quantidade
+#define TEAM_BUILDER_META_POOL 64
+
+typedef struct TeamCandidate TeamCandidate;
+
+struct TeamBuilder {
+    TeamBuilderConfig config;
+    WorkPool* pool;
+    BattleContext** contexts;     // Um por thread do pool
+    TeamSpec opponents[TEAM_BUILDER_MAX_OPPONENTS];
+    int opponentCount;
+
+    TeamCandidate* candidates;
+    long teamsTotal;
+    long candidateCount;
+    struct timespec start;
+
+    atomic_bool cancelled;
+    atomic_long evaluated;
+    atomic_long battles;
+
+    pthread_mutex_t lock;         // Protege o ranking e finishedMs
+    int bestCount;
+    TeamSuggestion best[TEAM_BUILDER_TOP];
+    double finishedMs;
+};
+
+struct TeamCandidate {
+    TeamBuilder* builder;
+    long order;                   // Posição na nota barata (semente da tarefa)
+    TeamSuggestion team;
+};
+
+static double elapsedSince(const struct timespec* start) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (now.tv_sec - start->tv_sec) * 1e3 + (now.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+void initTeamBuilderConfig(TeamBuilderConfig* config) {
+    memset(config, 0, sizeof(TeamBuilderConfig));
+    config->opponentTeams = 24;
+    config->gamesPerOpponent = 2;
+    config->maxCandidates = 256;
+    config->threads = 0;
+    config->seed = 1;
+}
+
+// Time sorteado sem repetir monstro
+static void sampleOpponent(TeamSpec* spec, BattleRng* rng, int monsterCount) {
+    memset(spec, 0, sizeof(TeamSpec));
+    while (spec->count < TEAM_BUILDER_SIZE) {
+        int index = battleRngRange(rng, monsterCount);
+        bool repeated = false;
+        for (int i = 0; i < spec->count; i++) {
+            repeated = repeated || spec->indices[i] == index;
+        }
+        if (!repeated) {
+            spec->indices[spec->count++] = index;
+        }
+    }
+}
+
+static float teamCoverage(const TeamBuilder* builder, const int* team) {
+    float total = 0.0f;
+    for (int o = 0; o < builder->opponentCount; o++) {
+        for (int i = 0; i < builder->opponents[o].count; i++) {
+            int foe = builder->opponents[o].indices[i];
+            float best = getMatchupScoreByIndex(team[0], foe);
+            for (int m = 1; m < TEAM_BUILDER_SIZE; m++) {
+                float score = getMatchupScoreByIndex(team[m], foe);
+                best = score > best ? score : best;
+            }
+            total += best;
+        }
+    }
+    return total / (builder->opponentCount * TEAM_BUILDER_SIZE);
+}
+
+static bool containsRequired(const TeamBuilderConfig* config, const int* team) {
+    for (int r = 0; r < config->requiredCount; r++) {
+        if (team[0] != config->required[r] && team[1] != config->required[r] && team[2] != config->required[r]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Maior nota barata primeiro; no empate, a ordem dos índices
+static int compareCandidates(const void* a, const void* b) {
+    const TeamCandidate* first = (const TeamCandidate*)a;
+    const TeamCandidate* second = (const TeamCandidate*)b;
+    if (first->team.coverage != second->team.coverage) {
+        return first->team.coverage > second->team.coverage ? -1 : 1;
+    }
+    for (int i = 0; i < TEAM_BUILDER_SIZE; i++) {
+        if (first->team.indices[i] != second->team.indices[i]) {
+            return first->team.indices[i] - second->team.indices[i];
+        }
+    }
+    return 0;
+}
+
+// Nota barata de todos os times contra o grupo atual, em ordem
+static void rankTeams(TeamBuilder* builder) {
+    for (long i = 0; i < builder->teamsTotal; i++) {
+        builder->candidates[i].team.coverage = teamCoverage(builder, builder->candidates[i].team.indices);
+    }
+    qsort(builder->candidates, builder->teamsTotal, sizeof(TeamCandidate), compareCandidates);
+}
+
+// Etapa barata: nota de todos os times e poda
+static bool scoreAllTeams(TeamBuilder* builder, BattleRng* rng) {
+    int count = getMonsterCount();
+    long total = (long)count * (count - 1) * (count - 2) / 6;
+    builder->candidates = (TeamCandidate*)calloc(total, sizeof(TeamCandidate));
+    if (builder->candidates == NULL) {
+        return false;
+    }
+
+    long teams = 0;
+    for (int a = 0; a < count; a++) {
+        for (int b = a + 1; b < count; b++) {
+            for (int c = b + 1; c < count; c++) {
+                TeamCandidate* candidate = &builder->candidates[teams++];
+                candidate->builder = builder;
+                candidate->team.indices[0] = a;
+                candidate->team.indices[1] = b;
+                candidate->team.indices[2] = c;
+            }
+        }
+    }
+    builder->teamsTotal = teams;
+
+    // Metade do grupo é sorteada; a outra metade sai dos times que vão bem
+    // contra ela, senão os candidatos vencem quase tudo e empatam em 100%
+    int randomCount = (builder->config.opponentTeams + 1) / 2;
+    for (int o = 0; o < randomCount; o++) {
+        sampleOpponent(&builder->opponents[builder->opponentCount++], rng, count);
+    }
+    rankTeams(builder);
+    int metaPool = teams < TEAM_BUILDER_META_POOL ? (int)teams : TEAM_BUILDER_META_POOL;
+    while (builder->opponentCount < builder->config.opponentTeams) {
+        TeamSpec* spec = &builder->opponents[builder->opponentCount++];
+        memset(spec, 0, sizeof(TeamSpec));
+        memcpy(spec->indices, builder->candidates[battleRngRange(rng, metaPool)].team.indices,
+               sizeof(int) * TEAM_BUILDER_SIZE);
+        spec->count = TEAM_BUILDER_SIZE;
+    }
+
+    // Só concorrem os times com os monstros exigidos
+    long kept = 0;
+    for (long i = 0; i < teams; i++) {
+        if (containsRequired(&builder->config, builder->candidates[i].team.indices)) {
+            builder->candidates[kept++] = builder->candidates[i];
+        }
+    }
+    builder->teamsTotal = kept;
+    rankTeams(builder);
+
+    long candidates = kept < builder->config.maxCandidates ? kept : builder->config.maxCandidates;
+    while (candidates > 1 &&
+           builder->candidates[candidates - 1].team.coverage < builder->candidates[0].team.coverage - TEAM_BUILDER_MARGIN) {
+        candidates--;
+    }
+    for (long i = 0; i < candidates; i++) {
+        builder->candidates[i].order = i;
+    }
+    builder->candidateCount = candidates;
+    return true;
+}
+
+static bool isBetterSuggestion(const TeamSuggestion* a, const TeamSuggestion* b) {
+    if (a->winRate != b->winRate) {
+        return a->winRate > b->winRate;
+    }
+    if (a->hpLeft != b->hpLeft) {
+        return a->hpLeft > b->hpLeft;
+    }
+    return a->coverage > b->coverage;
+}
+
+static void publishResult(TeamBuilder* builder, const TeamSuggestion* team) {
+    pthread_mutex_lock(&builder->lock);
+    int position = builder->bestCount;
+    while (position > 0 && isBetterSuggestion(team, &builder->best[position - 1])) {
+        position--;
+    }
+    if (position < TEAM_BUILDER_TOP) {
+        int last = builder->bestCount < TEAM_BUILDER_TOP ? builder->bestCount : TEAM_BUILDER_TOP - 1;
+        memmove(&builder->best[position + 1], &builder->best[position], sizeof(TeamSuggestion) * (last - position));
+        builder->best[position] = *team;
+        if (builder->bestCount < TEAM_BUILDER_TOP) {
+            builder->bestCount++;
+        }
+    }
+    pthread_mutex_unlock(&builder->lock);
+}
+
+static float teamHpFraction(const MonsterList* team) {
+    int hp = 0, maxHp = 0;
+    for (PokeMonster* monster = team->first; monster != NULL; monster = monster->next) {
+        hp += monster->hp;
+        maxHp += monster->maxHp;
+    }
+    return maxHp > 0 ? (float)hp / maxHp : 0.0f;
+}
+
+// Um candidato contra o grupo inteiro
+static void evaluateCandidate(void* arg, int workerIndex) {
+    TeamCandidate* candidate = (TeamCandidate*)arg;
+    TeamBuilder* builder = candidate->builder;
+    if (atomic_load(&builder->cancelled)) {
+        return;
+    }
+
+    BattleContext* ctx = builder->contexts[workerIndex];
+    seedBattleContext(ctx, builder->config.seed ^ ((uint64_t)(candidate->order + 1) * 0x9E3779B97F4A7C15ULL));
+
+    TeamSpec spec;
+    memset(&spec, 0, sizeof(TeamSpec));
+    memcpy(spec.indices, candidate->team.indices, sizeof(candidate->team.indices));
+    spec.count = TEAM_BUILDER_SIZE;
+
+    float points = 0.0f;
+    float hpLeft = 0.0f;
+    int games = 0;
+    for (int o = 0; o < builder->opponentCount; o++) {
+        for (int g = 0; g < builder->config.gamesPerOpponent; g++) {
+            if (atomic_load(&builder->cancelled)) {
+                return;
+            }
+            MonsterList* player = createTeamFromSpec(&spec, &ctx->rng);
+            MonsterList* opponent = createTeamFromSpec(&builder->opponents[o], &ctx->rng);
+            if (player == NULL || opponent == NULL) {
+                // Sem memória para os times: a partida não conta
+                freeMonsterList(player);
+                freeMonsterList(opponent);
+                continue;
+            }
+            int winner = playHeadlessBattle(ctx, player, opponent, BOT_POLICY_GREEDY, BOT_POLICY_GREEDY,
+                                            TEAM_BUILDER_MAX_TURNS);
+            points += winner == 1 ? 1.0f : (winner == 0 ? 0.5f : 0.0f);
+            hpLeft += teamHpFraction(player);
+            games++;
+            freeMonsterList(player);
+            freeMonsterList(opponent);
+        }
+    }
+    atomic_fetch_add(&builder->battles, games);
+
+    candidate->team.winRate = games > 0 ? points / games : 0.0f;
+    candidate->team.hpLeft = games > 0 ? hpLeft / games : 0.0f;
+    publishResult(builder, &candidate->team);
+
+    if (atomic_fetch_add(&builder->evaluated, 1) + 1 == builder->candidateCount) {
+        pthread_mutex_lock(&builder->lock);
+        builder->finishedMs = elapsedSince(&builder->start);
+        pthread_mutex_unlock(&builder->lock);
+    }
+}
+
+static void freeBuilder(TeamBuilder* builder) {
+    if (builder->contexts != NULL) {
+        int threads = builder->pool != NULL ? getWorkPoolThreadCount(builder->pool) : 0;
+        for (int i = 0; i < threads; i++) {
+            freeBattleContext(builder->contexts[i]);
+        }
+        free(builder->contexts);
+    }
+    if (builder->pool != NULL) {
+        freeWorkPool(builder->pool);
+    }
+    pthread_mutex_destroy(&builder->lock);
+    free(builder->candidates);
+    free(builder);
+}
+
+TeamBuilder* startTeamBuilder(const TeamBuilderConfig* config) {
+    if (getMonsterCount() < TEAM_BUILDER_SIZE || matchupMatrix.count != getMonsterCount()) {
+        printf("ERRO: banco de monstros ou matriz de confrontos não inicializados\n");
+        return NULL;
+    }
+
+    TeamBuilder* builder = (TeamBuilder*)calloc(1, sizeof(TeamBuilder));
+    if (builder == NULL) {
+        return NULL;
+    }
+    builder->config = *config;
+    if (builder->config.opponentTeams < 1) builder->config.opponentTeams = 1;
+    if (builder->config.opponentTeams > TEAM_BUILDER_MAX_OPPONENTS) builder->config.opponentTeams = TEAM_BUILDER_MAX_OPPONENTS;
+    if (builder->config.gamesPerOpponent < 1) builder->config.gamesPerOpponent = 1;
+    if (builder->config.maxCandidates < 1) builder->config.maxCandidates = 1;
+    pthread_mutex_init(&builder->lock, NULL);
+    atomic_init(&builder->cancelled, false);
+    atomic_init(&builder->evaluated, 0);
+    atomic_init(&builder->battles, 0);
+    timespec_get(&builder->start, TIME_UTC);
+
+    BattleRng rng;
+    battleRngSeed(&rng, builder->config.seed);
+    if (!scoreAllTeams(builder, &rng)) {
+        printf("ERRO: Falha ao alocar os times da sugestão\n");
+        freeBuilder(builder);
+        return NULL;
+    }
+
+    int threads = builder->config.threads;
+    if (threads <= 0) {
+        threads = getCpuCount() > 1 ? getCpuCount() - 1 : 1;
+    }
+    builder->pool = createWorkPool(threads);
+    if (builder->pool == NULL) {
+        freeBuilder(builder);
+        return NULL;
+    }
+    threads = getWorkPoolThreadCount(builder->pool);
+    builder->contexts = (BattleContext**)calloc(threads, sizeof(BattleContext*));
+    if (builder->contexts == NULL) {
+        freeBuilder(builder);
+        return NULL;
+    }
+    for (int i = 0; i < threads; i++) {
+        builder->contexts[i] = createBattleContext();
+        if (builder->contexts[i] == NULL) {
+            freeBuilder(builder);
+            return NULL;
+        }
+        // As batalhas das threads não vão para o console
+        builder->contexts[i]->debugLog = false;
+    }
+
+    for (long i = 0; i < builder->candidateCount; i++) {
+        submitWorkTask(builder->pool, evaluateCandidate, &builder->candidates[i]);
+    }
+    return builder;
+}
+
+void getTeamBuilderProgress(TeamBuilder* builder, TeamBuilderProgress* progress) {
+    memset(progress, 0, sizeof(TeamBuilderProgress));
+    if (builder == NULL) {
+        return;
+    }
+
+    progress->teamsTotal = builder->teamsTotal;
+    progress->candidates = builder->candidateCount;
+    progress->evaluated = atomic_load(&builder->evaluated);
+    progress->battles = atomic_load(&builder->battles);
+
+    pthread_mutex_lock(&builder->lock);
+    progress->finished = builder->candidateCount == 0 || builder->finishedMs > 0.0;
+    progress->bestCount = builder->bestCount;
+    memcpy(progress->best, builder->best, sizeof(builder->best));
+    progress->elapsedMs = progress->finished ? builder->finishedMs : elapsedSince(&builder->start);
+    pthread_mutex_unlock(&builder->lock);
+}
+
+void stopTeamBuilder(TeamBuilder* builder) {
+    if (builder == NULL) {
+        return;
+    }
+    atomic_store(&builder->cancelled, true);
+    waitWorkPool(builder->pool);
+    freeBuilder(builder);
+}
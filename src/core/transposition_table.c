@@ -0,0 +1,165 @@
+/**
+ * PokeBattle - Tabela de transposição
+ *
+ * Os dados de uma entrada cabem em 64 bits:
+ *   bits  0-31  valor (float)
+ *   bits 32-39  profundidade
+ *   bits 40-41  tipo do valor
+ *   bits 42-43  ação
+ *   bits 44-51  parâmetro
+ *   bit  63     entrada ocupada
+ * A outra palavra guarda hash ^ dados. As leituras e escritas são
+ * relaxadas: a verificação pelo XOR descarta entradas misturadas.
+ */
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "transposition_table.h"
+
+#define TT_USED_BIT (1ULL << 63)
+
+typedef struct {
+    atomic_uint_least64_t check;    // hash ^ data
+    atomic_uint_least64_t data;
+} TranspositionSlot;
+
+struct TranspositionTable {
+    TranspositionSlot* slots;       // Duas por posição: profunda e recente
+    uint64_t mask;
+    atomic_uint_least64_t probes;
+    atomic_uint_least64_t hits;
+    atomic_uint_least64_t stores;
+};
+
+static uint64_t packEntry(const TranspositionEntry* entry) {
+    uint32_t valueBits;
+    memcpy(&valueBits, &entry->value, sizeof(valueBits));
+    int depth = entry->depth < 0 ? 0 : (entry->depth > 255 ? 255 : entry->depth);
+
+    return (uint64_t)valueBits |
+           ((uint64_t)depth << 32) |
+           ((uint64_t)(entry->bound & 0x3) << 40) |
+           ((uint64_t)(entry->action & 0x3) << 42) |
+           ((uint64_t)(entry->parameter & 0xFF) << 44) |
+           TT_USED_BIT;
+}
+
+static void unpackEntry(uint64_t data, TranspositionEntry* entry) {
+    uint32_t valueBits = (uint32_t)data;
+    memcpy(&entry->value, &valueBits, sizeof(valueBits));
+    entry->depth = (int)((data >> 32) & 0xFF);
+    entry->bound = (TranspositionBound)((data >> 40) & 0x3);
+    entry->action = (int)((data >> 42) & 0x3);
+    entry->parameter = (int)((data >> 44) & 0xFF);
+}
+
+static int entryDepth(uint64_t data) {
+    return (int)((data >> 32) & 0xFF);
+}
+
+TranspositionTable* createTranspositionTable(int sizeLog2) {
+    if (sizeLog2 < 1 || sizeLog2 > 30) {
+        printf("ERRO: tamanho inválido para a tabela de transposição: 2^%d\n", sizeLog2);
+        return NULL;
+    }
+
+    TranspositionTable* table = (TranspositionTable*)malloc(sizeof(TranspositionTable));
+    if (table == NULL) {
+        return NULL;
+    }
+
+    size_t positions = (size_t)1 << sizeLog2;
+    table->slots = (TranspositionSlot*)malloc(positions * 2 * sizeof(TranspositionSlot));
+    if (table->slots == NULL) {
+        printf("ERRO: sem memória para a tabela de transposição (%zu posições)\n", positions);
+        free(table);
+        return NULL;
+    }
+    table->mask = positions - 1;
+    clearTranspositionTable(table);
+    return table;
+}
+
+void freeTranspositionTable(TranspositionTable* table) {
+    if (table == NULL) {
+        return;
+    }
+    free(table->slots);
+    free(table);
+}
+
+void clearTranspositionTable(TranspositionTable* table) {
+    if (table == NULL) {
+        return;
+    }
+
+    size_t count = (size_t)(table->mask + 1) * 2;
+    for (size_t i = 0; i < count; i++) {
+        atomic_init(&table->slots[i].check, 0);
+        atomic_init(&table->slots[i].data, 0);
+    }
+    atomic_init(&table->probes, 0);
+    atomic_init(&table->hits, 0);
+    atomic_init(&table->stores, 0);
+}
+
+// Dados da entrada se ela é deste hash (0 se não)
+static uint64_t readSlot(TranspositionSlot* slot, uint64_t hash) {
+    uint64_t data = atomic_load_explicit(&slot->data, memory_order_relaxed);
+    uint64_t check = atomic_load_explicit(&slot->check, memory_order_relaxed);
+    return ((data & TT_USED_BIT) && (check ^ data) == hash) ? data : 0;
+}
+
+static void writeSlot(TranspositionSlot* slot, uint64_t hash, uint64_t data) {
+    atomic_store_explicit(&slot->data, data, memory_order_relaxed);
+    atomic_store_explicit(&slot->check, hash ^ data, memory_order_relaxed);
+}
+
+bool probeTransposition(TranspositionTable* table, uint64_t hash, TranspositionEntry* entry) {
+    TranspositionSlot* slots = &table->slots[(hash & table->mask) * 2];
+    atomic_fetch_add_explicit(&table->probes, 1, memory_order_relaxed);
+
+    // As duas podem ter o mesmo estado: vale a mais profunda
+    uint64_t deep = readSlot(&slots[0], hash);
+    uint64_t recent = readSlot(&slots[1], hash);
+    uint64_t data = (deep != 0 && (recent == 0 || entryDepth(deep) >= entryDepth(recent))) ? deep : recent;
+    if (data == 0) {
+        return false;
+    }
+
+    atomic_fetch_add_explicit(&table->hits, 1, memory_order_relaxed);
+    unpackEntry(data, entry);
+    return true;
+}
+
+void storeTransposition(TranspositionTable* table, uint64_t hash, const TranspositionEntry* entry) {
+    TranspositionSlot* slots = &table->slots[(hash & table->mask) * 2];
+    uint64_t data = packEntry(entry);
+    atomic_fetch_add_explicit(&table->stores, 1, memory_order_relaxed);
+
+    // A primeira entrada só cede para uma busca pelo menos tão profunda (ou
+    // para o mesmo estado); as outras vão para a segunda
+    uint64_t deep = atomic_load_explicit(&slots[0].data, memory_order_relaxed);
+    if (!(deep & TT_USED_BIT) || readSlot(&slots[0], hash) != 0 || entryDepth(deep) <= entry->depth) {
+        writeSlot(&slots[0], hash, data);
+    } else {
+        writeSlot(&slots[1], hash, data);
+    }
+}
+
+TranspositionStats getTranspositionStats(const TranspositionTable* table) {
+    TranspositionStats stats = { 0, 0, 0, 0.0 };
+    if (table == NULL) {
+        return stats;
+    }
+
+    // Os contadores são atômicos; a leitura não altera a tabela
+    TranspositionTable* counters = (TranspositionTable*)table;
+    stats.probes = atomic_load_explicit(&counters->probes, memory_order_relaxed);
+    stats.hits = atomic_load_explicit(&counters->hits, memory_order_relaxed);
+    stats.stores = atomic_load_explicit(&counters->stores, memory_order_relaxed);
+    stats.hitRate = stats.probes > 0 ? (double)stats.hits / stats.probes : 0.0;
+    return stats;
+}
@@ -0,0 +1,308 @@
+/**
+ * PokeBattle - Pool de threads com roubo de tarefas
+ *
+ * As filas são anéis que crescem quando enchem, cada uma com seu mutex. O
+ * dono empilha e desempilha pelo fim (LIFO, bom para cache); os ladrões
+ * tiram do começo (FIFO), pegando as tarefas mais antigas e maiores.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "work_pool.h"
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <unistd.h>
+#endif
+
+typedef struct {
+    WorkTask task;
+    void* arg;
+} WorkItem;
+
+typedef struct {
+    pthread_mutex_t lock;
+    WorkItem* items;
+    int head;       // Próximo item a ser roubado
+    int count;
+    int capacity;
+} WorkDeque;
+
+typedef struct {
+    WorkPool* pool;
+    int index;
+} WorkerInfo;
+
+struct WorkPool {
+    pthread_t* threads;
+    WorkerInfo* workers;
+    WorkDeque* deques;
+    int threadCount;
+
+    pthread_mutex_t lock;
+    pthread_cond_t workAvailable;
+    pthread_cond_t allDone;
+    bool stopping;
+
+    atomic_long queued;     // Itens nas filas
+    atomic_long pending;    // Enviadas e ainda não terminadas
+    atomic_long steals;
+    atomic_uint nextDeque;  // Distribuição das tarefas enviadas de fora
+};
+
+// Qual thread do pool está rodando (para tarefas que enviam tarefas)
+static _Thread_local WorkPool* currentPool = NULL;
+static _Thread_local int currentWorker = -1;
+
+int getCpuCount(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+#endif
+}
+
+static bool pushBottom(WorkDeque* deque, WorkItem item) {
+    pthread_mutex_lock(&deque->lock);
+
+    if (deque->count == deque->capacity) {
+        int newCapacity = deque->capacity * 2;
+        WorkItem* items = (WorkItem*)malloc(sizeof(WorkItem) * newCapacity);
+        if (items == NULL) {
+            pthread_mutex_unlock(&deque->lock);
+            return false;
+        }
+        for (int i = 0; i < deque->count; i++) {
+            items[i] = deque->items[(deque->head + i) % deque->capacity];
+        }
+        free(deque->items);
+        deque->items = items;
+        deque->head = 0;
+        deque->capacity = newCapacity;
+    }
+
+    deque->items[(deque->head + deque->count) % deque->capacity] = item;
+    deque->count++;
+
+    pthread_mutex_unlock(&deque->lock);
+    return true;
+}
+
+static bool popBottom(WorkDeque* deque, WorkItem* item) {
+    bool found = false;
+    pthread_mutex_lock(&deque->lock);
+    if (deque->count > 0) {
+        deque->count--;
+        *item = deque->items[(deque->head + deque->count) % deque->capacity];
+        found = true;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+static bool stealTop(WorkDeque* deque, WorkItem* item) {
+    bool found = false;
+    pthread_mutex_lock(&deque->lock);
+    if (deque->count > 0) {
+        *item = deque->items[deque->head];
+        deque->head = (deque->head + 1) % deque->capacity;
+        deque->count--;
+        found = true;
+    }
+    pthread_mutex_unlock(&deque->lock);
+    return found;
+}
+
+// Pega trabalho da própria fila ou rouba de outra
+static bool takeWork(WorkPool* pool, int self, WorkItem* item) {
+    if (popBottom(&pool->deques[self], item)) {
+        return true;
+    }
+
+    for (int offset = 1; offset < pool->threadCount; offset++) {
+        int victim = (self + offset) % pool->threadCount;
+        if (stealTop(&pool->deques[victim], item)) {
+            atomic_fetch_add(&pool->steals, 1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void* workerMain(void* arg) {
+    WorkerInfo* info = (WorkerInfo*)arg;
+    WorkPool* pool = info->pool;
+    int self = info->index;
+
+    currentPool = pool;
+    currentWorker = self;
+
+    while (true) {
+        WorkItem item;
+        if (takeWork(pool, self, &item)) {
+            atomic_fetch_sub(&pool->queued, 1);
+            item.task(item.arg, self);
+
+            if (atomic_fetch_sub(&pool->pending, 1) == 1) {
+                pthread_mutex_lock(&pool->lock);
+                pthread_cond_broadcast(&pool->allDone);
+                pthread_mutex_unlock(&pool->lock);
+            }
+            continue;
+        }
+
+        // Nada para fazer: dormir até chegar trabalho
+        pthread_mutex_lock(&pool->lock);
+        while (atomic_load(&pool->queued) == 0 && !pool->stopping) {
+            pthread_cond_wait(&pool->workAvailable, &pool->lock);
+        }
+        bool stop = pool->stopping && atomic_load(&pool->queued) == 0;
+        pthread_mutex_unlock(&pool->lock);
+
+        if (stop) {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+WorkPool* createWorkPool(int threadCount) {
+    if (threadCount <= 0) {
+        threadCount = getCpuCount();
+    }
+
+    WorkPool* pool = (WorkPool*)calloc(1, sizeof(WorkPool));
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    pool->threadCount = threadCount;
+    pool->threads = (pthread_t*)calloc(threadCount, sizeof(pthread_t));
+    pool->workers = (WorkerInfo*)calloc(threadCount, sizeof(WorkerInfo));
+    pool->deques = (WorkDeque*)calloc(threadCount, sizeof(WorkDeque));
+    if (pool->threads == NULL || pool->workers == NULL || pool->deques == NULL) {
+        free(pool->threads);
+        free(pool->workers);
+        free(pool->deques);
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->workAvailable, NULL);
+    pthread_cond_init(&pool->allDone, NULL);
+    atomic_init(&pool->queued, 0);
+    atomic_init(&pool->pending, 0);
+    atomic_init(&pool->steals, 0);
+    atomic_init(&pool->nextDeque, 0);
+
+    for (int i = 0; i < threadCount; i++) {
+        WorkDeque* deque = &pool->deques[i];
+        pthread_mutex_init(&deque->lock, NULL);
+        deque->capacity = 64;
+        deque->items = (WorkItem*)malloc(sizeof(WorkItem) * deque->capacity);
+    }
+
+    for (int i = 0; i < threadCount; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+        if (pthread_create(&pool->threads[i], NULL, workerMain, &pool->workers[i]) != 0) {
+            printf("ERRO: não foi possível criar a thread %d do pool\n", i);
+            for (int j = i; j < threadCount; j++) {
+                pthread_mutex_destroy(&pool->deques[j].lock);
+                free(pool->deques[j].items);
+            }
+            pool->threadCount = i;
+            break;
+        }
+    }
+
+    return pool;
+}
+
+void freeWorkPool(WorkPool* pool) {
+    if (pool == NULL) {
+        return;
+    }
+
+    waitWorkPool(pool);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = true;
+    pthread_cond_broadcast(&pool->workAvailable);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < pool->threadCount; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+
+    for (int i = 0; i < pool->threadCount; i++) {
+        pthread_mutex_destroy(&pool->deques[i].lock);
+        free(pool->deques[i].items);
+    }
+
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->workAvailable);
+    pthread_cond_destroy(&pool->allDone);
+
+    free(pool->threads);
+    free(pool->workers);
+    free(pool->deques);
+    free(pool);
+}
+
+int getWorkPoolThreadCount(const WorkPool* pool) {
+    return pool ? pool->threadCount : 0;
+}
+
+bool submitWorkTask(WorkPool* pool, WorkTask task, void* arg) {
+    if (pool == NULL || task == NULL || pool->threadCount == 0) {
+        return false;
+    }
+
+    int target;
+    if (currentPool == pool && currentWorker >= 0) {
+        target = currentWorker;
+    } else {
+        target = (int)(atomic_fetch_add(&pool->nextDeque, 1) % (unsigned)pool->threadCount);
+    }
+
+    atomic_fetch_add(&pool->pending, 1);
+    atomic_fetch_add(&pool->queued, 1);
+    WorkItem item = {task, arg};
+    if (!pushBottom(&pool->deques[target], item)) {
+        atomic_fetch_sub(&pool->queued, 1);
+        atomic_fetch_sub(&pool->pending, 1);
+        return false;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pthread_cond_signal(&pool->workAvailable);
+    pthread_mutex_unlock(&pool->lock);
+    return true;
+}
+
+void waitWorkPool(WorkPool* pool) {
+    if (pool == NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    while (atomic_load(&pool->pending) > 0) {
+        pthread_cond_wait(&pool->allDone, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+long getWorkPoolSteals(const WorkPool* pool) {
+    return pool ? atomic_load(&((WorkPool*)pool)->steals) : 0;
+}
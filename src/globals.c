@@ -20,13 +20,8 @@ bool vsBot = true;
 bool playerTurn = true;
 bool gameInitialized = false;
 
-// Sistema de batalha
-BattleSystem* battleSystem = NULL;
-bool actionQueueReady = false;
-char battleMessage[256] = "";
-BattleMessage currentMessage = {0};
-BattleAnimation currentAnimation = {0};
-float stateTransitionDelay = 0.0f;
+// Sistema de batalha (mensagens, animação e fila ficam dentro do contexto)
+BattleContext* battleSystem = NULL;
 
 // Variáveis de configuração
 bool fullscreen = false;
@@ -36,6 +31,7 @@ bool hasUnsavedChanges = false;
 float pendingMusicVolume = 0.7f;
 float pendingSoundVolume = 0.8f;
 bool pendingFullscreen = false;
+int difficultyIndex = 1;         // Nível do bot local (BOT_DIFFICULTY_* em battle.h)
 int pendingDifficultyIndex = 1;
 int pendingAnimSpeedIndex = 1;
 
@@ -76,15 +72,6 @@ void initializeGlobals(void) {
     playerTurn = true;
     gameInitialized = false;
 
-    // Limpar strings
-    memset(battleMessage, 0, sizeof(battleMessage));
-    memset(&currentMessage, 0, sizeof(currentMessage));
-    memset(&currentAnimation, 0, sizeof(currentAnimation));
-
-    // Inicializar sistema de batalha
-    actionQueueReady = false;
-    stateTransitionDelay = 0.0f;
-
     // Configurações
     musicVolume = 0.7f;
     soundVolume = 0.8f;
@@ -92,7 +79,8 @@ void initializeGlobals(void) {
     pendingMusicVolume = musicVolume;
     pendingSoundVolume = soundVolume;
     pendingFullscreen = fullscreen;
-    pendingDifficultyIndex = 1;
+    difficultyIndex = 1;
+    pendingDifficultyIndex = difficultyIndex;
     pendingAnimSpeedIndex = 1;
     hasUnsavedChanges = false;
 
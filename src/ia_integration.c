@@ -15,13 +15,16 @@
 #include <string.h>
 #include <curl/curl.h>
 #include "ia_integration.h"
+#include "ia_worker.h"
+#include "ia_response.h"
 #include "structures.h"
 #include "monsters.h"
 #include "battle.h"
 #include "globals.h"
 #include <ctype.h>
+#include <stdarg.h>
 
-extern BattleSystem* battleSystem;
+extern BattleContext* battleSystem;
 
  
  // Chave da API(em um sistema real, seria obtida de uma variável de ambiente ou arquivo seguro)
@@ -31,26 +34,54 @@ extern BattleSystem* battleSystem;
  static const char* MODEL = "gemini-1.5-flash-latest";
 
  
- // Função de callback para escrever os dados recebidos na memória
- static size_t WriteMemoryCallback(void* contents, size_t size, size_t nmemb, void* userp) {
-     size_t realsize = size * nmemb;
-     MemoryStruct* mem = (MemoryStruct*)userp;
- 
-     // Realoca o buffer para acomodar os novos dados + terminador nulo
-     char* ptr = realloc(mem->buffer, mem->size + realsize + 1);
-     if (ptr == NULL) {
-         fprintf(stderr, "Erro: falha ao alocar memória no callback!\n");
-         return 0; // Retornar 0 sinaliza erro para libcurl
+ // URL do endpoint generateContent do modelo, com a chave
+ const char* getAIEndpointUrl(void) {
+     static char api_url[512];
+     if (api_url[0] == '\0') {
+         snprintf(api_url, sizeof(api_url),
+                  "https://generativelanguage.googleapis.com/v1beta/models/%s:generateContent?key=%s",
+                  MODEL, API_KEY);
      }
- 
-     mem->buffer = ptr;
-     memcpy(&(mem->buffer[mem->size]), contents, realsize);
-     mem->size += realsize;
-     mem->buffer[mem->size] = 0; // Adiciona terminador nulo
- 
-     return realsize;
+     return api_url;
  }
- 
+
+ // Monta o corpo JSON da requisição. O prompt é escapado (quebras de linha
+ // e aspas dos prompts do bot não podem ir cruas dentro da string JSON)
+ char* buildAIRequestPayload(const char* prompt) {
+     static const char prefix[] = "{\"contents\":[{\"parts\":[{\"text\":\"";
+     static const char suffix[] = "\"}]}]}";
+
+     size_t length = strlen(prompt);
+     // Pior caso: todo caractere vira \u00XX
+     char* payload = malloc(sizeof(prefix) + length * 6 + sizeof(suffix));
+     if (payload == NULL) {
+         return NULL;
+     }
+
+     char* out = payload;
+     memcpy(out, prefix, sizeof(prefix) - 1);
+     out += sizeof(prefix) - 1;
+
+     for (const unsigned char* in = (const unsigned char*)prompt; *in; in++) {
+         switch (*in) {
+             case '"':  *out++ = '\\'; *out++ = '"'; break;
+             case '\\': *out++ = '\\'; *out++ = '\\'; break;
+             case '\n': *out++ = '\\'; *out++ = 'n'; break;
+             case '\r': *out++ = '\\'; *out++ = 'r'; break;
+             case '\t': *out++ = '\\'; *out++ = 't'; break;
+             default:
+                 if (*in < 0x20) {
+                     out += sprintf(out, "\\u%04x", *in);
+                 } else {
+                     *out++ = (char)*in;
+                 }
+         }
+     }
+
+     memcpy(out, suffix, sizeof(suffix));
+     return payload;
+ }
+
  // Inicializa a conexão com a API de IA
  bool initializeAI(void) {
      // Já inicializado
@@ -74,6 +105,11 @@ extern BattleSystem* battleSystem;
      curl_easy_setopt(curl_handle, CURLOPT_FOLLOWLOCATION, 1L);
      curl_easy_setopt(curl_handle, CURLOPT_SSL_VERIFYPEER, 0L);
      curl_easy_setopt(curl_handle, CURLOPT_SSL_VERIFYHOST, 0L);
+
+     // Thread das consultas do bot (sem ela o bot decide localmente)
+     if (!startAIWorker()) {
+         fprintf(stderr, "Erro ao iniciar a thread de consultas da IA.\n");
+     }
      
      initialized = true;
      return true;
@@ -85,6 +121,9 @@ extern BattleSystem* battleSystem;
          return;
      }
      
+     // Consultas em andamento são canceladas
+     stopAIWorker();
+
      // Liberar o handle
      if (curl_handle) {
          curl_easy_cleanup(curl_handle);
@@ -103,30 +142,21 @@ extern BattleSystem* battleSystem;
          return strdup("Erro: API de IA não inicializada ou prompt inválido.");
      }
      
-     // Criar a URL da API com a chave
-     char api_url[512];
-     snprintf(api_url, sizeof(api_url),
-              "https://generativelanguage.googleapis.com/v1beta/models/%s:generateContent?key=%s",
-              MODEL, API_KEY);
-     
-              
      // Montar o payload JSON para a requisição
-     char json_payload[MAX_PROMPT_SIZE + 256]; // +256 para os campos do JSON
-     snprintf(json_payload, sizeof(json_payload),
-              "{\"contents\":[{\"parts\":[{\"text\":\"%s\"}]}]}",
-              prompt);
-     
-     // Estrutura para armazenar a resposta
-     MemoryStruct chunk;
-     chunk.buffer = malloc(1);
-     chunk.size = 0;
+     char* json_payload = buildAIRequestPayload(prompt);
+     if (json_payload == NULL) {
+         return strdup("Erro: Falha ao alocar memória para a requisição.");
+     }
      
-     if (chunk.buffer == NULL) {
+     // A resposta é lida enquanto chega; só o texto fica guardado
+     AIResponseParser parser;
+     if (!initAIResponseParser(&parser, 0)) {
+         free(json_payload);
          return strdup("Erro: Falha ao alocar memória para a resposta.");
      }
      
      // Configurar a requisição
-     curl_easy_setopt(curl_handle, CURLOPT_URL, api_url);
+     curl_easy_setopt(curl_handle, CURLOPT_URL, getAIEndpointUrl());
      curl_easy_setopt(curl_handle, CURLOPT_POST, 1L);
      curl_easy_setopt(curl_handle, CURLOPT_POSTFIELDS, json_payload);
      
@@ -136,63 +166,27 @@ extern BattleSystem* battleSystem;
      curl_easy_setopt(curl_handle, CURLOPT_HTTPHEADER, headers);
      
      // Configurar callbacks para receber a resposta
-     curl_easy_setopt(curl_handle, CURLOPT_WRITEFUNCTION, WriteMemoryCallback);
-     curl_easy_setopt(curl_handle, CURLOPT_WRITEDATA, (void*)&chunk);
+     curl_easy_setopt(curl_handle, CURLOPT_WRITEFUNCTION, aiResponseWriteCallback);
+     curl_easy_setopt(curl_handle, CURLOPT_WRITEDATA, (void*)&parser);
      
      // Executar a requisição
      CURLcode res = curl_easy_perform(curl_handle);
      
      // Liberar os cabeçalhos
      curl_slist_free_all(headers);
+     free(json_payload);
      
      // Verificar resultado
      if (res != CURLE_OK) {
-         free(chunk.buffer);
+         freeAIResponseParser(&parser);
          char* error = (char*)malloc(strlen(errorBuffer) + 50);
          sprintf(error, "Erro na requisição: %s", errorBuffer);
          return error;
      }
      
-     // Extrair o texto da resposta JSON
-     char* text_start = strstr(chunk.buffer, "\"text\": \"");
-     char* response_text = NULL;
-     
-     if (text_start) {
-         text_start += strlen("\"text\": \""); // Pular a marcação
-         char* text_end = strstr(text_start, "\"");
-         
-         if (text_end) {
-             // Extrair o texto da resposta
-             size_t text_length = text_end - text_start;
-             response_text = (char*)malloc(text_length + 1);
-             strncpy(response_text, text_start, text_length);
-             response_text[text_length] = '\0';
-             
-             // Limpar alguns escapes de JSON simples
-             char* write_pos = response_text;
-             for (char* read_pos = response_text; *read_pos; read_pos++) {
-                 if (*read_pos == '\\' && *(read_pos + 1) == 'n') {
-                     *write_pos++ = '\n';
-                     read_pos++;
-                 } else if (*read_pos == '\\' && *(read_pos + 1) == 't') {
-                     *write_pos++ = '\t';
-                     read_pos++;
-                 } else if (*read_pos == '\\' && *(read_pos + 1) == '\"') {
-                     *write_pos++ = '\"';
-                     read_pos++;
-                 } else if (*read_pos == '\\' && *(read_pos + 1) == '\\') {
-                     *write_pos++ = '\\';
-                     read_pos++;
-                 } else {
-                     *write_pos++ = *read_pos;
-                 }
-             }
-             *write_pos = '\0';
-         }
-     }
-     
-     // Liberar a resposta original
-     free(chunk.buffer);
+     // O texto já está decodificado no buffer do parser, que passa a ser a resposta
+     char* response_text = takeAIResponseText(&parser);
+     freeAIResponseParser(&parser);
      
      // Se não conseguiu extrair o texto, retornar uma mensagem genérica
      if (response_text == NULL) {
@@ -202,46 +196,6 @@ extern BattleSystem* battleSystem;
      return response_text;
  }
  
- // Gera uma descrição para um ataque
- char* generateAttackDescription(PokeMonster* attacker, PokeMonster* defender, Attack* attack) {
-    if (attacker == NULL || defender == NULL || attack == NULL) {
-        return strdup("Um ataque foi realizado!");
-    }
-    
-    // Buffer para a mensagem
-    char* description = (char*)malloc(256);
-    if (description == NULL) {
-        return strdup("Erro de memória!");
-    }
-    
-    // Escolher um formato de mensagem aleatoriamente
-    int format = rand() % 5;
-    
-    switch (format) {
-        case 0:
-            sprintf(description, "%s usou %s!", attacker->name, attack->name);
-            break;
-        case 1:
-            sprintf(description, "%s atacou com %s!", attacker->name, attack->name);
-            break;
-        case 2:
-            sprintf(description, "%s lançou %s contra %s!", attacker->name, attack->name, defender->name);
-            break;
-        case 3:
-            sprintf(description, "Um poderoso %s foi usado por %s!", attack->name, attacker->name);
-            break;
-        case 4:
-            sprintf(description, "%s executou %s com eficiência!", attacker->name, attack->name);
-            break;
-        default:
-            sprintf(description, "%s usou %s!", attacker->name, attack->name);
-            break;
-    }
-    
-    return description;
-}
- 
- 
  // Interpreta a resposta da API de IA para um número
 int interpretAIResponse(const char* response) {
     if (response == NULL) {
@@ -391,112 +345,123 @@ const char* getEffectDescription(int statusEffect, int statusChance) {
  }
 
 
+// Prompt da escolha de ação (0 atacar, 1 trocar, 2 item)
+void buildAIActionPrompt(PokeMonster* botMonster, PokeMonster* playerMonster, char* prompt, size_t size) {
+    snprintf(prompt, size,
+             "Você é um especialista em jogos Pokémon, analisando a melhor ação em uma batalha.\n\n"
+             "SITUAÇÃO ATUAL:\n"
+             "- MEU POKÉMON: %s (tipo primário: %s, tipo secundário: %s)\n"
+             "- MEU HP: %d/%d (%.1f%%)\n"
+             "- MEU STATUS: %s\n\n"
+             "- POKÉMON INIMIGO: %s (tipo primário: %s, tipo secundário: %s)\n"
+             "- HP INIMIGO: %d/%d (%.1f%%)\n"
+             "- STATUS INIMIGO: %s\n\n"
+             "MEUS ATAQUES:\n"
+             "0: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s)\n"
+             "1: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s)\n"
+             "2: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s)\n"
+             "3: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s)\n\n"
+             "AÇÕES POSSÍVEIS:\n"
+             "0 - ATACAR: Use um dos meus ataques listados acima\n"
+             "1 - TROCAR: Troque para outro Pokémon\n"
+             "2 - USAR ITEM: Use um item para curar ou causar efeito\n\n"
+             "Sua análise deve considerar:\n"
+             "- Vantagens de tipo (2x dano) e desvantagens (0.5x dano)\n"
+             "- Situação de HP - se estou com HP baixo, talvez deva curar ou trocar\n"
+             "- Status atuais - status negativos podem influenciar a decisão\n"
+             "- Poder dos ataques e PP restante\n\n"
+             "Responda APENAS com o número da ação (0, 1 ou 2) que representa a melhor estratégia.",
+             botMonster->name,
+             getTypeName(botMonster->type1),
+             getTypeName(botMonster->type2 != TYPE_NONE ? botMonster->type2 : botMonster->type1),
+             botMonster->hp, botMonster->maxHp, (float)botMonster->hp/botMonster->maxHp*100.0f,
+             getStatusName(botMonster->statusCondition),
+
+             playerMonster->name,
+             getTypeName(playerMonster->type1),
+             getTypeName(playerMonster->type2 != TYPE_NONE ? playerMonster->type2 : playerMonster->type1),
+             playerMonster->hp, playerMonster->maxHp, (float)playerMonster->hp/playerMonster->maxHp*100.0f,
+             getStatusName(playerMonster->statusCondition),
+
+             botMonster->attacks[0].name, getTypeName(botMonster->attacks[0].type),
+             botMonster->attacks[0].power, botMonster->attacks[0].accuracy,
+             botMonster->attacks[0].ppCurrent, botMonster->attacks[0].ppMax,
+             getEffectDescription(botMonster->attacks[0].statusEffect, botMonster->attacks[0].statusChance),
+
+             botMonster->attacks[1].name, getTypeName(botMonster->attacks[1].type),
+             botMonster->attacks[1].power, botMonster->attacks[1].accuracy,
+             botMonster->attacks[1].ppCurrent, botMonster->attacks[1].ppMax,
+             getEffectDescription(botMonster->attacks[1].statusEffect, botMonster->attacks[1].statusChance),
+
+             botMonster->attacks[2].name, getTypeName(botMonster->attacks[2].type),
+             botMonster->attacks[2].power, botMonster->attacks[2].accuracy,
+             botMonster->attacks[2].ppCurrent, botMonster->attacks[2].ppMax,
+             getEffectDescription(botMonster->attacks[2].statusEffect, botMonster->attacks[2].statusChance),
+
+             botMonster->attacks[3].name, getTypeName(botMonster->attacks[3].type),
+             botMonster->attacks[3].power, botMonster->attacks[3].accuracy,
+             botMonster->attacks[3].ppCurrent, botMonster->attacks[3].ppMax,
+             getEffectDescription(botMonster->attacks[3].statusEffect, botMonster->attacks[3].statusChance));
+}
+
+// Evita que a IA repita a mesma ação sempre: depois de 3 repetições, metade
+// das vezes troca por outra
+static int varyAIAction(BattleContext* ctx, PokeMonster* botMonster, PokeMonster* playerMonster, int action) {
+    // Verificar se está repetindo a mesma ação constantemente
+    if (action == ctx->aiLastAction) {
+        ctx->aiActionRepeatCount++;
+
+        // Se repetir a mesma ação muitas vezes seguidas, forçar variação
+        if (ctx->aiActionRepeatCount >= 3) {
+            printf("[IA Gemini] Detectada repetição excessiva! Forçando variação...\n");
+
+            // 50% de chance de usar o fallback para variar
+            if (battleRngRange(&ctx->rng, 2) == 0) {
+                ctx->aiActionRepeatCount = 0; // Resetar contador
+
+                // Usar fallback mas excluir a ação repetitiva
+                int newAction = getAISuggestedActionSimple(ctx, botMonster, playerMonster);
+                while (newAction == action) {
+                    newAction = battleRngRange(&ctx->rng, 3); // Forçar uma ação diferente aleatória
+                }
+
+                ctx->aiLastAction = newAction;
+                return newAction;
+            }
+        }
+    } else {
+        // Resetar contador se a ação for diferente
+        ctx->aiActionRepeatCount = 0;
+    }
+
+    ctx->aiLastAction = action;
+    return action;
+}
+
+// Ação a partir da resposta da IA, evitando repetir a mesma ação sempre
+int resolveAIActionResponse(BattleContext* ctx, PokeMonster* botMonster, PokeMonster* playerMonster,
+                            const char* response) {
+    printf("[IA Gemini] Decisão completa recebida: %s\n", response);
+    return varyAIAction(ctx, botMonster, playerMonster, interpretAIResponse(response));
+}
+
 // Sugere a melhor ação para o bot com sistema de fallback
-int getAISuggestedAction(PokeMonster* botMonster, PokeMonster* playerMonster) {
-    if (botMonster == NULL || playerMonster == NULL) {
+int getAISuggestedAction(BattleContext* ctx, PokeMonster* botMonster, PokeMonster* playerMonster) {
+    if (ctx == NULL || botMonster == NULL || playerMonster == NULL) {
         return 0;
     }
 
     // Tentar usar a IA Gemini primeiro
     if (initialized && curl_handle != NULL) {
-        // IMPORTANTE: Manter registro das últimas decisões para evitar repetição
-        static int lastAction = -1;
-        static int repeatCount = 0;
-
         char prompt[MAX_PROMPT_SIZE];
-        snprintf(prompt, MAX_PROMPT_SIZE,
-                 "Você é um especialista em jogos Pokémon, analisando a melhor ação em uma batalha.\n\n"
-                 "SITUAÇÃO ATUAL:\n"
-                 "- MEU POKÉMON: %s (tipo primário: %s, tipo secundário: %s)\n"
-                 "- MEU HP: %d/%d (%.1f%%)\n"
-                 "- MEU STATUS: %s\n\n"
-                 "- POKÉMON INIMIGO: %s (tipo primário: %s, tipo secundário: %s)\n"
-                 "- HP INIMIGO: %d/%d (%.1f%%)\n"
-                 "- STATUS INIMIGO: %s\n\n"
-                 "MEUS ATAQUES:\n"
-                 "0: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s)\n"
-                 "1: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s)\n"
-                 "2: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s)\n"
-                 "3: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s)\n\n"
-                 "AÇÕES POSSÍVEIS:\n"
-                 "0 - ATACAR: Use um dos meus ataques listados acima\n"
-                 "1 - TROCAR: Troque para outro Pokémon\n"
-                 "2 - USAR ITEM: Use um item para curar ou causar efeito\n\n"
-                 "Sua análise deve considerar:\n"
-                 "- Vantagens de tipo (2x dano) e desvantagens (0.5x dano)\n"
-                 "- Situação de HP - se estou com HP baixo, talvez deva curar ou trocar\n"
-                 "- Status atuais - status negativos podem influenciar a decisão\n"
-                 "- Poder dos ataques e PP restante\n\n"
-                 "Responda APENAS com o número da ação (0, 1 ou 2) que representa a melhor estratégia.",
-                 botMonster->name,
-                 getTypeName(botMonster->type1),
-                 getTypeName(botMonster->type2 != TYPE_NONE ? botMonster->type2 : botMonster->type1),
-                 botMonster->hp, botMonster->maxHp, (float)botMonster->hp/botMonster->maxHp*100.0f,
-                 getStatusName(botMonster->statusCondition),
-
-                 playerMonster->name,
-                 getTypeName(playerMonster->type1),
-                 getTypeName(playerMonster->type2 != TYPE_NONE ? playerMonster->type2 : playerMonster->type1),
-                 playerMonster->hp, playerMonster->maxHp, (float)playerMonster->hp/playerMonster->maxHp*100.0f,
-                 getStatusName(playerMonster->statusCondition),
-
-                 botMonster->attacks[0].name, getTypeName(botMonster->attacks[0].type),
-                 botMonster->attacks[0].power, botMonster->attacks[0].accuracy,
-                 botMonster->attacks[0].ppCurrent, botMonster->attacks[0].ppMax,
-                 getEffectDescription(botMonster->attacks[0].statusEffect, botMonster->attacks[0].statusChance),
-
-                 botMonster->attacks[1].name, getTypeName(botMonster->attacks[1].type),
-                 botMonster->attacks[1].power, botMonster->attacks[1].accuracy,
-                 botMonster->attacks[1].ppCurrent, botMonster->attacks[1].ppMax,
-                 getEffectDescription(botMonster->attacks[1].statusEffect, botMonster->attacks[1].statusChance),
-
-                 botMonster->attacks[2].name, getTypeName(botMonster->attacks[2].type),
-                 botMonster->attacks[2].power, botMonster->attacks[2].accuracy,
-                 botMonster->attacks[2].ppCurrent, botMonster->attacks[2].ppMax,
-                 getEffectDescription(botMonster->attacks[2].statusEffect, botMonster->attacks[2].statusChance),
-
-                 botMonster->attacks[3].name, getTypeName(botMonster->attacks[3].type),
-                 botMonster->attacks[3].power, botMonster->attacks[3].accuracy,
-                 botMonster->attacks[3].ppCurrent, botMonster->attacks[3].ppMax,
-                 getEffectDescription(botMonster->attacks[3].statusEffect, botMonster->attacks[3].statusChance));
+        buildAIActionPrompt(botMonster, playerMonster, prompt, sizeof(prompt));
 
         // Consultar a IA
         char* response = queryAI(prompt);
 
         // Processar a resposta
         if (response != NULL && strstr(response, "Erro:") != response) {
-            printf("[IA Gemini] Decisão completa recebida: %s\n", response);
-            int action = interpretAIResponse(response);
-
-            // Verificar se está repetindo a mesma ação constantemente
-            if (action == lastAction) {
-                repeatCount++;
-
-                // Se repetir a mesma ação muitas vezes seguidas, forçar variação
-                if (repeatCount >= 3) {
-                    printf("[IA Gemini] Detectada repetição excessiva! Forçando variação...\n");
-
-                    // 50% de chance de usar o fallback para variar
-                    if (rand() % 2 == 0) {
-                        free(response);
-                        repeatCount = 0; // Resetar contador
-
-                        // Usar fallback mas excluir a ação repetitiva
-                        int newAction = getAISuggestedActionSimple(botMonster, playerMonster);
-                        while (newAction == action) {
-                            newAction = rand() % 3; // Forçar uma ação diferente aleatória
-                        }
-
-                        lastAction = newAction;
-                        return newAction;
-                    }
-                }
-            } else {
-                // Resetar contador se a ação for diferente
-                repeatCount = 0;
-            }
-
-            lastAction = action;
+            int action = resolveAIActionResponse(ctx, botMonster, playerMonster, response);
             free(response);
             return action;
         }
@@ -508,7 +473,7 @@ int getAISuggestedAction(PokeMonster* botMonster, PokeMonster* playerMonster) {
 
     // Fallback para IA simples
     printf("[Sistema Simples] Tomando decisão localmente...\n");
-    int action = getAISuggestedActionSimple(botMonster, playerMonster);
+    int action = getAISuggestedActionSimple(ctx, botMonster, playerMonster);
     return action;
 }
 
@@ -529,121 +494,142 @@ const char* getStatusName(int statusCondition) {
     }
 }
 
+// Prompt da escolha de ataque, com chance de nocaute e dano médio exatos
+void buildAIAttackPrompt(PokeMonster* botMonster, PokeMonster* playerMonster, char* prompt, size_t size) {
+    snprintf(prompt, size,
+             "Você é um mestre treinador Pokémon escolhendo o melhor ataque para essa situação.\n\n"
+             "SITUAÇÃO ATUAL:\n"
+             "- MEU POKÉMON: %s (tipo primário: %s, tipo secundário: %s)\n"
+             "- MEU HP: %d/%d (%.1f%%)\n"
+             "- MEU STATUS: %s\n\n"
+             "- POKÉMON INIMIGO: %s (tipo primário: %s, tipo secundário: %s)\n"
+             "- HP INIMIGO: %d/%d (%.1f%%)\n"
+             "- STATUS INIMIGO: %s\n\n"
+             "MEUS ATAQUES DISPONÍVEIS:\n"
+             "0: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s, nocaute: %.0f%%, dano médio: %.1f)\n"
+             "1: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s, nocaute: %.0f%%, dano médio: %.1f)\n"
+             "2: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s, nocaute: %.0f%%, dano médio: %.1f)\n"
+             "3: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s, nocaute: %.0f%%, dano médio: %.1f)\n\n"
+             "LEMBRE-SE DAS REGRAS DE TIPO:\n"
+             "- Ataques super efetivos (2x dano): ataques do tipo X contra Pokémon tipo Y...\n"
+             "- Ataques não muito efetivos (0.5x dano): ataques do tipo X contra Pokémon tipo Y...\n"
+             "- Ataques sem efeito (0x dano): ataques do tipo X contra Pokémon tipo Y...\n\n"
+             "A chance de nocaute e o dano médio já contam precisão, crítico e variação do dano.\n\n"
+             "Analise cuidadosamente e responda APENAS com o número do ataque (0, 1, 2 ou 3) que você escolheria nesta situação.",
+             botMonster->name,
+             getTypeName(botMonster->type1),
+             getTypeName(botMonster->type2 != TYPE_NONE ? botMonster->type2 : botMonster->type1),
+             botMonster->hp, botMonster->maxHp, (float)botMonster->hp/botMonster->maxHp*100.0f,
+             getStatusName(botMonster->statusCondition),
+
+             playerMonster->name,
+             getTypeName(playerMonster->type1),
+             getTypeName(playerMonster->type2 != TYPE_NONE ? playerMonster->type2 : playerMonster->type1),
+             playerMonster->hp, playerMonster->maxHp, (float)playerMonster->hp/playerMonster->maxHp*100.0f,
+             getStatusName(playerMonster->statusCondition),
+
+             botMonster->attacks[0].name, getTypeName(botMonster->attacks[0].type),
+             botMonster->attacks[0].power, botMonster->attacks[0].accuracy,
+             botMonster->attacks[0].ppCurrent, botMonster->attacks[0].ppMax,
+             getEffectDescription(botMonster->attacks[0].statusEffect, botMonster->attacks[0].statusChance),
+             getKoProbability(getBattleDamageCache(), botMonster, playerMonster, 0) * 100.0,
+             getExpectedDamage(getDamageDistribution(getBattleDamageCache(), botMonster, playerMonster, 0)),
+
+             botMonster->attacks[1].name, getTypeName(botMonster->attacks[1].type),
+             botMonster->attacks[1].power, botMonster->attacks[1].accuracy,
+             botMonster->attacks[1].ppCurrent, botMonster->attacks[1].ppMax,
+             getEffectDescription(botMonster->attacks[1].statusEffect, botMonster->attacks[1].statusChance),
+             getKoProbability(getBattleDamageCache(), botMonster, playerMonster, 1) * 100.0,
+             getExpectedDamage(getDamageDistribution(getBattleDamageCache(), botMonster, playerMonster, 1)),
+
+             botMonster->attacks[2].name, getTypeName(botMonster->attacks[2].type),
+             botMonster->attacks[2].power, botMonster->attacks[2].accuracy,
+             botMonster->attacks[2].ppCurrent, botMonster->attacks[2].ppMax,
+             getEffectDescription(botMonster->attacks[2].statusEffect, botMonster->attacks[2].statusChance),
+             getKoProbability(getBattleDamageCache(), botMonster, playerMonster, 2) * 100.0,
+             getExpectedDamage(getDamageDistribution(getBattleDamageCache(), botMonster, playerMonster, 2)),
+
+             botMonster->attacks[3].name, getTypeName(botMonster->attacks[3].type),
+             botMonster->attacks[3].power, botMonster->attacks[3].accuracy,
+             botMonster->attacks[3].ppCurrent, botMonster->attacks[3].ppMax,
+             getEffectDescription(botMonster->attacks[3].statusEffect, botMonster->attacks[3].statusChance),
+             getKoProbability(getBattleDamageCache(), botMonster, playerMonster, 3) * 100.0,
+             getExpectedDamage(getDamageDistribution(getBattleDamageCache(), botMonster, playerMonster, 3)));
+}
+
+// Mesma ideia para o ataque: na terceira repetição, outro ataque com PP
+static int varyAIAttack(BattleContext* ctx, PokeMonster* botMonster, int attackIndex) {
+    // Verificar se está repetindo o mesmo ataque constantemente
+    if (attackIndex == ctx->aiLastAttack) {
+        ctx->aiAttackRepeatCount++;
+
+        // Se repetir o mesmo ataque muitas vezes seguidas, forçar variação
+        if (ctx->aiAttackRepeatCount >= 3) {
+            printf("[IA Gemini] Repetição excessiva de ataques! Forçando variação...\n");
+
+            // Encontrar alternativas válidas
+            int validAttacks[4] = {0};
+            int validCount = 0;
+
+            for (int i = 0; i < 4; i++) {
+                if (i != attackIndex && botMonster->attacks[i].ppCurrent > 0) {
+                    validAttacks[validCount++] = i;
+                }
+            }
+
+            // Se houver alternativas, escolher uma aleatoriamente
+            if (validCount > 0) {
+                int newAttack = validAttacks[battleRngRange(&ctx->rng, validCount)];
+                ctx->aiLastAttack = newAttack;
+                ctx->aiAttackRepeatCount = 0;
+                return newAttack;
+            }
+        }
+    } else {
+        // Resetar contador se o ataque for diferente
+        ctx->aiAttackRepeatCount = 0;
+    }
+
+    ctx->aiLastAttack = attackIndex;
+    return attackIndex;
+}
+
+// Ataque a partir da resposta da IA (-1 se a resposta não serve: índice
+// inválido ou ataque sem PP), evitando repetir o mesmo ataque sempre
+int resolveAIAttackResponse(BattleContext* ctx, PokeMonster* botMonster, const char* response) {
+    printf("[IA Gemini] Ataque sugerido (completo): %s\n", response);
+    int attackIndex = interpretAIResponse(response);
+
+    // Verificar se o ataque tem PP e é válido
+    if (attackIndex < 0 || attackIndex > 3 || botMonster->attacks[attackIndex].ppCurrent <= 0) {
+        printf("[IA Gemini] Ataque inválido ou sem PP. Escolhendo outro...\n");
+        return -1;
+    }
+
+    return varyAIAttack(ctx, botMonster, attackIndex);
+}
+
 // Sugere o melhor ataque para o bot com sistema de fallback
-int getAISuggestedAttack(PokeMonster* botMonster, PokeMonster* playerMonster) {
-    if (botMonster == NULL || playerMonster == NULL) {
+int getAISuggestedAttack(BattleContext* ctx, PokeMonster* botMonster, PokeMonster* playerMonster) {
+    if (ctx == NULL || botMonster == NULL || playerMonster == NULL) {
         return 0; // Ataque padrão: primeiro ataque
     }
     
     // Tentar usar a IA Gemini primeiro
     if (initialized && curl_handle != NULL) {
-        // Manter registro das últimas decisões para evitar repetição
-        static int lastAttack = -1;
-        static int repeatCount = 0;
-
-        // Formatar o prompt para a IA de forma mais detalhada e estratégica
         char prompt[MAX_PROMPT_SIZE];
-        snprintf(prompt, MAX_PROMPT_SIZE,
-                 "Você é um mestre treinador Pokémon escolhendo o melhor ataque para essa situação.\n\n"
-                 "SITUAÇÃO ATUAL:\n"
-                 "- MEU POKÉMON: %s (tipo primário: %s, tipo secundário: %s)\n"
-                 "- MEU HP: %d/%d (%.1f%%)\n"
-                 "- MEU STATUS: %s\n\n"
-                 "- POKÉMON INIMIGO: %s (tipo primário: %s, tipo secundário: %s)\n"
-                 "- HP INIMIGO: %d/%d (%.1f%%)\n"
-                 "- STATUS INIMIGO: %s\n\n"
-                 "MEUS ATAQUES DISPONÍVEIS:\n"
-                 "0: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s)\n"
-                 "1: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s)\n"
-                 "2: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s)\n"
-                 "3: %s (tipo: %s, poder: %d, precisão: %d, PP: %d/%d, efeito: %s)\n\n"
-                 "LEMBRE-SE DAS REGRAS DE TIPO:\n"
-                 "- Ataques super efetivos (2x dano): ataques do tipo X contra Pokémon tipo Y...\n"
-                 "- Ataques não muito efetivos (0.5x dano): ataques do tipo X contra Pokémon tipo Y...\n"
-                 "- Ataques sem efeito (0x dano): ataques do tipo X contra Pokémon tipo Y...\n\n"
-                 "Analise cuidadosamente e responda APENAS com o número do ataque (0, 1, 2 ou 3) que você escolheria nesta situação.",
-                 botMonster->name,
-                 getTypeName(botMonster->type1),
-                 getTypeName(botMonster->type2 != TYPE_NONE ? botMonster->type2 : botMonster->type1),
-                 botMonster->hp, botMonster->maxHp, (float)botMonster->hp/botMonster->maxHp*100.0f,
-                 getStatusName(botMonster->statusCondition),
-
-                 playerMonster->name,
-                 getTypeName(playerMonster->type1),
-                 getTypeName(playerMonster->type2 != TYPE_NONE ? playerMonster->type2 : playerMonster->type1),
-                 playerMonster->hp, playerMonster->maxHp, (float)playerMonster->hp/playerMonster->maxHp*100.0f,
-                 getStatusName(playerMonster->statusCondition),
-
-                 botMonster->attacks[0].name, getTypeName(botMonster->attacks[0].type),
-                 botMonster->attacks[0].power, botMonster->attacks[0].accuracy,
-                 botMonster->attacks[0].ppCurrent, botMonster->attacks[0].ppMax,
-                 getEffectDescription(botMonster->attacks[0].statusEffect, botMonster->attacks[0].statusChance),
-
-                 botMonster->attacks[1].name, getTypeName(botMonster->attacks[1].type),
-                 botMonster->attacks[1].power, botMonster->attacks[1].accuracy,
-                 botMonster->attacks[1].ppCurrent, botMonster->attacks[1].ppMax,
-                 getEffectDescription(botMonster->attacks[1].statusEffect, botMonster->attacks[1].statusChance),
-
-                 botMonster->attacks[2].name, getTypeName(botMonster->attacks[2].type),
-                 botMonster->attacks[2].power, botMonster->attacks[2].accuracy,
-                 botMonster->attacks[2].ppCurrent, botMonster->attacks[2].ppMax,
-                 getEffectDescription(botMonster->attacks[2].statusEffect, botMonster->attacks[2].statusChance),
-
-                 botMonster->attacks[3].name, getTypeName(botMonster->attacks[3].type),
-                 botMonster->attacks[3].power, botMonster->attacks[3].accuracy,
-                 botMonster->attacks[3].ppCurrent, botMonster->attacks[3].ppMax,
-                 getEffectDescription(botMonster->attacks[3].statusEffect, botMonster->attacks[3].statusChance));
+        buildAIAttackPrompt(botMonster, playerMonster, prompt, sizeof(prompt));
 
         // Consultar a IA
         char* response = queryAI(prompt);
 
         // Processar a resposta
         if (response != NULL && strstr(response, "Erro:") != response) {
-            printf("[IA Gemini] Ataque sugerido (completo): %s\n", response);
-            int attackIndex = interpretAIResponse(response);
-
-            // Verificar se o ataque tem PP e é válido
-            if (attackIndex >= 0 && attackIndex <= 3 && botMonster->attacks[attackIndex].ppCurrent > 0) {
-                // Verificar se está repetindo o mesmo ataque constantemente
-                if (attackIndex == lastAttack) {
-                    repeatCount++;
-
-                    // Se repetir o mesmo ataque muitas vezes seguidas, forçar variação
-                    if (repeatCount >= 3) {
-                        printf("[IA Gemini] Repetição excessiva de ataques! Forçando variação...\n");
-                        free(response);
-
-                        // Encontrar alternativas válidas
-                        int validAttacks[4] = {0};
-                        int validCount = 0;
-
-                        for (int i = 0; i < 4; i++) {
-                            if (i != attackIndex && botMonster->attacks[i].ppCurrent > 0) {
-                                validAttacks[validCount++] = i;
-                            }
-                        }
-
-                        // Se houver alternativas, escolher uma aleatoriamente
-                        if (validCount > 0) {
-                            int newAttack = validAttacks[rand() % validCount];
-                            lastAttack = newAttack;
-                            repeatCount = 0;
-                            return newAttack;
-                        }
-                    }
-                } else {
-                    // Resetar contador se o ataque for diferente
-                    repeatCount = 0;
-                }
-
-                lastAttack = attackIndex;
-                free(response);
+            int attackIndex = resolveAIAttackResponse(ctx, botMonster, response);
+            free(response);
+            if (attackIndex >= 0) {
                 return attackIndex;
-            } else {
-                printf("[IA Gemini] Ataque inválido ou sem PP. Escolhendo outro...\n");
             }
-
-            free(response);
         } else {
             printf("[IA Gemini] Falha na resposta. Usando sistema simples.\n");
             if (response) free(response);
@@ -656,15 +642,15 @@ int getAISuggestedAttack(PokeMonster* botMonster, PokeMonster* playerMonster) {
 }
 
 // Sugere o melhor monstro para troca com sistema de fallback
-int getAISuggestedMonster(MonsterList* botTeam, PokeMonster* playerMonster) {
-    if (botTeam == NULL || playerMonster == NULL) {
+int getAISuggestedMonster(BattleContext* ctx, MonsterList* botTeam, PokeMonster* playerMonster) {
+    if (ctx == NULL || botTeam == NULL || playerMonster == NULL) {
         return 0;
     }
     
     // Encontrar o índice do monstro atual do bot para evitar selecioná-lo novamente
     int currentIndex = 0;
     int bestIndex = -1;
-    float bestHpRatio = 0.0f;
+    float bestHpRatio = -1.0f;
 
     PokeMonster* current = botTeam->first;
     int index = 0;
@@ -679,14 +665,8 @@ int getAISuggestedMonster(MonsterList* botTeam, PokeMonster* playerMonster) {
         if (!isMonsterFainted(current) && current != botTeam->current) {
             float hpRatio = (float)current->hp / current->maxHp;
 
-            // Verificar vantagem de tipo
-            float typeAdvantage = calculateTypeEffectiveness(
-                current->type1, playerMonster->type1, playerMonster->type2);
-
-            // Priorizar monstros com vantagem de tipo
-            if (typeAdvantage > 1.0f) {
-                hpRatio *= 1.5f;  // Aumentar a prioridade para monstros com vantagem
-            }
+            // Nota do confronto (tipo, dano esperado e velocidade) pesada pelo HP
+            hpRatio *= getMatchupScore(current, playerMonster);
 
             if (hpRatio > bestHpRatio) {
                 bestHpRatio = hpRatio;
@@ -717,7 +697,7 @@ int getAISuggestedMonster(MonsterList* botTeam, PokeMonster* playerMonster) {
     }
 
     if (validCount > 0) {
-        int result = validIndices[rand() % validCount];
+        int result = validIndices[battleRngRange(&ctx->rng, validCount)];
         free(validIndices);
         return result;
     }
@@ -727,6 +707,165 @@ int getAISuggestedMonster(MonsterList* botTeam, PokeMonster* playerMonster) {
     return (currentIndex + 1) % botTeam->count;
 }
 
+// Acrescenta ao prompt sem passar do tamanho
+static void appendPrompt(char* prompt, size_t size, size_t* used, const char* format, ...) {
+    if (*used >= size) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(prompt + *used, size - *used, format, args);
+    va_end(args);
+    if (written > 0) {
+        *used += (size_t)written < size - *used ? (size_t)written : size - *used - 1;
+    }
+}
+
+// Monstro na posição do time que pode entrar (vivo e fora de campo)
+static PokeMonster* getAISwitchTarget(MonsterList* team, int index) {
+    PokeMonster* monster = team->first;
+    for (int i = 0; monster != NULL && i < index; i++) {
+        monster = monster->next;
+    }
+    if (index < 0 || monster == NULL || monster == team->current || isMonsterFainted(monster)) {
+        return NULL;
+    }
+    return monster;
+}
+
+// Alguém do banco pode entrar?
+static bool hasAISwitchTarget(MonsterList* team) {
+    for (int index = 0; index < team->count; index++) {
+        if (getAISwitchTarget(team, index) != NULL) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Prompt da decisão completa: ação, ataque e troca pedidos juntos
+void buildAIDecisionPrompt(BattleContext* ctx, PokeMonster* botMonster, PokeMonster* playerMonster,
+                           char* prompt, size_t size) {
+    size_t used = 0;
+    prompt[0] = '\0';
+
+    appendPrompt(prompt, size, &used,
+                 "Você é um mestre treinador Pokémon decidindo a jogada completa do turno.\n\n"
+                 "MEU POKÉMON: %s (%s/%s), HP %d/%d, status: %s\n"
+                 "INIMIGO: %s (%s/%s), HP %d/%d, status: %s\n\n"
+                 "ATAQUES (índice: nome, tipo, poder, precisão, PP, efeito, chance de nocaute, dano médio):\n",
+                 botMonster->name, getTypeName(botMonster->type1),
+                 getTypeName(botMonster->type2 != TYPE_NONE ? botMonster->type2 : botMonster->type1),
+                 botMonster->hp, botMonster->maxHp, getStatusName(botMonster->statusCondition),
+                 playerMonster->name, getTypeName(playerMonster->type1),
+                 getTypeName(playerMonster->type2 != TYPE_NONE ? playerMonster->type2 : playerMonster->type1),
+                 playerMonster->hp, playerMonster->maxHp, getStatusName(playerMonster->statusCondition));
+
+    for (int i = 0; i < 4; i++) {
+        Attack* attack = &botMonster->attacks[i];
+        appendPrompt(prompt, size, &used, "%d: %s, %s, %d, %d, %d/%d, %s %d%%, %.0f%%, %.1f\n",
+                     i, attack->name, getTypeName(attack->type), attack->power, attack->accuracy,
+                     attack->ppCurrent, attack->ppMax, getStatusName(attack->statusEffect), attack->statusChance,
+                     getKoProbability(getBattleDamageCache(), botMonster, playerMonster, i) * 100.0,
+                     getExpectedDamage(getDamageDistribution(getBattleDamageCache(), botMonster, playerMonster, i)));
+    }
+
+    // Só as posições que podem entrar; a nota do confronto já pesa tipo, dano e velocidade
+    appendPrompt(prompt, size, &used, "\nTROCAS (posição: nome, tipos, HP, nota do confronto de 0 a 1):\n");
+    int switchCount = 0;
+    int index = 0;
+    for (PokeMonster* monster = ctx->opponentTeam->first; monster != NULL; monster = monster->next, index++) {
+        if (getAISwitchTarget(ctx->opponentTeam, index) == NULL) {
+            continue;
+        }
+        appendPrompt(prompt, size, &used, "%d: %s (%s/%s), HP %d/%d, %.2f\n",
+                     index, monster->name, getTypeName(monster->type1),
+                     getTypeName(monster->type2 != TYPE_NONE ? monster->type2 : monster->type1),
+                     monster->hp, monster->maxHp, getMatchupScore(monster, playerMonster));
+        switchCount++;
+    }
+    if (switchCount == 0) {
+        appendPrompt(prompt, size, &used, "nenhuma\n");
+    }
+
+    const char* randomItem = ctx->itemType == ITEM_RED_CARD ? "Cartão Vermelho" :
+                             ctx->itemType == ITEM_COIN ? "Moeda da Sorte" : "Poção";
+    appendPrompt(prompt, size, &used,
+                 "\nITENS: Poção %s; %s %s\n\n"
+                 "Responda com UMA linha, exatamente neste formato e sem mais nada:\n"
+                 "ACAO=<0 atacar, 1 trocar, 2 item> ATAQUE=<0 a 3> TROCA=<posição ou -1>\n"
+                 "Preencha sempre os três campos: ATAQUE vale quando ACAO=0, TROCA quando ACAO=1.",
+                 ctx->botPotionUsed ? "já usada" : "disponível",
+                 randomItem, ctx->botRandomItemUsed ? "já usado" : "disponível");
+}
+
+// Lê "CHAVE=número" da resposta
+static bool readAIDecisionField(const char* response, const char* key, int* value) {
+    const char* field = strstr(response, key);
+    if (field == NULL) {
+        return false;
+    }
+    field += strlen(key);
+
+    char* end;
+    long parsed = strtol(field, &end, 10);
+    if (end == field) {
+        return false;
+    }
+    *value = (int)parsed;
+    return true;
+}
+
+bool parseAIDecisionResponse(const char* response, AIBotDecision* decision) {
+    if (response == NULL || decision == NULL) {
+        return false;
+    }
+
+    // Os três campos são obrigatórios; resposta fora do formato é descartada
+    int action, attackIndex, switchIndex;
+    if (!readAIDecisionField(response, "ACAO=", &action) ||
+        !readAIDecisionField(response, "ATAQUE=", &attackIndex) ||
+        !readAIDecisionField(response, "TROCA=", &switchIndex) ||
+        action < 0 || action > 2) {
+        return false;
+    }
+
+    decision->action = action;
+    decision->attackIndex = attackIndex;
+    decision->switchIndex = switchIndex;
+    return true;
+}
+
+void checkAIDecision(BattleContext* ctx, PokeMonster* botMonster, AIBotDecision* decision) {
+    // Campos que não servem ficam para a lógica local (-1)
+    if (decision->attackIndex < 0 || decision->attackIndex > 3 ||
+        botMonster->attacks[decision->attackIndex].ppCurrent <= 0) {
+        decision->attackIndex = -1;
+    }
+    if (getAISwitchTarget(ctx->opponentTeam, decision->switchIndex) == NULL) {
+        decision->switchIndex = -1;
+    }
+
+    // Troca sem ninguém para entrar (o prompt diz "nenhuma"): o bot perderia
+    // o turno, então ataca
+    if (decision->action == 1 && !hasAISwitchTarget(ctx->opponentTeam)) {
+        printf("[IA Gemini] Troca sem Pokémon disponível, atacando no lugar\n");
+        decision->action = 0;
+    }
+}
+
+void varyAIDecision(BattleContext* ctx, PokeMonster* botMonster, PokeMonster* playerMonster,
+                    AIBotDecision* decision) {
+    decision->action = varyAIAction(ctx, botMonster, playerMonster, decision->action);
+    // A variação também pode sortear uma troca impossível
+    if (decision->action == 1 && !hasAISwitchTarget(ctx->opponentTeam)) {
+        decision->action = 0;
+    }
+    if (decision->action == 0 && decision->attackIndex >= 0) {
+        decision->attackIndex = varyAIAttack(ctx, botMonster, decision->attackIndex);
+    }
+}
+
 bool testAIConnection(void) {
     if (!initialized || curl_handle == NULL) {
         printf("AVISO: Sistema de IA não está inicializado!\n");
@@ -0,0 +1,338 @@
+/**
+ * PokeBattle - Leitura incremental das respostas da IA
+ *
+ * O tokenizador guarda só o necessário para continuar de onde o pedaço
+ * anterior parou: em que tipo de token está, a pilha de objetos/listas e,
+ * dentro de um escape \uXXXX, os dígitos lidos. Números, true/false/null e
+ * as strings que não interessam são consumidos sem cópia.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ia_response.h"
+#include "ia_integration.h"
+
+typedef enum {
+    JSON_BETWEEN_TOKENS,    // Fora de strings (estrutura, espaços e escalares)
+    JSON_IN_STRING,
+    JSON_IN_ESCAPE,         // Depois de '\'
+    JSON_IN_UNICODE         // Lendo os 4 dígitos de \uXXXX
+} JsonState;
+
+// Caractere de substituição para \u inválido (surrogate sem par)
+#define REPLACEMENT_CODEPOINT 0xFFFD
+
+bool initAIResponseParser(AIResponseParser* parser, size_t capacityHint) {
+    memset(parser, 0, sizeof(AIResponseParser));
+
+    // O texto nunca é maior que o JSON, e as respostas do bot são curtas:
+    // o buffer é alocado uma vez e só cresce se uma resposta passar disso
+    parser->capacity = capacityHint > 0 ? capacityHint + 1 : MAX_RESPONSE_SIZE;
+    parser->buffer = malloc(parser->capacity);
+    if (parser->buffer == NULL) {
+        parser->capacity = 0;
+        parser->failed = true;
+        return false;
+    }
+    parser->buffer[0] = '\0';
+    parser->state = JSON_BETWEEN_TOKENS;
+    return true;
+}
+
+void freeAIResponseParser(AIResponseParser* parser) {
+    free(parser->buffer);
+    parser->buffer = NULL;
+    parser->length = 0;
+    parser->capacity = 0;
+}
+
+// Acrescenta bytes já decodificados à chave ou ao texto, conforme o caso
+static bool emitBytes(AIResponseParser* parser, const char* bytes, size_t count) {
+    if (parser->expectKey) {
+        for (size_t i = 0; i < count; i++) {
+            if (parser->keyLength < (int)sizeof(parser->key)) {
+                parser->key[parser->keyLength] = bytes[i];
+            }
+            parser->keyLength++;
+        }
+        return true;
+    }
+
+    if (!parser->capturing) {
+        return true;
+    }
+
+    if (parser->length + count + 1 > parser->capacity) {
+        size_t capacity = parser->capacity * 2;
+        while (parser->length + count + 1 > capacity) {
+            capacity *= 2;
+        }
+        char* buffer = realloc(parser->buffer, capacity);
+        if (buffer == NULL) {
+            printf("ERRO: sem memória para a resposta da IA\n");
+            return false;
+        }
+        parser->buffer = buffer;
+        parser->capacity = capacity;
+    }
+
+    memcpy(parser->buffer + parser->length, bytes, count);
+    parser->length += count;
+    parser->buffer[parser->length] = '\0';
+    return true;
+}
+
+static bool emitCodepoint(AIResponseParser* parser, uint32_t codepoint) {
+    char bytes[4];
+    size_t count;
+
+    if (codepoint < 0x80) {
+        bytes[0] = (char)codepoint;
+        count = 1;
+    } else if (codepoint < 0x800) {
+        bytes[0] = (char)(0xC0 | (codepoint >> 6));
+        bytes[1] = (char)(0x80 | (codepoint & 0x3F));
+        count = 2;
+    } else if (codepoint < 0x10000) {
+        bytes[0] = (char)(0xE0 | (codepoint >> 12));
+        bytes[1] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+        bytes[2] = (char)(0x80 | (codepoint & 0x3F));
+        count = 3;
+    } else {
+        bytes[0] = (char)(0xF0 | (codepoint >> 18));
+        bytes[1] = (char)(0x80 | ((codepoint >> 12) & 0x3F));
+        bytes[2] = (char)(0x80 | ((codepoint >> 6) & 0x3F));
+        bytes[3] = (char)(0x80 | (codepoint & 0x3F));
+        count = 4;
+    }
+
+    return emitBytes(parser, bytes, count);
+}
+
+// Um \uD8xx sem a segunda metade vira o caractere de substituição
+static bool flushHighSurrogate(AIResponseParser* parser) {
+    if (parser->highSurrogate == 0) {
+        return true;
+    }
+    parser->highSurrogate = 0;
+    return emitCodepoint(parser, REPLACEMENT_CODEPOINT);
+}
+
+static bool finishUnicodeEscape(AIResponseParser* parser) {
+    uint32_t codepoint = parser->codepoint;
+
+    if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+        if (!flushHighSurrogate(parser)) {
+            return false;
+        }
+        parser->highSurrogate = codepoint;
+        return true;
+    }
+
+    if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+        if (parser->highSurrogate == 0) {
+            return emitCodepoint(parser, REPLACEMENT_CODEPOINT);
+        }
+        codepoint = 0x10000 + ((parser->highSurrogate - 0xD800) << 10) + (codepoint - 0xDC00);
+        parser->highSurrogate = 0;
+        return emitCodepoint(parser, codepoint);
+    }
+
+    return flushHighSurrogate(parser) && emitCodepoint(parser, codepoint);
+}
+
+static bool startString(AIResponseParser* parser) {
+    bool inObject = parser->depth > 0 && parser->isObject[parser->depth - 1];
+
+    if (inObject && parser->expectKey) {
+        parser->keyLength = 0;
+    } else {
+        // Valor: só interessa se veio depois da chave "text"
+        parser->expectKey = false;
+        parser->capturing = parser->nextIsText;
+        if (parser->capturing) {
+            parser->textCount++;
+        }
+    }
+    parser->nextIsText = false;
+    parser->state = JSON_IN_STRING;
+    return true;
+}
+
+static bool endString(AIResponseParser* parser) {
+    if (!flushHighSurrogate(parser)) {
+        return false;
+    }
+
+    if (parser->expectKey) {
+        parser->nextIsText = parser->keyLength == 4 && memcmp(parser->key, "text", 4) == 0;
+        parser->expectKey = false;
+    }
+    parser->capturing = false;
+    parser->state = JSON_BETWEEN_TOKENS;
+    return true;
+}
+
+static bool parseStructure(AIResponseParser* parser, char c) {
+    switch (c) {
+        case '{':
+        case '[':
+            if (parser->depth >= AI_RESPONSE_MAX_DEPTH) {
+                return false;
+            }
+            parser->isObject[parser->depth++] = c == '{';
+            parser->expectKey = c == '{';
+            parser->nextIsText = false;
+            return true;
+
+        case '}':
+        case ']':
+            if (parser->depth == 0 || parser->isObject[parser->depth - 1] != (c == '}')) {
+                return false;
+            }
+            parser->depth--;
+            parser->expectKey = false;
+            parser->nextIsText = false;
+            return true;
+
+        case ',':
+            parser->expectKey = parser->depth > 0 && parser->isObject[parser->depth - 1];
+            parser->nextIsText = false;
+            return true;
+
+        case '"':
+            return startString(parser);
+
+        default:
+            // ':', espaços e os escalares (números, true, false, null)
+            return true;
+    }
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static bool parseEscape(AIResponseParser* parser, char c) {
+    char decoded;
+    switch (c) {
+        case '"':  decoded = '"'; break;
+        case '\\': decoded = '\\'; break;
+        case '/':  decoded = '/'; break;
+        case 'b':  decoded = '\b'; break;
+        case 'f':  decoded = '\f'; break;
+        case 'n':  decoded = '\n'; break;
+        case 'r':  decoded = '\r'; break;
+        case 't':  decoded = '\t'; break;
+        case 'u':
+            parser->codepoint = 0;
+            parser->hexDigits = 0;
+            parser->state = JSON_IN_UNICODE;
+            return true;
+        default:
+            return false;
+    }
+
+    parser->state = JSON_IN_STRING;
+    return flushHighSurrogate(parser) && emitBytes(parser, &decoded, 1);
+}
+
+bool feedAIResponseParser(AIResponseParser* parser, const char* data, size_t size) {
+    if (parser->failed) {
+        return false;
+    }
+
+    const char* end = data + size;
+    const char* p = data;
+
+    while (p < end && !parser->failed) {
+        switch (parser->state) {
+            case JSON_BETWEEN_TOKENS:
+                parser->failed = !parseStructure(parser, *p++);
+                break;
+
+            case JSON_IN_STRING: {
+                // Trecho sem escapes copiado de uma vez
+                const char* run = p;
+                while (p < end && *p != '"' && *p != '\\') {
+                    p++;
+                }
+                if (p > run) {
+                    parser->failed = !flushHighSurrogate(parser) ||
+                                     !emitBytes(parser, run, (size_t)(p - run));
+                }
+                if (p < end && !parser->failed) {
+                    if (*p == '"') {
+                        parser->failed = !endString(parser);
+                    } else {
+                        parser->state = JSON_IN_ESCAPE;
+                    }
+                    p++;
+                }
+                break;
+            }
+
+            case JSON_IN_ESCAPE:
+                parser->failed = !parseEscape(parser, *p++);
+                break;
+
+            case JSON_IN_UNICODE: {
+                int digit = hexValue(*p++);
+                if (digit < 0) {
+                    parser->failed = true;
+                    break;
+                }
+                parser->codepoint = (parser->codepoint << 4) | (uint32_t)digit;
+                if (++parser->hexDigits == 4) {
+                    parser->state = JSON_IN_STRING;
+                    parser->failed = !finishUnicodeEscape(parser);
+                }
+                break;
+            }
+        }
+    }
+
+    return !parser->failed;
+}
+
+size_t aiResponseWriteCallback(void* contents, size_t size, size_t nmemb, void* userp) {
+    size_t realsize = size * nmemb;
+    AIResponseParser* parser = (AIResponseParser*)userp;
+
+    // Retornar 0 sinaliza erro para libcurl (JSON inválido não serve mesmo)
+    if (!feedAIResponseParser(parser, (const char*)contents, realsize)) {
+        return 0;
+    }
+    return realsize;
+}
+
+bool getAIResponseText(const AIResponseParser* parser, const char** text, size_t* length) {
+    // Só vale com o JSON completo: uma resposta cortada não é usada pela metade
+    if (parser->failed || parser->textCount == 0 || parser->buffer == NULL ||
+        parser->depth != 0 || parser->state != JSON_BETWEEN_TOKENS) {
+        return false;
+    }
+
+    if (text != NULL) {
+        *text = parser->buffer;
+    }
+    if (length != NULL) {
+        *length = parser->length;
+    }
+    return true;
+}
+
+char* takeAIResponseText(AIResponseParser* parser) {
+    if (!getAIResponseText(parser, NULL, NULL)) {
+        return NULL;
+    }
+
+    char* text = parser->buffer;
+    parser->buffer = NULL;
+    parser->length = 0;
+    parser->capacity = 0;
+    return text;
+}
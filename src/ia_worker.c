@@ -0,0 +1,348 @@
+/**
+ * PokeBattle - Consultas à IA em segundo plano
+ *
+ * Duas listas protegidas pelo mesmo mutex: as consultas pendentes (na fila
+ * ou em andamento na libcurl) e as concluídas, esperando o jogo buscar. A
+ * thread é a única que mexe no handle multi e nos handles easy; o jogo só
+ * acrescenta pendentes, marca cancelamentos e retira concluídas.
+ */
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOGDI
+    #define NOUSER
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <curl/curl.h>
+#include "ia_worker.h"
+#include "ia_integration.h"
+#include "ia_response.h"
+#include "structures.h"
+
+// Espera máxima da thread sem atividade (acordada antes pelo jogo ao enviar)
+#define AI_WORKER_POLL_MS 1000
+
+typedef struct AIQuery {
+    int id;
+    int timeoutMs;
+    char* payload;
+    CURL* easy;             // NULL enquanto está na fila
+    AIResponseParser parser;    // Lê o JSON enquanto chega
+    bool cancelled;
+    AIQueryState state;     // Resultado, nas concluídas
+    char* response;
+    struct AIQuery* next;
+} AIQuery;
+
+static pthread_t workerThread;
+static pthread_mutex_t workerLock = PTHREAD_MUTEX_INITIALIZER;
+static CURLM* multiHandle = NULL;
+static struct curl_slist* jsonHeaders = NULL;
+static bool workerRunning = false;
+static atomic_bool workerStopping;
+static int nextQueryId = 1;
+
+static AIQuery* pendingQueries = NULL;
+static AIQuery* completedQueries = NULL;
+
+static void freeAIQuery(AIQuery* query) {
+    if (query->easy != NULL) {
+        curl_multi_remove_handle(multiHandle, query->easy);
+        curl_easy_cleanup(query->easy);
+    }
+    free(query->payload);
+    freeAIResponseParser(&query->parser);
+    free(query->response);
+    free(query);
+}
+
+// Retira a consulta com o identificador da lista (NULL se não está)
+static AIQuery* unlinkAIQuery(AIQuery** list, int id) {
+    for (AIQuery** link = list; *link != NULL; link = &(*link)->next) {
+        if ((*link)->id == id) {
+            AIQuery* query = *link;
+            *link = query->next;
+            query->next = NULL;
+            return query;
+        }
+    }
+    return NULL;
+}
+
+static void appendAIQuery(AIQuery** list, AIQuery* query) {
+    while (*list != NULL) {
+        list = &(*list)->next;
+    }
+    *list = query;
+}
+
+static bool startAIQueryTransfer(AIQuery* query) {
+    if (!initAIResponseParser(&query->parser, 0)) {
+        return false;
+    }
+    query->easy = curl_easy_init();
+    if (query->easy == NULL) {
+        return false;
+    }
+
+    curl_easy_setopt(query->easy, CURLOPT_URL, getAIEndpointUrl());
+    curl_easy_setopt(query->easy, CURLOPT_POST, 1L);
+    curl_easy_setopt(query->easy, CURLOPT_POSTFIELDS, query->payload);
+    curl_easy_setopt(query->easy, CURLOPT_HTTPHEADER, jsonHeaders);
+    curl_easy_setopt(query->easy, CURLOPT_WRITEFUNCTION, aiResponseWriteCallback);
+    curl_easy_setopt(query->easy, CURLOPT_WRITEDATA, (void*)&query->parser);
+    curl_easy_setopt(query->easy, CURLOPT_PRIVATE, (void*)query);
+    curl_easy_setopt(query->easy, CURLOPT_USERAGENT, "pokebattle-ai-client/1.0");
+    curl_easy_setopt(query->easy, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(query->easy, CURLOPT_SSL_VERIFYPEER, 0L);
+    curl_easy_setopt(query->easy, CURLOPT_SSL_VERIFYHOST, 0L);
+    // Sinais não servem para timeouts fora da thread principal
+    curl_easy_setopt(query->easy, CURLOPT_NOSIGNAL, 1L);
+    if (query->timeoutMs > 0) {
+        curl_easy_setopt(query->easy, CURLOPT_TIMEOUT_MS, (long)query->timeoutMs);
+    }
+
+    if (curl_multi_add_handle(multiHandle, query->easy) != CURLM_OK) {
+        curl_easy_cleanup(query->easy);
+        query->easy = NULL;
+        return false;
+    }
+    return true;
+}
+
+// Com o mutex: descarta as canceladas e começa as que estão na fila
+static void updatePendingQueries(void) {
+    AIQuery** link = &pendingQueries;
+    while (*link != NULL) {
+        AIQuery* query = *link;
+
+        if (query->cancelled) {
+            *link = query->next;
+            freeAIQuery(query);
+            continue;
+        }
+
+        if (query->easy == NULL && !startAIQueryTransfer(query)) {
+            printf("ERRO: não foi possível iniciar a consulta %d à IA\n", query->id);
+            *link = query->next;
+            query->next = NULL;
+            query->state = AI_QUERY_FAILED;
+            appendAIQuery(&completedQueries, query);
+            continue;
+        }
+
+        link = &query->next;
+    }
+}
+
+// Passa a transferência terminada para as concluídas
+static void finishAIQuery(CURL* easy, CURLcode result) {
+    AIQuery* query = NULL;
+    curl_easy_getinfo(easy, CURLINFO_PRIVATE, (char**)&query);
+    if (query == NULL) {
+        return;
+    }
+
+    long httpCode = 0;
+    curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &httpCode);
+
+    // O texto já foi decodificado durante a transferência; o buffer do
+    // parser é entregue como resposta, sem cópia
+    char* text = NULL;
+    if (result == CURLE_OK && httpCode == 200) {
+        text = takeAIResponseText(&query->parser);
+        if (text == NULL) {
+            printf("[IA] Consulta %d: resposta sem texto ou JSON inválido\n", query->id);
+        }
+    } else if (result != CURLE_OK) {
+        printf("[IA] Consulta %d falhou: %s\n", query->id, curl_easy_strerror(result));
+    } else {
+        printf("[IA] Consulta %d falhou: HTTP %ld\n", query->id, httpCode);
+    }
+
+    pthread_mutex_lock(&workerLock);
+    unlinkAIQuery(&pendingQueries, query->id);
+
+    curl_multi_remove_handle(multiHandle, easy);
+    curl_easy_cleanup(easy);
+    query->easy = NULL;
+    freeAIResponseParser(&query->parser);
+
+    if (query->cancelled) {
+        free(text);
+        freeAIQuery(query);
+    } else {
+        query->response = text;
+        query->state = text != NULL ? AI_QUERY_DONE : AI_QUERY_FAILED;
+        appendAIQuery(&completedQueries, query);
+    }
+    pthread_mutex_unlock(&workerLock);
+}
+
+static void* aiWorkerMain(void* arg) {
+    (void)arg;
+
+    while (!atomic_load(&workerStopping)) {
+        pthread_mutex_lock(&workerLock);
+        updatePendingQueries();
+        pthread_mutex_unlock(&workerLock);
+
+        int running = 0;
+        curl_multi_perform(multiHandle, &running);
+
+        CURLMsg* message;
+        int remaining;
+        while ((message = curl_multi_info_read(multiHandle, &remaining)) != NULL) {
+            if (message->msg == CURLMSG_DONE) {
+                finishAIQuery(message->easy_handle, message->data.result);
+            }
+        }
+
+        // Dorme até ter rede para tratar, o jogo enviar/cancelar algo ou o tempo acabar
+        curl_multi_poll(multiHandle, NULL, 0, AI_WORKER_POLL_MS, NULL);
+    }
+
+    return NULL;
+}
+
+bool startAIWorker(void) {
+    if (workerRunning) {
+        return true;
+    }
+
+    multiHandle = curl_multi_init();
+    if (multiHandle == NULL) {
+        return false;
+    }
+    jsonHeaders = curl_slist_append(NULL, "Content-Type: application/json; charset=UTF-8");
+
+    atomic_store(&workerStopping, false);
+    if (pthread_create(&workerThread, NULL, aiWorkerMain, NULL) != 0) {
+        curl_slist_free_all(jsonHeaders);
+        jsonHeaders = NULL;
+        curl_multi_cleanup(multiHandle);
+        multiHandle = NULL;
+        return false;
+    }
+
+    workerRunning = true;
+    return true;
+}
+
+void stopAIWorker(void) {
+    if (!workerRunning) {
+        return;
+    }
+
+    atomic_store(&workerStopping, true);
+    curl_multi_wakeup(multiHandle);
+    pthread_join(workerThread, NULL);
+    workerRunning = false;
+
+    // Sem a thread, o que sobrou é liberado daqui
+    while (pendingQueries != NULL) {
+        AIQuery* query = pendingQueries;
+        pendingQueries = query->next;
+        freeAIQuery(query);
+    }
+    while (completedQueries != NULL) {
+        AIQuery* query = completedQueries;
+        completedQueries = query->next;
+        freeAIQuery(query);
+    }
+
+    curl_multi_cleanup(multiHandle);
+    multiHandle = NULL;
+    curl_slist_free_all(jsonHeaders);
+    jsonHeaders = NULL;
+}
+
+bool isAIWorkerRunning(void) {
+    return workerRunning;
+}
+
+int submitAIQuery(const char* prompt, int timeoutMs) {
+    if (!workerRunning || prompt == NULL) {
+        return -1;
+    }
+
+    AIQuery* query = calloc(1, sizeof(AIQuery));
+    if (query == NULL) {
+        return -1;
+    }
+    query->payload = buildAIRequestPayload(prompt);
+    if (query->payload == NULL) {
+        free(query);
+        return -1;
+    }
+    query->timeoutMs = timeoutMs;
+    query->state = AI_QUERY_PENDING;
+
+    pthread_mutex_lock(&workerLock);
+    query->id = nextQueryId++;
+    appendAIQuery(&pendingQueries, query);
+    int id = query->id;
+    pthread_mutex_unlock(&workerLock);
+
+    curl_multi_wakeup(multiHandle);
+    return id;
+}
+
+AIQueryState pollAIQuery(int id, char** response) {
+    if (response != NULL) {
+        *response = NULL;
+    }
+
+    pthread_mutex_lock(&workerLock);
+    AIQuery* query = unlinkAIQuery(&completedQueries, id);
+    if (query == NULL) {
+        // Ainda pendente?
+        AIQueryState state = AI_QUERY_UNKNOWN;
+        for (AIQuery* pending = pendingQueries; pending != NULL; pending = pending->next) {
+            if (pending->id == id && !pending->cancelled) {
+                state = AI_QUERY_PENDING;
+                break;
+            }
+        }
+        pthread_mutex_unlock(&workerLock);
+        return state;
+    }
+    pthread_mutex_unlock(&workerLock);
+
+    AIQueryState state = query->state;
+    if (response != NULL) {
+        *response = query->response;
+        query->response = NULL;
+    }
+    freeAIQuery(query);
+    return state;
+}
+
+void cancelAIQuery(int id) {
+    if (!workerRunning || id <= 0) {
+        return;
+    }
+
+    pthread_mutex_lock(&workerLock);
+    AIQuery* query = unlinkAIQuery(&completedQueries, id);
+    if (query != NULL) {
+        pthread_mutex_unlock(&workerLock);
+        freeAIQuery(query);
+        return;
+    }
+
+    for (AIQuery* pending = pendingQueries; pending != NULL; pending = pending->next) {
+        if (pending->id == id) {
+            pending->cancelled = true;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&workerLock);
+
+    // A thread tira a transferência da libcurl na próxima volta
+    curl_multi_wakeup(multiHandle);
+}
@@ -1337,6 +1337,20 @@ void drawBattleAttackMenu(Rectangle bounds) {
              20,
              textColor);
 
+    // Dica da tabela de finais 1x1 (quando só resta um monstro de cada lado)
+    EndgameResult endgame;
+    if (getBattleEndgameHint(&endgame)) {
+        char hintText[96];
+        snprintf(hintText, sizeof(hintText), "Final 1x1: %.0f%% com %s",
+                 endgame.winProbability * 100.0f,
+                 battleSystem->playerTeam->current->attacks[endgame.attackIndex].name);
+        DrawText(hintText,
+                 bounds.x + 40 + MeasureText("SELECIONE UM ATAQUE", 20),
+                 bounds.y + 19,
+                 16,
+                 (Color){255, 215, 80, 255});
+    }
+
     // Botão de voltar no estilo BW
     Rectangle backBtn = {
         bounds.x + bounds.width - 100,
@@ -1399,7 +1413,7 @@ void drawBattleAttackMenu(Rectangle bounds) {
             battleSystem->selectedAttack = i;
 
             // Enfileirar ação de ataque
-            enqueue(battleSystem->actionQueue, 0, i, battleSystem->playerTeam->current);
+            queueBattleAction(battleSystem, 0, i, battleSystem->playerTeam->current);
 
             // Passar o turno para o bot escolher
             battleSystem->playerTurn = false;
@@ -1426,6 +1440,19 @@ void drawBattleAttackMenu(Rectangle bounds) {
                  14,
                  WHITE);
 
+        // Chance exata de nocaute no centro (só quando existe)
+        PokeMonster* target = battleSystem->opponentTeam->current;
+        double koChance = target != NULL ? getKoProbability(getBattleDamageCache(), monster, target, i) : 0.0;
+        if (koChance > 0.0) {
+            char koText[20];
+            snprintf(koText, sizeof(koText), "KO %.0f%%", koChance * 100.0);
+            DrawText(koText,
+                     infoRect.x + (infoRect.width - MeasureText(koText, 14)) / 2,
+                     infoRect.y,
+                     14,
+                     (Color){255, 215, 80, 255});
+        }
+
         // Poder à direita (se tiver)
         if (monster->attacks[i].power > 0) {
             char powerText[20];
@@ -1600,11 +1627,11 @@ void drawMonsterSelectionMenu(Rectangle bounds)
         {
             PlaySound(selectSound);
             switchMonster(team, current);
-            enqueue(battleSystem->actionQueue, 1, index, team->current);
+            queueBattleAction(battleSystem, 1, index, team->current);
 
             if (battleSystem->battleState == BATTLE_FORCED_SWITCH)
             {
-                actionQueueReady = true;
+                battleSystem->actionQueueReady = true;
                 battleSystem->battleState = BATTLE_PREPARING_ACTIONS;
             }
             else
@@ -1822,7 +1849,7 @@ void drawItemMenu(Rectangle bounds) {
         IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         PlaySound(selectSound);
         // Usar poção
-        enqueue(battleSystem->actionQueue, 2, ITEM_POTION, battleSystem->playerTeam->current);
+        queueBattleAction(battleSystem, 2, ITEM_POTION, battleSystem->playerTeam->current);
         potionUsed = true;
         battleSystem->playerItemUsed = true;
         battleSystem->playerTurn = false;
@@ -1834,7 +1861,7 @@ void drawItemMenu(Rectangle bounds) {
         IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
         PlaySound(selectSound);
         // Usar o item aleatório
-        enqueue(battleSystem->actionQueue, 2, randomItemType, battleSystem->playerTeam->current);
+        queueBattleAction(battleSystem, 2, randomItemType, battleSystem->playerTeam->current);
         randomItemUsed = true;
         battleSystem->playerItemUsed = true;
         battleSystem->playerTurn = false;
@@ -1981,14 +2008,14 @@ void drawBattleMessage(Rectangle bounds) {
     DrawRectangleRoundedLines(bounds, 0.3f, 8, frameColor);
 
     // Verificar se temos uma mensagem atual
-    if (strlen(currentMessage.message) > 0) {
+    if (battleSystem != NULL && strlen(battleSystem->currentMessage.message) > 0) {
         // Inicializar typewriter se necessário
         static bool textInitialized = false;
         static char lastMessage[256] = "";
 
-        if (!textInitialized || strcmp(lastMessage, currentMessage.message) != 0) {
-            startTypewriter(currentMessage.message, currentMessage.waitingForInput);
-            strcpy(lastMessage, currentMessage.message);
+        if (!textInitialized || strcmp(lastMessage, battleSystem->currentMessage.message) != 0) {
+            startTypewriter(battleSystem->currentMessage.message, battleSystem->currentMessage.waitingForInput);
+            strcpy(lastMessage, battleSystem->currentMessage.message);
             textInitialized = true;
         }
 
@@ -2220,11 +2247,11 @@ void drawBattleScreen(void) {
             if (battleSystem->playerTurn) {
                 drawBattleActionMenu(actionBox);
             } else {
-                strcpy(currentMessage.message, "O oponente está escolhendo sua ação...");
-                currentMessage.displayTime = 0.5f;
-                currentMessage.elapsedTime = 0.0f;
-                currentMessage.waitingForInput = false;
-                currentMessage.autoAdvance = false;
+                strcpy(battleSystem->currentMessage.message, "O oponente está escolhendo sua ação...");
+                battleSystem->currentMessage.displayTime = 0.5f;
+                battleSystem->currentMessage.elapsedTime = 0.0f;
+                battleSystem->currentMessage.waitingForInput = false;
+                battleSystem->currentMessage.autoAdvance = false;
                 drawBattleMessage(actionBox);
             }
             break;
@@ -2267,7 +2294,7 @@ void drawBattleScreen(void) {
 
         case BATTLE_OVER:
             {
-                int winner = getBattleWinner();
+                int winner = getBattleWinner(battleSystem);
                 const char* resultMsg;
 
                 if (winner == 1) {
@@ -2278,7 +2305,7 @@ void drawBattleScreen(void) {
                     resultMsg = "A batalha terminou em empate!";
                 }
 
-                strcpy(currentMessage.message, resultMsg);
+                strcpy(battleSystem->currentMessage.message, resultMsg);
                 drawBattleMessage(actionBox);
 
                 Rectangle menuBtn = {
@@ -18,7 +18,7 @@
 extern bool initialized;
 extern CURL* curl_handle;
 
-extern BattleSystem* battleSystem;
+extern BattleContext* battleSystem;
 
 // Desenha um botão e retorna true se for clicado
 bool drawButton(Rectangle bounds, const char* text, Color color) {
@@ -183,7 +183,7 @@ void drawAttackList(Rectangle bounds, PokeMonster* monster, int selectedAttack)
             battleSystem->selectedAttack = i;
 
             // Enfileirar as ações de ataque
-            enqueue(battleSystem->actionQueue, 0, i, battleSystem->playerTeam->current);
+            queueBattleAction(battleSystem, 0, i, battleSystem->playerTeam->current);
 
             // Passar o turno para o bot escolher
             battleSystem->playerTurn = false;
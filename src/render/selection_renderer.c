@@ -17,6 +17,7 @@
 
 #include "globals.h"
 #include "gui.h"
+#include "team_builder.h"
 
 static int teamSelectionCount = 0;
 static bool viewingStats = false;
@@ -32,6 +33,13 @@ static float initialScrollOffset = 0;
 static float selectionTimer = 0.0f;
 static float cardPulseAnimations[50] = {0}; // Para animar os cards
 
+// Sugestão de time: a busca roda no pool e o painel lê o andamento a cada quadro
+static TeamBuilder* teamBuilder = NULL;
+static TeamBuilderProgress suggestionProgress;
+static bool suggestionVisible = false;
+
+static void cancelTeamSuggestion(void);
+
 // Seleção de adversário
 void drawOpponentSelection(void)
 {
@@ -216,6 +224,179 @@ void updateOpponentSelection(void)
 }
 
 // Seleção de monstros
+// Coloca uma cópia do monstro no time que está sendo montado; com 3
+// monstros passa para o próximo time ou começa a batalha
+static void addMonsterToSelection(PokeMonster* monster)
+{
+    PokeMonster* newMonster = createMonsterCopy(monster);
+
+    if (teamSelectionCount == 0)
+    {
+        addMonster(playerTeam, newMonster);
+
+        if (playerTeam->count >= 3)
+        {
+            cancelTeamSuggestion();
+            if (vsBot)
+            {
+                opponentTeam = generateRandomTeam(3);
+                startNewBattle(playerTeam, opponentTeam);
+                currentScreen = BATTLE_SCREEN;
+                StopMusicStream(menuMusic);
+                PlayMusicStream(battleMusic);
+            }
+            else
+            {
+                teamSelectionCount = 1;
+                scrollOffset = 0;
+            }
+        }
+    }
+    else
+    {
+        addMonster(opponentTeam, newMonster);
+
+        if (opponentTeam->count >= 3)
+        {
+            cancelTeamSuggestion();
+            startNewBattle(playerTeam, opponentTeam);
+            currentScreen = BATTLE_SCREEN;
+            StopMusicStream(menuMusic);
+            PlayMusicStream(battleMusic);
+        }
+    }
+}
+
+// Para a busca (se ainda estiver rodando) e esconde o painel
+static void cancelTeamSuggestion(void)
+{
+    stopTeamBuilder(teamBuilder);
+    teamBuilder = NULL;
+    suggestionVisible = false;
+}
+
+static MonsterList* teamBeingSelected(void)
+{
+    return teamSelectionCount == 0 ? playerTeam : opponentTeam;
+}
+
+static void startTeamSuggestion(void)
+{
+    cancelTeamSuggestion();
+
+    // Os monstros já escolhidos ficam no time sugerido
+    TeamBuilderConfig config;
+    initTeamBuilderConfig(&config);
+    config.seed = (uint64_t)GetRandomValue(1, 1000000);
+    MonsterList* team = teamBeingSelected();
+    for (PokeMonster* current = team != NULL ? team->first : NULL;
+         current != NULL && config.requiredCount < TEAM_BUILDER_SIZE; current = current->next)
+    {
+        int species = getSpeciesIndex(current);
+        if (species >= 0)
+        {
+            config.required[config.requiredCount++] = species;
+        }
+    }
+
+    teamBuilder = startTeamBuilder(&config);
+    memset(&suggestionProgress, 0, sizeof(suggestionProgress));
+    suggestionVisible = teamBuilder != NULL;
+}
+
+// Completa o time com o melhor time sugerido. O time é lido uma vez: ao
+// completar 3, addMonsterToSelection passa para o time do adversário (PvP),
+// e o resto da sugestão não pode ir para ele
+static void applyTeamSuggestion(const TeamSuggestion* suggestion)
+{
+    MonsterList* team = teamBeingSelected();
+    for (int i = 0; i < TEAM_BUILDER_SIZE && team != NULL && team->count < 3; i++)
+    {
+        PokeMonster* monster = getMonsterByIndex(suggestion->indices[i]);
+        bool alreadySelected = false;
+        for (PokeMonster* current = team->first; current != NULL; current = current->next)
+        {
+            alreadySelected = alreadySelected || strcmp(current->name, monster->name) == 0;
+        }
+        if (!alreadySelected)
+        {
+            addMonsterToSelection(monster);
+        }
+    }
+}
+
+// Botão de sugestão e painel com o ranking parcial
+static void drawTeamSuggestion(void)
+{
+    Rectangle suggestBtnRect = {
+        GetScreenWidth() / 2 - 100,
+        GetScreenHeight() - 70,
+        200,
+        50
+    };
+
+    if (GuiPokemonButton(suggestBtnRect, teamBuilder != NULL ? "BUSCANDO..." : "SUGERIR TIME", true))
+    {
+        PlaySound(selectSound);
+        startTeamSuggestion();
+    }
+
+    if (!suggestionVisible)
+    {
+        return;
+    }
+
+    Rectangle panel = {
+        GetScreenWidth() / 2 - 260,
+        GetScreenHeight() - 270,
+        520,
+        190
+    };
+    DrawRectangleRounded(panel, 0.2f, 8, (Color){40, 40, 40, 235});
+    DrawRectangleRoundedLines(panel, 0.2f, 8, (Color){255, 255, 255, 150});
+
+    // Andamento: batalhas simuladas nos candidatos que sobraram da poda
+    char status[128];
+    if (suggestionProgress.finished)
+    {
+        snprintf(status, sizeof(status), "%ld times, %ld simulados (%ld batalhas) em %.1fs",
+                 suggestionProgress.teamsTotal, suggestionProgress.candidates, suggestionProgress.battles,
+                 suggestionProgress.elapsedMs / 1000.0);
+    }
+    else
+    {
+        snprintf(status, sizeof(status), "Simulando %ld/%ld candidatos de %ld times...",
+                 suggestionProgress.evaluated, suggestionProgress.candidates, suggestionProgress.teamsTotal);
+    }
+    DrawText(status, panel.x + 15, panel.y + 12, 16, WHITE);
+
+    float ratio = suggestionProgress.candidates > 0 ?
+                  (float)suggestionProgress.evaluated / suggestionProgress.candidates : 0.0f;
+    DrawRectangle(panel.x + 15, panel.y + 36, (int)((panel.width - 30) * ratio), 6, GOLD);
+
+    for (int i = 0; i < suggestionProgress.bestCount && i < 3; i++)
+    {
+        const TeamSuggestion* suggestion = &suggestionProgress.best[i];
+        char line[128];
+        snprintf(line, sizeof(line), "%d. %s + %s + %s  %.0f%%", i + 1,
+                 getMonsterByIndex(suggestion->indices[0])->name,
+                 getMonsterByIndex(suggestion->indices[1])->name,
+                 getMonsterByIndex(suggestion->indices[2])->name,
+                 suggestion->winRate * 100.0f);
+        DrawText(line, panel.x + 15, panel.y + 55 + i * 40, 18, i == 0 ? GOLD : WHITE);
+
+        Rectangle useBtnRect = {panel.x + panel.width - 95, panel.y + 48 + i * 40, 80, 32};
+        if (GuiPokemonButton(useBtnRect, "USAR", true))
+        {
+            PlaySound(selectSound);
+            TeamSuggestion chosen = *suggestion;
+            cancelTeamSuggestion();
+            applyTeamSuggestion(&chosen);
+            return;
+        }
+    }
+}
+
 void drawMonsterSelection(void)
 {
     // Atualizar timer
@@ -401,6 +582,25 @@ void drawMonsterSelection(void)
             DrawText(valueText, statBar.x + statBar.width + 10, statBar.y + 5, 18, WHITE);
         }
 
+        // Resumo da matriz de confrontos: nota média e o alvo mais fácil
+        int species = getSpeciesIndex(currentViewedMonster);
+        if (species >= 0 && species < matchupMatrix.count)
+        {
+            int easiest = 0;
+            for (int i = 1; i < matchupMatrix.count; i++)
+            {
+                if (getMatchupScoreByIndex(species, i) > getMatchupScoreByIndex(species, easiest))
+                {
+                    easiest = i;
+                }
+            }
+
+            char matchupText[96];
+            snprintf(matchupText, sizeof(matchupText), "Confrontos: %.0f%% (melhor contra %s)",
+                     matchupMatrix.averageScore[species] * 100.0f, getMonsterByIndex(easiest)->name);
+            DrawText(matchupText, statsRect.x + 450, statsRect.y + 330, 16, GOLD);
+        }
+
         for (int i = 0; i < 4; i++)
         {
             int col = i % 2;
@@ -665,42 +865,7 @@ void drawMonsterSelection(void)
                 if (GuiPokemonButton(selectBounds, "SELECIONAR", true))
                 {
                     PlaySound(selectSound);
-
-                    PokeMonster* newMonster = createMonsterCopy(monster);
-
-                    if (teamSelectionCount == 0)
-                    {
-                        addMonster(playerTeam, newMonster);
-
-                        if (playerTeam->count >= 3)
-                        {
-                            if (vsBot)
-                            {
-                                opponentTeam = generateRandomTeam(3);
-                                startNewBattle(playerTeam, opponentTeam);
-                                currentScreen = BATTLE_SCREEN;
-                                StopMusicStream(menuMusic);
-                                PlayMusicStream(battleMusic);
-                            }
-                            else
-                            {
-                                teamSelectionCount = 1;
-                                scrollOffset = 0;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        addMonster(opponentTeam, newMonster);
-
-                        if (opponentTeam->count >= 3)
-                        {
-                            startNewBattle(playerTeam, opponentTeam);
-                            currentScreen = BATTLE_SCREEN;
-                            StopMusicStream(menuMusic);
-                            PlayMusicStream(battleMusic);
-                        }
-                    }
+                    addMonsterToSelection(monster);
                 }
             }
 
@@ -740,7 +905,7 @@ void drawMonsterSelection(void)
             float handleY = startY + scrollRatio * (scrollbarHeight - handleHeight);
 
             // Alça com animação de pulso
-            float handlePulse = 1.0f + (isQueueEmpty(battleSystem ? battleSystem->actionQueue : NULL)
+            float handlePulse = 1.0f + (isQueueEmpty(battleSystem ? &battleSystem->actionQueue : NULL)
                                             ? sinf(selectionTimer * 3.0f) * 0.1f
                                             : 0.0f);
 
@@ -798,6 +963,7 @@ void drawMonsterSelection(void)
         if (GuiPokemonButton(backBtnRect, "VOLTAR", true))
         {
             PlaySound(selectSound);
+            cancelTeamSuggestion();
 
             if (teamSelectionCount == 1 && !vsBot)
             {
@@ -833,6 +999,8 @@ void drawMonsterSelection(void)
             }
         }
 
+        drawTeamSuggestion();
+
         // Contador de seleção com visual melhorado
         if (teamSelectionCount == 0 && playerTeam != NULL)
         {
@@ -945,6 +1113,20 @@ void drawMonsterSelection(void)
 
 void updateMonsterSelection(void)
 {
+    // Andamento da sugestão de time (nunca espera as threads)
+    if (teamBuilder != NULL)
+    {
+        getTeamBuilderProgress(teamBuilder, &suggestionProgress);
+        if (suggestionProgress.finished)
+        {
+            printf("[SUGESTÃO] %ld times, %ld simulados com %ld batalhas em %.0f ms\n",
+                   suggestionProgress.teamsTotal, suggestionProgress.candidates,
+                   suggestionProgress.battles, suggestionProgress.elapsedMs);
+            stopTeamBuilder(teamBuilder);
+            teamBuilder = NULL;
+        }
+    }
+
     // Processar rolagem com a roda do mouse
     if (!viewingStats)
     {
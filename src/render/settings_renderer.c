@@ -14,6 +14,7 @@
 #include "gui.h"
 #include "globals.h"
 #include "ia_integration.h"
+#include "battle.h"
 
 // Definição de resoluções disponíveis
 static Resolution availableResolutions[] = {
@@ -597,7 +598,7 @@ void drawSettings(void) {
                 // Descrição do status
                 const char* statusDesc = initialized ?
                     "O bot está usando IA para tomar decisões inteligentes." :
-                    "O bot está usando algoritmo simples (offline).";
+                    "O bot está usando busca local (offline).";
 
                 DrawText(statusDesc,
                          statusBox.x + 20,
@@ -658,6 +659,51 @@ void drawSettings(void) {
                     testAIConnection();
                 }
 
+                // Dificuldade do bot local (tempo de busca por jogada, ou a rede local)
+                float difficultyX = contentArea.x + 50 + testApiBtn.width + 60;
+                DrawText("Dificuldade do Bot",
+                         difficultyX,
+                         yPos + 20,
+                         24,
+                         WHITE);
+
+                Rectangle prevDiffButton = { difficultyX, yPos + 60, 40, 50 };
+                Rectangle currentDiffRect = { difficultyX + 50, yPos + 60, 160, 50 };
+                Rectangle nextDiffButton = { difficultyX + 220, yPos + 60, 40, 50 };
+
+                DrawRectangleRounded(prevDiffButton, 0.5f, 6, testBtnColor);
+                DrawRectangleRoundedLines(prevDiffButton, 0.5f, 6, WHITE);
+                DrawRectangleRounded(nextDiffButton, 0.5f, 6, testBtnColor);
+                DrawRectangleRoundedLines(nextDiffButton, 0.5f, 6, WHITE);
+                DrawRectangleGradientH(
+                    currentDiffRect.x, currentDiffRect.y, currentDiffRect.width, currentDiffRect.height,
+                    (Color){50, 30, 70, 200}, (Color){80, 40, 110, 200}
+                );
+                DrawRectangleRoundedLines(currentDiffRect, 0.3f, 6, WHITE);
+
+                DrawText("<", prevDiffButton.x + 14, prevDiffButton.y + 13, 24, WHITE);
+                DrawText(">", nextDiffButton.x + 14, nextDiffButton.y + 13, 24, WHITE);
+
+                const char* difficultyText = getBotDifficultyName(pendingDifficultyIndex);
+                DrawText(difficultyText,
+                         currentDiffRect.x + currentDiffRect.width/2 - MeasureText(difficultyText, 20)/2,
+                         currentDiffRect.y + currentDiffRect.height/2 - 10,
+                         20,
+                         WHITE);
+
+                if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+                    if (CheckCollisionPointRec(GetMousePosition(), prevDiffButton)) {
+                        pendingDifficultyIndex = (pendingDifficultyIndex - 1 + BOT_DIFFICULTY_COUNT) % BOT_DIFFICULTY_COUNT;
+                        PlaySound(selectSound);
+                        hasUnsavedChanges = true;
+                    }
+                    else if (CheckCollisionPointRec(GetMousePosition(), nextDiffButton)) {
+                        pendingDifficultyIndex = (pendingDifficultyIndex + 1) % BOT_DIFFICULTY_COUNT;
+                        PlaySound(selectSound);
+                        hasUnsavedChanges = true;
+                    }
+                }
+
                 yPos += 130;
 
                 // Caixa informativa sobre a IA
@@ -771,6 +817,7 @@ void drawSettings(void) {
             pendingSoundVolume = soundVolume;
             pendingFullscreen = fullscreen;
             pendingResolutionIndex = currentResolutionIndex;
+            pendingDifficultyIndex = difficultyIndex;
             hasUnsavedChanges = false;
         }
 
@@ -848,6 +895,9 @@ void applySettings(void) {
         SetWindowSize(width, height);
     }
 
+    // Dificuldade vale a partir da próxima jogada do bot
+    difficultyIndex = pendingDifficultyIndex;
+
     // Atualizar modo tela cheia
     if (fullscreen != pendingFullscreen) {
         fullscreen = pendingFullscreen;
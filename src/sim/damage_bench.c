@@ -0,0 +1,163 @@
+/**
+ * PokeBattle - pokebattle-damage-bench
+ *
+ * Compara o dano em lote (computeDamageBatch, em cada implementação que o
+ * processador suporta) com o laço direto sobre calculateDamageWithRoll, o
+ * mesmo cálculo que calculateDamage faz para uma variação. Todos os golpes
+ * do banco contra todos os monstros, com as 16 variações de cada par.
+ * Também confere se os resultados são idênticos.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "battle_rules.h"
+#include "damage_batch.h"
+#include "monster_data.h"
+
+#define ATTACKERS_PER_BATCH (DAMAGE_BATCH_MAX / 4)
+
+static double elapsedSeconds(const struct timespec* start) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+// Mínimo, esperado e máximo pelo caminho de sempre, um par por vez
+static void computeWithLoop(int firstAttacker, int attackerCount, DamageBatchResult* result) {
+    int monsters = getMonsterCount();
+
+    for (int a = 0; a < attackerCount; a++) {
+        PokeMonster* attacker = getMonsterByIndex(firstAttacker + a);
+        for (int k = 0; k < 4; k++) {
+            int m = a * 4 + k;
+            for (int d = 0; d < monsters; d++) {
+                PokeMonster* defender = getMonsterByIndex(d);
+                int minimum = 0, maximum = 0, sum = 0;
+                for (int r = 85; r <= 100; r++) {
+                    int damage = calculateDamageWithRoll(attacker, defender, &attacker->attacks[k], r);
+                    if (r == 85) minimum = damage;
+                    if (r == 100) maximum = damage;
+                    sum += damage;
+                }
+                result->minDamage[m][d] = minimum;
+                result->maxDamage[m][d] = maximum;
+                result->expectedDamage[m][d] = sum / 16.0f;
+            }
+        }
+    }
+}
+
+static void buildBatch(int firstAttacker, int attackerCount, DamageMoveBatch* moves, DamageDefenderBatch* defenders) {
+    memset(moves, 0, sizeof(DamageMoveBatch));
+    memset(defenders, 0, sizeof(DamageDefenderBatch));
+
+    for (int a = 0; a < attackerCount; a++) {
+        addDamageBatchMoves(moves, getMonsterByIndex(firstAttacker + a));
+    }
+    for (int d = 0; d < getMonsterCount(); d++) {
+        addDamageBatchDefender(defenders, getMonsterByIndex(d));
+    }
+}
+
+static bool sameResults(const DamageBatchResult* a, const DamageBatchResult* b, int moveCount, int defenderCount) {
+    for (int m = 0; m < moveCount; m++) {
+        for (int d = 0; d < defenderCount; d++) {
+            if (a->minDamage[m][d] != b->minDamage[m][d] ||
+                a->maxDamage[m][d] != b->maxDamage[m][d] ||
+                a->expectedDamage[m][d] != b->expectedDamage[m][d]) {
+                printf("ERRO: diferença no golpe %d contra o defensor %d\n", m, d);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int iterations = 200;
+    if (argc > 1) {
+        iterations = atoi(argv[1]);
+        if (iterations <= 0) {
+            printf("Uso: %s [repetições]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    battleDebugLog = false;
+    initializeMonsterDatabase();
+
+    int monsters = getMonsterCount();
+    if (monsters > DAMAGE_BATCH_MAX) {
+        printf("ERRO: mais de %d monstros no banco\n", DAMAGE_BATCH_MAX);
+        return 1;
+    }
+
+    DamageMoveBatch* moves = (DamageMoveBatch*)malloc(sizeof(DamageMoveBatch));
+    DamageDefenderBatch* defenders = (DamageDefenderBatch*)malloc(sizeof(DamageDefenderBatch));
+    DamageBatchResult* expected = (DamageBatchResult*)calloc(1, sizeof(DamageBatchResult));
+    DamageBatchResult* result = (DamageBatchResult*)calloc(1, sizeof(DamageBatchResult));
+    if (moves == NULL || defenders == NULL || expected == NULL || result == NULL) {
+        printf("ERRO: memória insuficiente\n");
+        return 1;
+    }
+
+    long pairs = (long)monsters * 4 * monsters;
+    printf("%ld pares golpe x defensor, 16 variações cada, %d repetições\n\n", pairs, iterations);
+
+    // Referência: laço sobre calculateDamageWithRoll
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+    for (int it = 0; it < iterations; it++) {
+        for (int first = 0; first < monsters; first += ATTACKERS_PER_BATCH) {
+            int count = monsters - first < ATTACKERS_PER_BATCH ? monsters - first : ATTACKERS_PER_BATCH;
+            computeWithLoop(first, count, expected);
+        }
+    }
+    double loopSeconds = elapsedSeconds(&start);
+    printf("%-8s %8.2f ns/par\n", "laço", loopSeconds * 1e9 / ((double)pairs * iterations));
+
+    bool allOk = true;
+    for (int kernel = DAMAGE_KERNEL_SCALAR; kernel < DAMAGE_KERNEL_COUNT; kernel++) {
+        if (!setDamageBatchKernel((DamageKernel)kernel)) {
+            printf("%-8s (não suportado neste processador)\n", getDamageKernelName((DamageKernel)kernel));
+            continue;
+        }
+
+        // Conferir antes de medir
+        bool ok = true;
+        for (int first = 0; first < monsters; first += ATTACKERS_PER_BATCH) {
+            int count = monsters - first < ATTACKERS_PER_BATCH ? monsters - first : ATTACKERS_PER_BATCH;
+            buildBatch(first, count, moves, defenders);
+            computeDamageBatch(moves, defenders, result);
+            computeWithLoop(first, count, expected);
+            ok = ok && sameResults(expected, result, moves->count, defenders->count);
+        }
+
+        timespec_get(&start, TIME_UTC);
+        for (int it = 0; it < iterations; it++) {
+            for (int first = 0; first < monsters; first += ATTACKERS_PER_BATCH) {
+                int count = monsters - first < ATTACKERS_PER_BATCH ? monsters - first : ATTACKERS_PER_BATCH;
+                buildBatch(first, count, moves, defenders);
+                computeDamageBatch(moves, defenders, result);
+            }
+        }
+        double seconds = elapsedSeconds(&start);
+        allOk = allOk && ok;
+
+        printf("%-8s %8.2f ns/par  %5.2fx  %s\n", getDamageKernelName((DamageKernel)kernel),
+               seconds * 1e9 / ((double)pairs * iterations), loopSeconds / seconds,
+               ok ? "resultados idênticos" : "RESULTADOS DIFERENTES");
+    }
+
+    setDamageBatchKernel(DAMAGE_KERNEL_AUTO);
+    printf("\nEm uso: %s\n", getDamageKernelName(getDamageBatchKernel()));
+
+    free(moves);
+    free(defenders);
+    free(expected);
+    free(result);
+    freeMonsterDatabase();
+    return allOk ? 0 : 1;
+}
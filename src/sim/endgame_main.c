@@ -0,0 +1,151 @@
+/**
+ * PokeBattle - pokebattle-endgame
+ *
+ * Gera a tabela de finais 1x1 (endgame_table.h) para o banco de monstros
+ * e, com --check, confere a tabela jogando finais sorteados: o jogador usa
+ * o ataque da tabela e o oponente o bot guloso, e a vitória observada é
+ * comparada com a chance prevista.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "battle_sim.h"
+#include "endgame_table.h"
+#include "monster_data.h"
+
+#define CHECK_BATTLES_PER_STATE 200
+#define CHECK_MAX_TURNS 100
+
+static void printUsage(const char* program) {
+    printf("Uso: %s [opções]\n", program);
+    printf("  --out ARQUIVO    arquivo gerado (padrão: %s)\n", ENDGAME_TABLE_FILE);
+    printf("  --threads T      threads (padrão: todos os núcleos)\n");
+    printf("  --check N        confere N finais sorteados com %d batalhas cada\n", CHECK_BATTLES_PER_STATE);
+    printf("  --seed S         semente do --check (padrão: 1)\n");
+}
+
+// Uma batalha 1x1 a partir de HPs dados. Retorna como getBattleWinner
+static int playEndgame(BattleContext* ctx, const EndgameTable* table, int mine, int theirs, int myHp, int foeHp) {
+    MonsterList* player = createMonsterList();
+    MonsterList* opponent = createMonsterList();
+    addMonster(player, createMonsterCopy(getMonsterByIndex(mine)));
+    addMonster(opponent, createMonsterCopy(getMonsterByIndex(theirs)));
+    beginBattle(ctx, player, opponent);
+    player->current->hp = myHp;
+    opponent->current->hp = foeHp;
+
+    while (!isBattleOver(ctx) && ctx->turn <= CHECK_MAX_TURNS) {
+        EndgameResult result;
+        int attack = 0;
+        if (lookupEndgame(table, ctx, true, &result)) {
+            attack = result.attackIndex;
+        } else {
+            // Fora da tabela (status ou atributos alterados): guloso
+            int action;
+            chooseBotAction(ctx, true, BOT_POLICY_GREEDY, &action, &attack);
+        }
+
+        int action, parameter;
+        chooseBotAction(ctx, false, BOT_POLICY_GREEDY, &action, &parameter);
+        queueBattleAction(ctx, 0, attack, player->current);
+        queueBattleAction(ctx, 0, parameter, opponent->current);
+        resolveTurn(ctx);
+    }
+
+    int winner = getBattleWinner(ctx);
+    freeMonsterList(player);
+    freeMonsterList(opponent);
+    return winner;
+}
+
+static void checkTable(const EndgameTable* table, int states, uint64_t seed) {
+    BattleContext* ctx = createBattleContext();
+    BattleRng rng;
+    battleRngSeed(&rng, seed);
+    seedBattleContext(ctx, seed);
+
+    double predicted = 0.0;
+    long wins = 0, battles = 0;
+    int count = getMonsterCount();
+    for (int s = 0; s < states; s++) {
+        int mine = battleRngRange(&rng, count);
+        int theirs = battleRngRange(&rng, count);
+        int myHp = 1 + battleRngRange(&rng, getMonsterByIndex(mine)->maxHp);
+        int foeHp = 1 + battleRngRange(&rng, getMonsterByIndex(theirs)->maxHp);
+
+        EndgameResult result;
+        if (!probeEndgame(table, mine, theirs, myHp, foeHp, &result)) {
+            continue;
+        }
+        for (int b = 0; b < CHECK_BATTLES_PER_STATE; b++) {
+            if (playEndgame(ctx, table, mine, theirs, myHp, foeHp) == 1) {
+                wins++;
+            }
+            predicted += result.winProbability;
+            battles++;
+        }
+    }
+
+    if (battles > 0) {
+        printf("Conferência: %ld batalhas, vitória prevista (garantida) %.4f, observada contra o guloso %.4f\n",
+               battles, predicted / battles, (double)wins / battles);
+    }
+    freeBattleContext(ctx);
+}
+
+int main(int argc, char** argv) {
+    const char* path = ENDGAME_TABLE_FILE;
+    int threads = 0;
+    int checkStates = 0;
+    uint64_t seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            printUsage(argv[0]);
+            return 0;
+        }
+
+        const char* value = (i + 1 < argc) ? argv[++i] : NULL;
+        if (value == NULL) {
+            printf("ERRO: faltou o valor de %s\n", arg);
+            return 1;
+        }
+
+        if (strcmp(arg, "--out") == 0) path = value;
+        else if (strcmp(arg, "--threads") == 0) threads = atoi(value);
+        else if (strcmp(arg, "--check") == 0) checkStates = atoi(value);
+        else if (strcmp(arg, "--seed") == 0) seed = strtoull(value, NULL, 10);
+        else {
+            printf("ERRO: opção desconhecida: %s\n", arg);
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    battleDebugLog = false;
+    initializeMonsterDatabase();
+
+    EndgameBuildStats stats;
+    if (!buildEndgameTable(path, threads, &stats)) {
+        freeMonsterDatabase();
+        return 1;
+    }
+    printf("%ld confrontos, %ld estados em %.2fs; %s com %.1f MB\n",
+           stats.pairs, stats.states, stats.elapsedMs / 1000.0, path, stats.fileBytes / (1024.0 * 1024.0));
+
+    if (checkStates > 0) {
+        EndgameTable* table = openEndgameTable(path);
+        if (table == NULL) {
+            freeMonsterDatabase();
+            return 1;
+        }
+        checkTable(table, checkStates, seed);
+        closeEndgameTable(table);
+    }
+
+    freeMonsterDatabase();
+    return 0;
+}
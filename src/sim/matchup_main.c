@@ -0,0 +1,417 @@
+/**
+ * PokeBattle - pokebattle-matchups
+ *
+ * Matriz de probabilidade de vitória por Monte Carlo: cada par ordenado de
+ * monstros do banco (ou de times de 3, com --teams3) joga N batalhas. O
+ * trabalho é dividido em faixas de células que se partem ao meio enquanto
+ * forem grandes, e o pool com roubo de tarefas equilibra os núcleos.
+ *
+ * Saídas:
+ *   PREFIXO.csv  linha,coluna,batalhas,vitórias,empates,p,IC95 (Wilson)
+ *   PREFIXO.bin  cabeçalho MatchupFileHeader, índices dos times (int32)
+ *                e, para cada célula em ordem de linha, vitórias e empates
+ *                do time da linha (uint32 cada)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "battle_sim.h"
+#include "monster_data.h"
+#include "work_pool.h"
+
+#define MATCHUP_MAGIC "PBMX"
+#define MATCHUP_VERSION 2
+#define MATCHUP_GRAIN 16   // Células por tarefa, abaixo disso não divide mais
+
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t teamSize;
+    uint32_t gamesPerCell;
+    uint32_t maxTurns;
+    uint32_t format;       // BattleFormat (monstros em campo por lado)
+    uint32_t reserved;
+    uint64_t seed;
+} MatchupFileHeader;
+
+typedef struct {
+    TeamSpec* entries;
+    int entryCount;
+    int games;
+    int maxTurns;
+    uint64_t seed;
+    BotPolicy policy;
+    BattleFormat format;
+    BattleContext** contexts;   // Um por thread do pool
+    uint32_t* wins;
+    uint32_t* draws;
+    WorkPool* pool;
+} MatchupJob;
+
+typedef struct {
+    MatchupJob* job;
+    long begin;
+    long end;
+} CellRange;
+
+static void runCellRange(void* arg, int workerIndex);
+
+static void printUsage(const char* program) {
+    printf("Uso: %s [opções]\n", program);
+    printf("  --games N        batalhas por par (padrão: 1000)\n");
+    printf("  --seed S         semente (padrão: 1)\n");
+    printf("  --threads T      threads (padrão: todos os núcleos)\n");
+    printf("  --policy P       random | greedy | simple | expectimax | mcts | first (padrão: greedy)\n");
+    printf("  --max-turns T    limite de turnos por batalha (padrão: 200)\n");
+    printf("  --teams3         times de 3 monstros em vez de monstros individuais\n");
+    printf("  --team-sample K  quantos times de 3 sortear (padrão: 64, 0 = todos)\n");
+    printf("  --format F       singles | doubles | triples (padrão: singles)\n");
+    printf("  --out PREFIXO    arquivos de saída (padrão: matchups)\n");
+}
+
+// Semente própria de cada célula: o resultado não depende da ordem das threads
+static uint64_t cellSeed(uint64_t seed, long cell) {
+    return seed ^ ((uint64_t)(cell + 1) * 0x9E3779B97F4A7C15ULL);
+}
+
+static void simulateCell(MatchupJob* job, BattleContext* ctx, long cell) {
+    int row = (int)(cell / job->entryCount);
+    int col = (int)(cell % job->entryCount);
+
+    seedBattleContext(ctx, cellSeed(job->seed, cell));
+
+    uint32_t wins = 0, draws = 0;
+    for (int g = 0; g < job->games; g++) {
+        MonsterList* player = createTeamFromSpec(&job->entries[row], &ctx->rng);
+        MonsterList* opponent = createTeamFromSpec(&job->entries[col], &ctx->rng);
+
+        int winner = playHeadlessBattle(ctx, player, opponent, job->policy, job->policy, job->maxTurns);
+        if (winner == 1) wins++;
+        else if (winner == 0) draws++;
+
+        freeMonsterList(player);
+        freeMonsterList(opponent);
+    }
+
+    job->wins[cell] = wins;
+    job->draws[cell] = draws;
+}
+
+static bool submitCellRange(MatchupJob* job, long begin, long end) {
+    CellRange* range = (CellRange*)malloc(sizeof(CellRange));
+    if (range == NULL) {
+        return false;
+    }
+    range->job = job;
+    range->begin = begin;
+    range->end = end;
+    return submitWorkTask(job->pool, runCellRange, range);
+}
+
+// Divide a faixa ao meio enquanto for grande; a metade de cima fica na fila
+// da thread e pode ser roubada por quem estiver sem trabalho
+static void runCellRange(void* arg, int workerIndex) {
+    CellRange* range = (CellRange*)arg;
+    MatchupJob* job = range->job;
+    long begin = range->begin;
+    long end = range->end;
+    free(range);
+
+    while (end - begin > MATCHUP_GRAIN) {
+        long middle = begin + (end - begin) / 2;
+        if (!submitCellRange(job, middle, end)) {
+            break;
+        }
+        end = middle;
+    }
+
+    for (long cell = begin; cell < end; cell++) {
+        simulateCell(job, job->contexts[workerIndex], cell);
+    }
+}
+
+// Intervalo de confiança de Wilson (95%) para p com n batalhas
+static void wilsonInterval(double p, int n, double* low, double* high) {
+    const double z = 1.96;
+    double z2 = z * z;
+    double denominator = 1.0 + z2 / n;
+    double center = (p + z2 / (2.0 * n)) / denominator;
+    double margin = z * sqrt(p * (1.0 - p) / n + z2 / (4.0 * n * n)) / denominator;
+    *low = center - margin;
+    *high = center + margin;
+    if (*low < 0.0) *low = 0.0;
+    if (*high > 1.0) *high = 1.0;
+}
+
+static void formatEntryName(const TeamSpec* entry, char* buffer, size_t size) {
+    buffer[0] = '\0';
+    for (int i = 0; i < entry->count; i++) {
+        if (i > 0) strncat(buffer, "+", size - strlen(buffer) - 1);
+        strncat(buffer, getMonsterByIndex(entry->indices[i])->name, size - strlen(buffer) - 1);
+    }
+}
+
+static bool writeCsv(const MatchupJob* job, const char* path) {
+    FILE* file = fopen(path, "w");
+    if (file == NULL) {
+        printf("ERRO: não foi possível criar %s\n", path);
+        return false;
+    }
+
+    fprintf(file, "row,col,games,wins,draws,winProbability,ciLow,ciHigh\n");
+    for (int row = 0; row < job->entryCount; row++) {
+        char rowName[128];
+        formatEntryName(&job->entries[row], rowName, sizeof(rowName));
+
+        for (int col = 0; col < job->entryCount; col++) {
+            char colName[128];
+            formatEntryName(&job->entries[col], colName, sizeof(colName));
+
+            long cell = (long)row * job->entryCount + col;
+            double p = (job->wins[cell] + 0.5 * job->draws[cell]) / job->games;
+            double low, high;
+            wilsonInterval(p, job->games, &low, &high);
+
+            fprintf(file, "%s,%s,%d,%u,%u,%.4f,%.4f,%.4f\n", rowName, colName, job->games,
+                    job->wins[cell], job->draws[cell], p, low, high);
+        }
+    }
+
+    fclose(file);
+    return true;
+}
+
+static bool writeBinary(const MatchupJob* job, const char* path) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        printf("ERRO: não foi possível criar %s\n", path);
+        return false;
+    }
+
+    MatchupFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MATCHUP_MAGIC, 4);
+    header.version = MATCHUP_VERSION;
+    header.entryCount = (uint32_t)job->entryCount;
+    header.teamSize = (uint32_t)job->entries[0].count;
+    header.gamesPerCell = (uint32_t)job->games;
+    header.maxTurns = (uint32_t)job->maxTurns;
+    header.format = (uint32_t)job->format;
+    header.seed = job->seed;
+    fwrite(&header, sizeof(header), 1, file);
+
+    for (int i = 0; i < job->entryCount; i++) {
+        for (int k = 0; k < job->entries[i].count; k++) {
+            int32_t index = job->entries[i].indices[k];
+            fwrite(&index, sizeof(index), 1, file);
+        }
+    }
+
+    long cells = (long)job->entryCount * job->entryCount;
+    for (long cell = 0; cell < cells; cell++) {
+        uint32_t pair[2] = {job->wins[cell], job->draws[cell]};
+        fwrite(pair, sizeof(pair), 1, file);
+    }
+
+    fclose(file);
+    return true;
+}
+
+// Monta a lista de entradas: monstros individuais ou times de 3
+static TeamSpec* buildEntries(bool teams3, int sample, uint64_t seed, int* count) {
+    int monsters = getMonsterCount();
+
+    if (!teams3) {
+        TeamSpec* entries = (TeamSpec*)calloc(monsters, sizeof(TeamSpec));
+        if (entries == NULL) return NULL;
+        for (int i = 0; i < monsters; i++) {
+            entries[i].indices[0] = i;
+            entries[i].count = 1;
+        }
+        *count = monsters;
+        return entries;
+    }
+
+    long combinations = (long)monsters * (monsters - 1) * (monsters - 2) / 6;
+    if (sample <= 0 || sample > combinations) {
+        // Todas as combinações, em ordem lexicográfica
+        TeamSpec* entries = (TeamSpec*)calloc(combinations, sizeof(TeamSpec));
+        if (entries == NULL) return NULL;
+        long n = 0;
+        for (int a = 0; a < monsters; a++)
+            for (int b = a + 1; b < monsters; b++)
+                for (int c = b + 1; c < monsters; c++) {
+                    entries[n].indices[0] = a;
+                    entries[n].indices[1] = b;
+                    entries[n].indices[2] = c;
+                    entries[n].count = 3;
+                    n++;
+                }
+        *count = (int)combinations;
+        return entries;
+    }
+
+    // Amostra de times distintos (monstros em ordem crescente, sem repetir time)
+    TeamSpec* entries = (TeamSpec*)calloc(sample, sizeof(TeamSpec));
+    if (entries == NULL) return NULL;
+
+    BattleRng rng;
+    battleRngSeed(&rng, seed);
+    int n = 0;
+    while (n < sample) {
+        int t[3];
+        t[0] = battleRngRange(&rng, monsters);
+        do { t[1] = battleRngRange(&rng, monsters); } while (t[1] == t[0]);
+        do { t[2] = battleRngRange(&rng, monsters); } while (t[2] == t[0] || t[2] == t[1]);
+
+        // Ordenar os três índices
+        if (t[0] > t[1]) { int x = t[0]; t[0] = t[1]; t[1] = x; }
+        if (t[1] > t[2]) { int x = t[1]; t[1] = t[2]; t[2] = x; }
+        if (t[0] > t[1]) { int x = t[0]; t[0] = t[1]; t[1] = x; }
+
+        bool repeated = false;
+        for (int i = 0; i < n && !repeated; i++) {
+            repeated = memcmp(entries[i].indices, t, sizeof(t)) == 0;
+        }
+        if (repeated) continue;
+
+        memcpy(entries[n].indices, t, sizeof(t));
+        entries[n].count = 3;
+        n++;
+    }
+
+    *count = sample;
+    return entries;
+}
+
+int main(int argc, char** argv) {
+    int games = 1000;
+    uint64_t seed = 1;
+    int threads = 0;
+    BotPolicy policy = BOT_POLICY_GREEDY;
+    int maxTurns = 200;
+    bool teams3 = false;
+    int sample = 64;
+    const char* prefix = "matchups";
+    BattleFormat format = BATTLE_FORMAT_SINGLES;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            printUsage(argv[0]);
+            return 0;
+        }
+        if (strcmp(arg, "--teams3") == 0) {
+            teams3 = true;
+            continue;
+        }
+
+        const char* value = (i + 1 < argc) ? argv[++i] : NULL;
+        if (value == NULL) {
+            printf("ERRO: faltou o valor de %s\n", arg);
+            return 1;
+        }
+
+        if (strcmp(arg, "--games") == 0) games = atoi(value);
+        else if (strcmp(arg, "--seed") == 0) seed = strtoull(value, NULL, 10);
+        else if (strcmp(arg, "--threads") == 0) threads = atoi(value);
+        else if (strcmp(arg, "--max-turns") == 0) maxTurns = atoi(value);
+        else if (strcmp(arg, "--team-sample") == 0) sample = atoi(value);
+        else if (strcmp(arg, "--out") == 0) prefix = value;
+        else if (strcmp(arg, "--format") == 0) {
+            if (!parseBattleFormat(value, &format)) {
+                printf("ERRO: formato desconhecido: %s\n", value);
+                return 1;
+            }
+        } else if (strcmp(arg, "--policy") == 0) {
+            if (!parseBotPolicy(value, &policy)) {
+                printf("ERRO: política desconhecida: %s\n", value);
+                return 1;
+            }
+        } else {
+            printf("ERRO: opção desconhecida: %s\n", arg);
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (games <= 0 || maxTurns <= 0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    battleDebugLog = false;
+    initializeMonsterDatabase();
+
+    MatchupJob job;
+    memset(&job, 0, sizeof(job));
+    job.games = games;
+    job.maxTurns = maxTurns;
+    job.seed = seed;
+    job.policy = policy;
+    job.format = format;
+    job.entries = buildEntries(teams3, sample, seed, &job.entryCount);
+    if (job.entries == NULL) {
+        printf("ERRO: memória insuficiente para as entradas\n");
+        freeMonsterDatabase();
+        return 1;
+    }
+
+    long cells = (long)job.entryCount * job.entryCount;
+    job.wins = (uint32_t*)calloc(cells, sizeof(uint32_t));
+    job.draws = (uint32_t*)calloc(cells, sizeof(uint32_t));
+    job.pool = createWorkPool(threads);
+    if (job.wins == NULL || job.draws == NULL || job.pool == NULL) {
+        printf("ERRO: memória insuficiente para a matriz (%ld células)\n", cells);
+        return 1;
+    }
+
+    int threadCount = getWorkPoolThreadCount(job.pool);
+    job.contexts = (BattleContext**)calloc(threadCount, sizeof(BattleContext*));
+    for (int i = 0; i < threadCount; i++) {
+        job.contexts[i] = createBattleContext();
+        setBattleFormat(job.contexts[i], format);
+    }
+
+    printf("Simulando %d x %d %s (%s), %d batalhas por par, %d threads...\n",
+           job.entryCount, job.entryCount, teams3 ? "times" : "monstros",
+           getBattleFormatName(format), games, threadCount);
+
+    struct timespec start, finish;
+    timespec_get(&start, TIME_UTC);
+
+    submitCellRange(&job, 0, cells);
+    waitWorkPool(job.pool);
+
+    timespec_get(&finish, TIME_UTC);
+    double seconds = (finish.tv_sec - start.tv_sec) + (finish.tv_nsec - start.tv_nsec) / 1e9;
+    double battles = (double)cells * games;
+
+    printf("%.0f batalhas em %.2fs (%.0f batalhas/s, %ld roubos de tarefa)\n",
+           battles, seconds, seconds > 0.0 ? battles / seconds : 0.0, getWorkPoolSteals(job.pool));
+
+    char path[512];
+    snprintf(path, sizeof(path), "%s.csv", prefix);
+    bool ok = writeCsv(&job, path);
+    snprintf(path, sizeof(path), "%s.bin", prefix);
+    ok = writeBinary(&job, path) && ok;
+    if (ok) {
+        printf("Matriz salva em %s.csv e %s.bin\n", prefix, prefix);
+    }
+
+    freeWorkPool(job.pool);
+    for (int i = 0; i < threadCount; i++) {
+        freeBattleContext(job.contexts[i]);
+    }
+    free(job.contexts);
+    free(job.wins);
+    free(job.draws);
+    free(job.entries);
+    freeMonsterDatabase();
+    return ok ? 0 : 1;
+}
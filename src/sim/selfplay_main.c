@@ -0,0 +1,314 @@
+/**
+ * PokeBattle - pokebattle-selfplay
+ *
+ * Gera as amostras de treino da rede de política (policy_net.h): partidas
+ * em simples com a busca expectimax dos dois lados, em todos os núcleos.
+ * Em cada decisão fica guardado o que a rede vê (as entradas já
+ * quantizadas), as ações válidas e a escolha da busca. Com --epsilon, uma
+ * fração das jogadas é sorteada entre as válidas para as partidas passarem
+ * por posições que a busca não visitaria; a amostra continua com a escolha
+ * da busca. Com --net as jogadas saem de uma rede já treinada e a busca só
+ * dá a resposta certa (DAgger): a próxima rede aprende a sair das posições
+ * em que a anterior se mete. Exemplo:
+ *
+ *   pokebattle-selfplay --games 4000 --depth 1 --out selfplay.bin
+ *   pokebattle-selfplay --games 2000 --net policy.bin --out dagger.bin
+ *
+ * Mesmas opções e semente geram o mesmo arquivo, com qualquer número de
+ * threads (cada partida tem a sua semente e o resultado sai na ordem).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "battle_search.h"
+#include "battle_sim.h"
+#include "monster_data.h"
+#include "policy_net.h"
+#include "work_pool.h"
+
+typedef struct {
+    TeamSpec spec;
+    int maxTurns;
+    int depth;
+    double epsilon;
+    uint64_t seed;
+    const PolicyNet* net;        // Quem joga (NULL: a própria busca)
+    BattleContext** contexts;    // Um por thread
+} SelfplayJob;
+
+typedef struct {
+    SelfplayJob* job;
+    int index;
+    PolicySample* samples;
+    long sampleCount;
+    int winner;
+    int turns;
+} SelfplayGame;
+
+static void printUsage(const char* program) {
+    printf("Uso: %s --out ARQUIVO [opções]\n", program);
+    printf("  --games N        partidas (padrão: 2000)\n");
+    printf("  --team-size K    monstros sorteados por time (padrão: 3)\n");
+    printf("  --depth D        profundidade da busca que ensina (padrão: 1)\n");
+    printf("  --epsilon E      fração das jogadas sorteadas (padrão: 0.1)\n");
+    printf("  --seed S         semente (padrão: 1)\n");
+    printf("  --threads T      threads (padrão: todos os núcleos)\n");
+    printf("  --max-turns T    limite de turnos por partida (padrão: 200)\n");
+    printf("  --net ARQUIVO    joga com esta rede; a busca só rotula as decisões\n");
+}
+
+// Substitui o monstro desmaiado do lado, como o simulador
+static void replaceFainted(BattleContext* ctx, bool isPlayerSide) {
+    MonsterList* team = isPlayerSide ? ctx->playerTeam : ctx->opponentTeam;
+    if (team->current != NULL && !isMonsterFainted(team->current)) {
+        return;
+    }
+    PokeMonster* replacement = chooseBotReplacement(ctx, isPlayerSide, BOT_POLICY_EXPECTIMAX);
+    if (replacement != NULL) {
+        setActiveMonster(ctx, isPlayerSide, 0, replacement);
+    }
+}
+
+// Sorteia uma saída entre as válidas
+static int randomLegalSlot(BattleRng* rng, uint16_t legalMask) {
+    int legal[POLICY_NET_OUTPUTS];
+    int count = 0;
+    for (int i = 0; i < POLICY_NET_OUTPUTS; i++) {
+        if (legalMask & (1u << i)) {
+            legal[count++] = i;
+        }
+    }
+    return legal[battleRngRange(rng, count)];
+}
+
+// Decide a ação de um lado, guarda a amostra e põe a jogada na fila
+static void playSide(SelfplayGame* game, BattleContext* ctx, bool isPlayerSide, BattleRng* exploreRng,
+                     long* capacity) {
+    MonsterList* team = isPlayerSide ? ctx->playerTeam : ctx->opponentTeam;
+    PokeMonster* self = team->current;
+    if (self == NULL || isMonsterFainted(self)) {
+        return;
+    }
+
+    SearchLimits limits = { 0, game->job->depth, NULL };
+    SearchResult search;
+    chooseSearchAction(ctx, isPlayerSide, &limits, &search);
+    int action = search.action;
+    int parameter = search.parameter;
+
+    float features[POLICY_NET_INPUTS];
+    uint16_t legalMask;
+    int slot = getPolicyActionSlot(action, parameter);
+    if (extractPolicyFeatures(ctx, isPlayerSide, features, &legalMask) &&
+        slot >= 0 && (legalMask & (1u << slot))) {
+        if (game->sampleCount == *capacity) {
+            *capacity = *capacity > 0 ? *capacity * 2 : 64;
+            PolicySample* grown = realloc(game->samples, *capacity * sizeof(PolicySample));
+            if (grown == NULL) {
+                return;
+            }
+            game->samples = grown;
+        }
+
+        PolicySample* sample = &game->samples[game->sampleCount++];
+        quantizePolicyFeatures(features, sample->features);
+        sample->legalMask = legalMask;
+        sample->action = (uint8_t)slot;
+        sample->outcome = isPlayerSide ? 1 : -1;    // Corrigido no fim da partida
+
+        if ((battleRngNext(exploreRng) >> 11) * 0x1.0p-53 < game->job->epsilon) {
+            getPolicySlotAction(ctx, randomLegalSlot(exploreRng, legalMask), &action, &parameter);
+        } else if (game->job->net != NULL) {
+            float logits[POLICY_NET_OUTPUTS];
+            evaluatePolicyNet(game->job->net, features, logits);
+            int best = -1;
+            for (int i = 0; i < POLICY_NET_OUTPUTS; i++) {
+                if ((legalMask & (1u << i)) && (best < 0 || logits[i] > logits[best])) {
+                    best = i;
+                }
+            }
+            getPolicySlotAction(ctx, best, &action, &parameter);
+        }
+    }
+
+    queueBattleAction(ctx, action, parameter, self);
+}
+
+static void playSelfplayGame(void* arg, int workerIndex) {
+    SelfplayGame* game = (SelfplayGame*)arg;
+    SelfplayJob* job = game->job;
+    BattleContext* ctx = job->contexts[workerIndex];
+
+    // Times, regras e exploração com sub-fluxos separados da semente da partida
+    BattleRng gameRng;
+    battleRngSeed(&gameRng, job->seed ^ (0x9E3779B97F4A7C15ULL * (uint64_t)(game->index + 1)));
+    BattleRng exploreRng;
+    battleRngFork(&gameRng, &exploreRng);
+
+    MonsterList* player = createTeamFromSpec(&job->spec, &gameRng);
+    MonsterList* opponent = createTeamFromSpec(&job->spec, &gameRng);
+    seedBattleContext(ctx, battleRngNext(&gameRng));
+    beginBattle(ctx, player, opponent);
+    ctx->battleState = BATTLE_SELECT_ACTION;
+
+    long capacity = 0;
+    while (!isBattleOver(ctx) && ctx->turn <= job->maxTurns) {
+        replaceFainted(ctx, true);
+        replaceFainted(ctx, false);
+
+        playSide(game, ctx, true, &exploreRng, &capacity);
+        playSide(game, ctx, false, &exploreRng, &capacity);
+
+        ctx->actionQueueReady = true;
+        resolveTurn(ctx);
+    }
+
+    game->winner = getBattleWinner(ctx);
+    game->turns = ctx->turn;
+    ctx->battleState = BATTLE_OVER;
+
+    // outcome guardou o lado de quem decidiu (1 jogador, -1 oponente)
+    for (long i = 0; i < game->sampleCount; i++) {
+        int8_t side = game->samples[i].outcome;
+        game->samples[i].outcome = game->winner == 0 ? 0 :
+                                   (int8_t)(((game->winner == 1) == (side == 1)) ? 1 : -1);
+    }
+
+    freeMonsterList(player);
+    freeMonsterList(opponent);
+}
+
+int main(int argc, char** argv) {
+    SelfplayJob job;
+    memset(&job, 0, sizeof(job));
+    job.maxTurns = 200;
+    job.depth = 1;
+    job.epsilon = 0.1;
+    job.seed = 1;
+
+    const char* outPath = NULL;
+    const char* netPath = NULL;
+    int games = 2000;
+    int teamSize = 3;
+    int threads = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            printUsage(argv[0]);
+            return 0;
+        }
+
+        const char* value = (i + 1 < argc) ? argv[++i] : NULL;
+        if (value == NULL) {
+            printf("ERRO: faltou o valor de %s\n", arg);
+            return 1;
+        }
+
+        if (strcmp(arg, "--out") == 0) outPath = value;
+        else if (strcmp(arg, "--games") == 0) games = atoi(value);
+        else if (strcmp(arg, "--team-size") == 0) teamSize = atoi(value);
+        else if (strcmp(arg, "--depth") == 0) job.depth = atoi(value);
+        else if (strcmp(arg, "--epsilon") == 0) job.epsilon = atof(value);
+        else if (strcmp(arg, "--seed") == 0) job.seed = strtoull(value, NULL, 10);
+        else if (strcmp(arg, "--threads") == 0) threads = atoi(value);
+        else if (strcmp(arg, "--max-turns") == 0) job.maxTurns = atoi(value);
+        else if (strcmp(arg, "--net") == 0) netPath = value;
+        else {
+            printf("ERRO: opção desconhecida: %s\n", arg);
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (outPath == NULL || games <= 0 || job.maxTurns <= 0 || teamSize < 1 || teamSize > SIM_MAX_TEAM_SIZE ||
+        job.depth < 1 || job.depth > SEARCH_MAX_DEPTH || job.epsilon < 0.0 || job.epsilon > 1.0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    job.spec.randomCount = teamSize;
+
+    PolicyNet* net = NULL;
+    if (netPath != NULL) {
+        net = loadPolicyNet(netPath);
+        if (net == NULL) {
+            printf("ERRO: não foi possível carregar a rede %s\n", netPath);
+            return 1;
+        }
+        job.net = net;
+    }
+
+    battleDebugLog = false;
+    initializeMonsterDatabase();
+
+    WorkPool* pool = createWorkPool(threads);
+    SelfplayGame* list = calloc(games, sizeof(SelfplayGame));
+    if (pool == NULL || list == NULL) {
+        printf("ERRO: não foi possível criar as threads\n");
+        freeWorkPool(pool);
+        free(list);
+        freePolicyNet(net);
+        freeMonsterDatabase();
+        return 1;
+    }
+    int threadCount = getWorkPoolThreadCount(pool);
+    job.contexts = calloc(threadCount, sizeof(BattleContext*));
+    for (int i = 0; i < threadCount; i++) {
+        job.contexts[i] = createBattleContext();
+    }
+
+    printf("Autojogo: %d partidas, times de %d, busca com profundidade %d, epsilon %.2f, %d threads%s\n",
+           games, teamSize, job.depth, job.epsilon, threadCount, net != NULL ? ", jogadas pela rede" : "");
+
+    struct timespec start, finish;
+    timespec_get(&start, TIME_UTC);
+
+    for (int i = 0; i < games; i++) {
+        list[i].job = &job;
+        list[i].index = i;
+        submitWorkTask(pool, playSelfplayGame, &list[i]);
+    }
+    waitWorkPool(pool);
+
+    timespec_get(&finish, TIME_UTC);
+    double seconds = (finish.tv_sec - start.tv_sec) + (finish.tv_nsec - start.tv_nsec) / 1e9;
+
+    // Junta na ordem das partidas
+    long total = 0;
+    long turns = 0;
+    long wins[3] = {0, 0, 0};
+    for (int i = 0; i < games; i++) {
+        total += list[i].sampleCount;
+        turns += list[i].turns;
+        wins[list[i].winner >= 0 && list[i].winner <= 2 ? list[i].winner : 0]++;
+    }
+    PolicySample* samples = malloc((total > 0 ? total : 1) * sizeof(PolicySample));
+    long offset = 0;
+    for (int i = 0; i < games && samples != NULL; i++) {
+        memcpy(samples + offset, list[i].samples, list[i].sampleCount * sizeof(PolicySample));
+        offset += list[i].sampleCount;
+    }
+
+    bool ok = samples != NULL && savePolicySamples(outPath, samples, total);
+    if (ok) {
+        printf("%ld amostras em %s (%.1f turnos por partida; jogador %ld, oponente %ld, empates %ld)\n",
+               total, outPath, (double)turns / games, wins[1], wins[2], wins[0]);
+        printf("%.2fs (%.0f partidas/s, %.0f amostras/s)\n", seconds, games / seconds, total / seconds);
+    }
+
+    for (int i = 0; i < games; i++) {
+        free(list[i].samples);
+    }
+    free(list);
+    free(samples);
+    for (int i = 0; i < threadCount; i++) {
+        freeBattleContext(job.contexts[i]);
+    }
+    free(job.contexts);
+    freeWorkPool(pool);
+    freePolicyNet(net);
+    freeMonsterDatabase();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,254 @@
+/**
+ * PokeBattle - pokebattle-sim
+ *
+ * Roda N batalhas completas sem janela, na velocidade máxima, e imprime
+ * as estatísticas em JSON. Exemplo:
+ *
+ *   pokebattle-sim --team1 Charizard,Blastoise --team2 random:2 \
+ *                  --policy1 greedy --policy2 simple --seed 42 --battles 1000
+ *
+ * Com --format doubles ou triples, cada lado põe 2 ou 3 monstros em campo.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "battle_sim.h"
+#include "monster_data.h"
+
+#define SIM_MAX_MOVES 512
+
+typedef struct {
+    char name[32];
+    long hits;
+    long damage;
+} MoveStats;
+
+typedef struct {
+    char name[32];
+    long count;
+} FaintStats;
+
+typedef struct {
+    MoveStats moves[SIM_MAX_MOVES];
+    int moveCount;
+    FaintStats faints[SIM_MAX_MOVES];
+    int faintCount;
+} SimStats;
+
+static void printUsage(const char* program) {
+    printf("Uso: %s --team1 TIME --team2 TIME [opções]\n", program);
+    printf("  TIME: nomes ou índices separados por vírgula, ou random:N\n");
+    printf("  --policy1 / --policy2  random | greedy | simple | expectimax | mcts | first | net (padrão: simple)\n");
+    printf("  --seed S               semente (padrão: 1)\n");
+    printf("  --battles N            número de batalhas (padrão: 100)\n");
+    printf("  --max-turns T          limite de turnos por batalha (padrão: 200)\n");
+    printf("  --format F             singles | doubles | triples (padrão: singles)\n");
+    printf("  --net ARQUIVO          pesos da política net (padrão: resources/%s)\n", POLICY_NET_FILE);
+}
+
+// Escreve uma string JSON com as aspas e barras escapadas
+static void printJsonString(const char* text) {
+    putchar('"');
+    for (const char* c = text; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') putchar('\\');
+        putchar(*c);
+    }
+    putchar('"');
+}
+
+// Coleta dano por golpe e desmaios a partir dos eventos das regras
+static void collectBattleEvent(const BattleEvent* event, void* userData) {
+    SimStats* stats = (SimStats*)userData;
+
+    if (event->type == BATTLE_EVENT_DAMAGE && event->attack != NULL) {
+        int i = 0;
+        while (i < stats->moveCount && strcmp(stats->moves[i].name, event->attack->name) != 0) {
+            i++;
+        }
+        if (i == stats->moveCount) {
+            if (stats->moveCount >= SIM_MAX_MOVES) return;
+            strcpy(stats->moves[i].name, event->attack->name);
+            stats->moveCount++;
+        }
+        stats->moves[i].hits++;
+        stats->moves[i].damage += event->value;
+    } else if (event->type == BATTLE_EVENT_FAINT && event->target != NULL) {
+        int i = 0;
+        while (i < stats->faintCount && strcmp(stats->faints[i].name, event->target->name) != 0) {
+            i++;
+        }
+        if (i == stats->faintCount) {
+            if (stats->faintCount >= SIM_MAX_MOVES) return;
+            strcpy(stats->faints[i].name, event->target->name);
+            stats->faintCount++;
+        }
+        stats->faints[i].count++;
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* teamText[2] = {NULL, NULL};
+    BotPolicy policies[2] = {BOT_POLICY_SIMPLE, BOT_POLICY_SIMPLE};
+    unsigned long long seed = 1;
+    long battles = 100;
+    int maxTurns = 200;
+    BattleFormat format = BATTLE_FORMAT_SINGLES;
+    const char* netPath = "resources/" POLICY_NET_FILE;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            printUsage(argv[0]);
+            return 0;
+        }
+        if (value == NULL) {
+            printf("ERRO: faltou o valor de %s\n", arg);
+            return 1;
+        }
+
+        if (strcmp(arg, "--team1") == 0) {
+            teamText[0] = value;
+        } else if (strcmp(arg, "--team2") == 0) {
+            teamText[1] = value;
+        } else if (strcmp(arg, "--policy1") == 0 || strcmp(arg, "--policy2") == 0) {
+            int side = (arg[8] == '1') ? 0 : 1;
+            if (!parseBotPolicy(value, &policies[side])) {
+                printf("ERRO: política desconhecida: %s\n", value);
+                return 1;
+            }
+        } else if (strcmp(arg, "--seed") == 0) {
+            seed = strtoull(value, NULL, 10);
+        } else if (strcmp(arg, "--battles") == 0) {
+            battles = atol(value);
+        } else if (strcmp(arg, "--max-turns") == 0) {
+            maxTurns = atoi(value);
+        } else if (strcmp(arg, "--format") == 0) {
+            if (!parseBattleFormat(value, &format)) {
+                printf("ERRO: formato desconhecido: %s\n", value);
+                return 1;
+            }
+        } else if (strcmp(arg, "--net") == 0) {
+            netPath = value;
+        } else {
+            printf("ERRO: opção desconhecida: %s\n", arg);
+            printUsage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+
+    if (teamText[0] == NULL || teamText[1] == NULL || battles <= 0 || maxTurns <= 0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // Sem logs de depuração: a saída padrão é só o JSON
+    battleDebugLog = false;
+    initializeMonsterDatabase();
+
+    TeamSpec specs[2];
+    for (int side = 0; side < 2; side++) {
+        if (!parseTeamSpec(teamText[side], &specs[side])) {
+            printf("ERRO: time inválido: %s\n", teamText[side]);
+            freeMonsterDatabase();
+            return 1;
+        }
+    }
+
+    PolicyNet* net = NULL;
+    if (policies[0] == BOT_POLICY_NET || policies[1] == BOT_POLICY_NET) {
+        net = loadPolicyNet(netPath);
+        if (net == NULL) {
+            printf("ERRO: não foi possível carregar a rede %s\n", netPath);
+            freeMonsterDatabase();
+            return 1;
+        }
+        setBotPolicyNet(net);
+    }
+
+    SimStats* stats = (SimStats*)calloc(1, sizeof(SimStats));
+    BattleContext* ctx = createBattleContext();
+    if (stats == NULL || ctx == NULL) {
+        printf("ERRO: memória insuficiente\n");
+        free(stats);
+        freeBattleContext(ctx);
+        freePolicyNet(net);
+        freeMonsterDatabase();
+        return 1;
+    }
+    setBattleEventHandler(ctx, collectBattleEvent, stats);
+    setBattleFormat(ctx, format);
+
+    // Cada batalha recebe um sub-fluxo próprio do gerador principal
+    BattleRng master;
+    battleRngSeed(&master, seed);
+
+    long wins[2] = {0, 0};
+    long draws = 0;
+    long totalTurns = 0;
+
+    clock_t start = clock();
+    for (long b = 0; b < battles; b++) {
+        battleRngFork(&master, &ctx->rng);
+
+        MonsterList* player = createTeamFromSpec(&specs[0], &ctx->rng);
+        MonsterList* opponent = createTeamFromSpec(&specs[1], &ctx->rng);
+
+        int winner = playHeadlessBattle(ctx, player, opponent, policies[0], policies[1], maxTurns);
+        if (winner == 1) wins[0]++;
+        else if (winner == 2) wins[1]++;
+        else draws++;
+        totalTurns += ctx->turn - 1;
+
+        freeMonsterList(player);
+        freeMonsterList(opponent);
+    }
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("{\n");
+    printf("  \"battles\": %ld,\n", battles);
+    printf("  \"seed\": %llu,\n", seed);
+    printf("  \"maxTurns\": %d,\n", maxTurns);
+    printf("  \"format\": \"%s\",\n", getBattleFormatName(format));
+    printf("  \"sides\": [\n");
+    for (int side = 0; side < 2; side++) {
+        printf("    {\"team\": ");
+        printJsonString(teamText[side]);
+        printf(", \"policy\": \"%s\", \"wins\": %ld, \"winRate\": %.4f}%s\n",
+               getBotPolicyName(policies[side]), wins[side], (double)wins[side] / battles,
+               side == 0 ? "," : "");
+    }
+    printf("  ],\n");
+    printf("  \"draws\": %ld,\n", draws);
+    printf("  \"avgTurns\": %.3f,\n", (double)totalTurns / battles);
+    printf("  \"battlesPerSecond\": %.1f,\n", seconds > 0.0 ? battles / seconds : 0.0);
+
+    printf("  \"moves\": [");
+    for (int i = 0; i < stats->moveCount; i++) {
+        printf("%s\n    {\"name\": ", i == 0 ? "" : ",");
+        printJsonString(stats->moves[i].name);
+        printf(", \"hits\": %ld, \"damage\": %ld, \"avgDamage\": %.2f}",
+               stats->moves[i].hits, stats->moves[i].damage,
+               (double)stats->moves[i].damage / stats->moves[i].hits);
+    }
+    printf("%s],\n", stats->moveCount > 0 ? "\n  " : "");
+
+    printf("  \"faints\": [");
+    for (int i = 0; i < stats->faintCount; i++) {
+        printf("%s\n    {\"monster\": ", i == 0 ? "" : ",");
+        printJsonString(stats->faints[i].name);
+        printf(", \"count\": %ld}", stats->faints[i].count);
+    }
+    printf("%s]\n", stats->faintCount > 0 ? "\n  " : "");
+    printf("}\n");
+
+    free(stats);
+    freeBattleContext(ctx);
+    freePolicyNet(net);
+    freeMonsterDatabase();
+    return 0;
+}
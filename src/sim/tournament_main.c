@@ -0,0 +1,589 @@
+/**
+ * PokeBattle - pokebattle-tournament
+ *
+ * Torneio entre políticas de bot, em todos os núcleos, com rating Elo.
+ * Exemplo:
+ *
+ *   pokebattle-tournament --policies random,first,greedy,simple --games 400
+ *   pokebattle-tournament --policies greedy,simple,expectimax,mcts --mode swiss --rounds 4
+ *
+ * Cada série entre dois bots joga partidas em pares espelhados: os mesmos
+ * dois times sorteados, trocando quem fica com cada time e de lado. Toda
+ * partida tem semente própria (da semente geral, da rodada, dos jogadores
+ * e do número da partida), então o resultado não depende das threads.
+ *
+ * O Elo é o máximo de verossimilhança do modelo de Bradley-Terry (empate
+ * vale meia vitória), com média 1500. Cada bot ganha também um empate
+ * virtual contra um adversário de 1500, para que quem perde ou ganha tudo
+ * não vá ao infinito. O intervalo de 95% vem da informação de Fisher de
+ * cada rating, sem contar a covariância entre eles.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "battle_sim.h"
+#include "monster_data.h"
+#include "work_pool.h"
+
+#define TOURNAMENT_MAX_PLAYERS 16
+#define TOURNAMENT_GRAIN 8          // Partidas por tarefa
+#define TOURNAMENT_ELO_ITERATIONS 10000
+
+typedef enum {
+    TOURNAMENT_ROUND_ROBIN,
+    TOURNAMENT_SWISS
+} TournamentMode;
+
+typedef struct TournamentJob TournamentJob;
+
+// Uma série de partidas entre dois jogadores numa rodada
+typedef struct {
+    int a;
+    int b;
+    int round;
+} Pairing;
+
+typedef struct {
+    TournamentJob* job;
+    const Pairing* pairing;
+    int firstGame;
+    int gameCount;
+    int winsA;          // Resultados do ponto de vista de a
+    int winsB;
+    int draws;
+    long turns;
+} GameChunk;
+
+struct TournamentJob {
+    BotPolicy players[TOURNAMENT_MAX_PLAYERS];
+    char names[TOURNAMENT_MAX_PLAYERS][24];   // Política, com #2, #3... se repetida
+    int playerCount;
+    int games;
+    int teamSize;
+    int maxTurns;
+    BattleFormat format;
+    uint64_t seed;
+    WorkPool* pool;
+    BattleContext** contexts;   // Um por thread do pool
+
+    // wins[i][j]: vitórias de i sobre j; draws é simétrica
+    long wins[TOURNAMENT_MAX_PLAYERS][TOURNAMENT_MAX_PLAYERS];
+    long draws[TOURNAMENT_MAX_PLAYERS][TOURNAMENT_MAX_PLAYERS];
+    bool played[TOURNAMENT_MAX_PLAYERS][TOURNAMENT_MAX_PLAYERS];
+    bool hadBye[TOURNAMENT_MAX_PLAYERS];
+    long totalGames;
+    long totalTurns;
+};
+
+typedef struct {
+    int player;
+    double elo;
+    double margin;      // Metade do intervalo de 95%
+    long games;
+    long wins;
+    long losses;
+    long draws;
+} PlayerRating;
+
+static void printUsage(const char* program) {
+    printf("Uso: %s --policies P1,P2,... [opções]\n", program);
+    printf("  P: random | greedy | simple | expectimax | mcts | first | net (repetir vale)\n");
+    printf("  --mode M         round-robin | swiss (padrão: round-robin)\n");
+    printf("  --games N        partidas por série, arredondado para par (padrão: 200)\n");
+    printf("  --rounds R       rodadas do suíço (padrão: log2(bots) + 1)\n");
+    printf("  --team-size K    monstros sorteados por time (padrão: 3)\n");
+    printf("  --seed S         semente (padrão: 1)\n");
+    printf("  --threads T      threads (padrão: todos os núcleos)\n");
+    printf("  --max-turns T    limite de turnos por partida (padrão: 200)\n");
+    printf("  --format F       singles | doubles | triples (padrão: singles)\n");
+    printf("  --net ARQUIVO    pesos da política net (padrão: resources/%s)\n", POLICY_NET_FILE);
+    printf("  --json           imprime o resultado em JSON\n");
+}
+
+static bool parsePolicies(const char* text, TournamentJob* job) {
+    char buffer[256];
+    strncpy(buffer, text, sizeof(buffer) - 1);
+    buffer[sizeof(buffer) - 1] = '\0';
+
+    job->playerCount = 0;
+    for (char* name = strtok(buffer, ","); name != NULL; name = strtok(NULL, ",")) {
+        if (job->playerCount >= TOURNAMENT_MAX_PLAYERS) {
+            printf("ERRO: no máximo %d bots por torneio\n", TOURNAMENT_MAX_PLAYERS);
+            return false;
+        }
+        if (!parseBotPolicy(name, &job->players[job->playerCount])) {
+            printf("ERRO: política desconhecida: %s\n", name);
+            return false;
+        }
+
+        int repeated = 1;
+        for (int i = 0; i < job->playerCount; i++) {
+            repeated += job->players[i] == job->players[job->playerCount];
+        }
+        if (repeated > 1) {
+            snprintf(job->names[job->playerCount], sizeof(job->names[0]), "%s#%d", name, repeated);
+        } else {
+            snprintf(job->names[job->playerCount], sizeof(job->names[0]), "%s", name);
+        }
+        job->playerCount++;
+    }
+    return job->playerCount >= 2;
+}
+
+// Semente de uma partida; o par espelhado (game / 2) divide a dos times
+static uint64_t gameSeed(const TournamentJob* job, const Pairing* pairing, long game) {
+    uint64_t key = (((uint64_t)pairing->round * TOURNAMENT_MAX_PLAYERS + pairing->a) *
+                    TOURNAMENT_MAX_PLAYERS + pairing->b) * 1000003ULL + (uint64_t)game;
+    return job->seed ^ ((key + 1) * 0x9E3779B97F4A7C15ULL);
+}
+
+// Partidas pares: a no lado do jogador com o primeiro time. Ímpares: os
+// mesmos times trocados, com b no lado do jogador
+static int playGame(TournamentJob* job, BattleContext* ctx, const Pairing* pairing, int game) {
+    TeamSpec spec;
+    memset(&spec, 0, sizeof(spec));
+    spec.randomCount = job->teamSize;
+
+    BattleRng teamRng;
+    battleRngSeed(&teamRng, gameSeed(job, pairing, game / 2) ^ 0xD1B54A32D192ED03ULL);
+    MonsterList* first = createTeamFromSpec(&spec, &teamRng);
+    MonsterList* second = createTeamFromSpec(&spec, &teamRng);
+
+    seedBattleContext(ctx, gameSeed(job, pairing, game));
+    bool mirrored = (game % 2) == 1;
+    int winner = mirrored ?
+                 playHeadlessBattle(ctx, first, second, job->players[pairing->b], job->players[pairing->a], job->maxTurns) :
+                 playHeadlessBattle(ctx, first, second, job->players[pairing->a], job->players[pairing->b], job->maxTurns);
+
+    freeMonsterList(first);
+    freeMonsterList(second);
+
+    // 1: a venceu, 2: b venceu, 0: empate
+    if (winner == 0) {
+        return 0;
+    }
+    return (winner == 1) != mirrored ? 1 : 2;
+}
+
+static void runGameChunk(void* arg, int workerIndex) {
+    GameChunk* chunk = (GameChunk*)arg;
+    TournamentJob* job = chunk->job;
+    BattleContext* ctx = job->contexts[workerIndex];
+
+    for (int g = chunk->firstGame; g < chunk->firstGame + chunk->gameCount; g++) {
+        int result = playGame(job, ctx, chunk->pairing, g);
+        if (result == 1) chunk->winsA++;
+        else if (result == 2) chunk->winsB++;
+        else chunk->draws++;
+        chunk->turns += ctx->turn - 1;
+    }
+}
+
+// Joga todas as séries de uma rodada e soma os resultados na ordem das
+// séries (não na ordem em que as threads terminaram)
+static bool playRound(TournamentJob* job, const Pairing* pairings, int pairingCount) {
+    int chunksPerPairing = (job->games + TOURNAMENT_GRAIN - 1) / TOURNAMENT_GRAIN;
+    GameChunk* chunks = (GameChunk*)calloc((size_t)pairingCount * chunksPerPairing, sizeof(GameChunk));
+    if (chunks == NULL) {
+        printf("ERRO: memória insuficiente para a rodada\n");
+        return false;
+    }
+
+    int chunkCount = 0;
+    for (int p = 0; p < pairingCount; p++) {
+        for (int first = 0; first < job->games; first += TOURNAMENT_GRAIN) {
+            GameChunk* chunk = &chunks[chunkCount++];
+            chunk->job = job;
+            chunk->pairing = &pairings[p];
+            chunk->firstGame = first;
+            chunk->gameCount = job->games - first < TOURNAMENT_GRAIN ? job->games - first : TOURNAMENT_GRAIN;
+            submitWorkTask(job->pool, runGameChunk, chunk);
+        }
+    }
+    waitWorkPool(job->pool);
+
+    for (int c = 0; c < chunkCount; c++) {
+        const Pairing* pairing = chunks[c].pairing;
+        job->wins[pairing->a][pairing->b] += chunks[c].winsA;
+        job->wins[pairing->b][pairing->a] += chunks[c].winsB;
+        job->draws[pairing->a][pairing->b] += chunks[c].draws;
+        job->draws[pairing->b][pairing->a] += chunks[c].draws;
+        job->totalGames += chunks[c].gameCount;
+        job->totalTurns += chunks[c].turns;
+    }
+    for (int p = 0; p < pairingCount; p++) {
+        job->played[pairings[p].a][pairings[p].b] = true;
+        job->played[pairings[p].b][pairings[p].a] = true;
+    }
+
+    free(chunks);
+    return true;
+}
+
+static double playerPoints(const TournamentJob* job, int player) {
+    double points = 0.0;
+    for (int j = 0; j < job->playerCount; j++) {
+        points += job->wins[player][j] + 0.5 * job->draws[player][j];
+    }
+    return points;
+}
+
+// Suíço: emparelha de cima para baixo na pontuação, evitando revanches
+// quando dá. Com número ímpar, o último sem folga ainda fica de fora
+static int buildSwissRound(TournamentJob* job, int round, Pairing* pairings) {
+    int order[TOURNAMENT_MAX_PLAYERS];
+    double points[TOURNAMENT_MAX_PLAYERS];
+    for (int i = 0; i < job->playerCount; i++) {
+        order[i] = i;
+        points[i] = playerPoints(job, i);
+    }
+    for (int i = 1; i < job->playerCount; i++) {
+        int player = order[i];
+        int j = i;
+        while (j > 0 && points[order[j - 1]] < points[player]) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = player;
+    }
+
+    bool paired[TOURNAMENT_MAX_PLAYERS] = {false};
+    if (job->playerCount % 2 == 1) {
+        int bye = job->playerCount - 1;
+        while (bye > 0 && job->hadBye[order[bye]]) {
+            bye--;
+        }
+        paired[order[bye]] = true;
+        job->hadBye[order[bye]] = true;
+    }
+
+    int count = 0;
+    for (int i = 0; i < job->playerCount; i++) {
+        int a = order[i];
+        if (paired[a]) continue;
+
+        int opponent = -1;
+        for (int j = i + 1; j < job->playerCount && opponent < 0; j++) {
+            if (!paired[order[j]] && !job->played[a][order[j]]) {
+                opponent = order[j];
+            }
+        }
+        for (int j = i + 1; j < job->playerCount && opponent < 0; j++) {
+            if (!paired[order[j]]) {
+                opponent = order[j];
+            }
+        }
+        if (opponent < 0) continue;
+
+        paired[a] = true;
+        paired[opponent] = true;
+        pairings[count].a = a;
+        pairings[count].b = opponent;
+        pairings[count].round = round;
+        count++;
+    }
+    return count;
+}
+
+// Bradley-Terry pelo algoritmo MM, com o empate virtual contra 1500
+static void computeRatings(const TournamentJob* job, PlayerRating* ratings) {
+    int n = job->playerCount;
+    double gamma[TOURNAMENT_MAX_PLAYERS];
+    for (int i = 0; i < n; i++) {
+        gamma[i] = 1.0;
+    }
+
+    for (int iteration = 0; iteration < TOURNAMENT_ELO_ITERATIONS; iteration++) {
+        double change = 0.0;
+        for (int i = 0; i < n; i++) {
+            double score = 0.5;
+            double denominator = 1.0 / (gamma[i] + 1.0);
+            for (int j = 0; j < n; j++) {
+                long games = job->wins[i][j] + job->wins[j][i] + job->draws[i][j];
+                if (j == i || games == 0) continue;
+                score += job->wins[i][j] + 0.5 * job->draws[i][j];
+                denominator += games / (gamma[i] + gamma[j]);
+            }
+            double updated = score / denominator;
+            change = fmax(change, fabs(log(updated / gamma[i])));
+            gamma[i] = updated;
+        }
+        if (change < 1e-10) {
+            break;
+        }
+    }
+
+    double meanLog = 0.0;
+    for (int i = 0; i < n; i++) {
+        meanLog += log(gamma[i]) / n;
+    }
+
+    const double eloPerNat = 400.0 / log(10.0);
+    for (int i = 0; i < n; i++) {
+        PlayerRating* rating = &ratings[i];
+        memset(rating, 0, sizeof(PlayerRating));
+        rating->player = i;
+        rating->elo = 1500.0 + eloPerNat * (log(gamma[i]) - meanLog);
+
+        double information = gamma[i] / ((gamma[i] + 1.0) * (gamma[i] + 1.0));
+        for (int j = 0; j < n; j++) {
+            if (j == i) continue;
+            long games = job->wins[i][j] + job->wins[j][i] + job->draws[i][j];
+            double p = gamma[i] / (gamma[i] + gamma[j]);
+            information += games * p * (1.0 - p);
+            rating->games += games;
+            rating->wins += job->wins[i][j];
+            rating->losses += job->wins[j][i];
+            rating->draws += job->draws[i][j];
+        }
+        rating->margin = 1.96 * eloPerNat / sqrt(information);
+    }
+}
+
+static int compareRatings(const void* a, const void* b) {
+    const PlayerRating* first = (const PlayerRating*)a;
+    const PlayerRating* second = (const PlayerRating*)b;
+    if (first->elo != second->elo) {
+        return first->elo > second->elo ? -1 : 1;
+    }
+    return first->player - second->player;
+}
+
+static void printTable(const TournamentJob* job, const PlayerRating* ratings) {
+    printf("\n%-4s %-12s %7s %8s %8s %7s %7s %7s %8s\n",
+           "Pos", "Bot", "Elo", "IC95", "Partidas", "V", "D", "E", "Pontos");
+    for (int r = 0; r < job->playerCount; r++) {
+        const PlayerRating* rating = &ratings[r];
+        char margin[16];
+        snprintf(margin, sizeof(margin), "±%.0f", rating->margin);   // "±" ocupa 2 bytes
+        printf("%-4d %-12s %7.0f %9s %8ld %7ld %7ld %7ld %7.1f%%\n",
+               r + 1, job->names[rating->player], rating->elo, margin,
+               rating->games, rating->wins, rating->losses, rating->draws,
+               rating->games > 0 ? 100.0 * (rating->wins + 0.5 * rating->draws) / rating->games : 0.0);
+    }
+
+    // Confronto direto: pontos da linha contra a coluna
+    printf("\n%-16s", "");
+    for (int c = 0; c < job->playerCount; c++) {
+        printf(" %10s", job->names[ratings[c].player]);
+    }
+    printf("\n");
+    for (int r = 0; r < job->playerCount; r++) {
+        int i = ratings[r].player;
+        printf("%-16s", job->names[i]);
+        for (int c = 0; c < job->playerCount; c++) {
+            int j = ratings[c].player;
+            long games = job->wins[i][j] + job->wins[j][i] + job->draws[i][j];
+            if (i == j || games == 0) {
+                printf(" %10s", "-");
+            } else {
+                printf(" %9.1f%%", 100.0 * (job->wins[i][j] + 0.5 * job->draws[i][j]) / games);
+            }
+        }
+        printf("\n");
+    }
+}
+
+static void printJson(const TournamentJob* job, const PlayerRating* ratings, TournamentMode mode,
+                      int rounds, double seconds, int threads) {
+    printf("{\n");
+    printf("  \"mode\": \"%s\",\n", mode == TOURNAMENT_SWISS ? "swiss" : "round-robin");
+    printf("  \"rounds\": %d,\n", rounds);
+    printf("  \"gamesPerSeries\": %d,\n", job->games);
+    printf("  \"teamSize\": %d,\n", job->teamSize);
+    printf("  \"seed\": %llu,\n", (unsigned long long)job->seed);
+    printf("  \"format\": \"%s\",\n", getBattleFormatName(job->format));
+    printf("  \"threads\": %d,\n", threads);
+    printf("  \"games\": %ld,\n", job->totalGames);
+    printf("  \"avgTurns\": %.3f,\n", job->totalGames > 0 ? (double)job->totalTurns / job->totalGames : 0.0);
+    printf("  \"gamesPerSecond\": %.1f,\n", seconds > 0.0 ? job->totalGames / seconds : 0.0);
+    printf("  \"ratings\": [\n");
+    for (int r = 0; r < job->playerCount; r++) {
+        const PlayerRating* rating = &ratings[r];
+        printf("    {\"name\": \"%s\", \"policy\": \"%s\", \"entry\": %d, \"elo\": %.1f, \"ciLow\": %.1f, \"ciHigh\": %.1f, "
+               "\"games\": %ld, \"wins\": %ld, \"losses\": %ld, \"draws\": %ld}%s\n",
+               job->names[rating->player], getBotPolicyName(job->players[rating->player]), rating->player, rating->elo,
+               rating->elo - rating->margin, rating->elo + rating->margin,
+               rating->games, rating->wins, rating->losses, rating->draws,
+               r + 1 < job->playerCount ? "," : "");
+    }
+    printf("  ]\n");
+    printf("}\n");
+}
+
+int main(int argc, char** argv) {
+    static TournamentJob job;
+    memset(&job, 0, sizeof(job));
+    job.games = 200;
+    job.teamSize = 3;
+    job.maxTurns = 200;
+    job.format = BATTLE_FORMAT_SINGLES;
+    job.seed = 1;
+
+    const char* policies = NULL;
+    TournamentMode mode = TOURNAMENT_ROUND_ROBIN;
+    int rounds = 0;
+    int threads = 0;
+    bool json = false;
+    const char* netPath = "resources/" POLICY_NET_FILE;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            printUsage(argv[0]);
+            return 0;
+        }
+        if (strcmp(arg, "--json") == 0) {
+            json = true;
+            continue;
+        }
+
+        const char* value = (i + 1 < argc) ? argv[++i] : NULL;
+        if (value == NULL) {
+            printf("ERRO: faltou o valor de %s\n", arg);
+            return 1;
+        }
+
+        if (strcmp(arg, "--policies") == 0) policies = value;
+        else if (strcmp(arg, "--games") == 0) job.games = atoi(value);
+        else if (strcmp(arg, "--rounds") == 0) rounds = atoi(value);
+        else if (strcmp(arg, "--team-size") == 0) job.teamSize = atoi(value);
+        else if (strcmp(arg, "--seed") == 0) job.seed = strtoull(value, NULL, 10);
+        else if (strcmp(arg, "--threads") == 0) threads = atoi(value);
+        else if (strcmp(arg, "--max-turns") == 0) job.maxTurns = atoi(value);
+        else if (strcmp(arg, "--net") == 0) netPath = value;
+        else if (strcmp(arg, "--mode") == 0) {
+            if (strcmp(value, "round-robin") == 0) mode = TOURNAMENT_ROUND_ROBIN;
+            else if (strcmp(value, "swiss") == 0) mode = TOURNAMENT_SWISS;
+            else {
+                printf("ERRO: modo desconhecido: %s\n", value);
+                return 1;
+            }
+        } else if (strcmp(arg, "--format") == 0) {
+            if (!parseBattleFormat(value, &job.format)) {
+                printf("ERRO: formato desconhecido: %s\n", value);
+                return 1;
+            }
+        } else {
+            printf("ERRO: opção desconhecida: %s\n", arg);
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (policies == NULL || !parsePolicies(policies, &job) || job.games <= 0 || job.maxTurns <= 0 ||
+        job.teamSize < 1 || job.teamSize > SIM_MAX_TEAM_SIZE) {
+        printUsage(argv[0]);
+        return 1;
+    }
+    job.games += job.games % 2;    // Pares espelhados completos
+
+    battleDebugLog = false;
+    initializeMonsterDatabase();
+
+    // A rede é só lida durante as partidas: uma cópia para todas as threads
+    PolicyNet* net = NULL;
+    for (int i = 0; i < job.playerCount && net == NULL; i++) {
+        if (job.players[i] == BOT_POLICY_NET) {
+            net = loadPolicyNet(netPath);
+            if (net == NULL) {
+                printf("ERRO: não foi possível carregar a rede %s\n", netPath);
+                freeMonsterDatabase();
+                return 1;
+            }
+            setBotPolicyNet(net);
+        }
+    }
+
+    job.pool = createWorkPool(threads);
+    if (job.pool == NULL) {
+        printf("ERRO: não foi possível criar as threads\n");
+        freePolicyNet(net);
+        freeMonsterDatabase();
+        return 1;
+    }
+    int threadCount = getWorkPoolThreadCount(job.pool);
+    job.contexts = (BattleContext**)calloc(threadCount, sizeof(BattleContext*));
+    for (int i = 0; i < threadCount; i++) {
+        job.contexts[i] = createBattleContext();
+        setBattleFormat(job.contexts[i], job.format);
+    }
+
+    if (mode == TOURNAMENT_SWISS && rounds <= 0) {
+        rounds = 1;
+        while ((1 << (rounds - 1)) < job.playerCount) {
+            rounds++;
+        }
+    }
+    if (mode == TOURNAMENT_ROUND_ROBIN) {
+        rounds = 1;
+    }
+
+    if (!json) {
+        printf("Torneio %s: %d bots, %d partidas por série, times de %d (%s), %d threads\n",
+               mode == TOURNAMENT_SWISS ? "suíço" : "todos contra todos", job.playerCount, job.games,
+               job.teamSize, getBattleFormatName(job.format), threadCount);
+    }
+
+    struct timespec start, finish;
+    timespec_get(&start, TIME_UTC);
+
+    Pairing pairings[TOURNAMENT_MAX_PLAYERS * TOURNAMENT_MAX_PLAYERS / 2];
+    bool ok = true;
+    for (int round = 0; round < rounds && ok; round++) {
+        int count = 0;
+        if (mode == TOURNAMENT_ROUND_ROBIN) {
+            for (int a = 0; a < job.playerCount; a++) {
+                for (int b = a + 1; b < job.playerCount; b++) {
+                    pairings[count].a = a;
+                    pairings[count].b = b;
+                    pairings[count].round = round;
+                    count++;
+                }
+            }
+        } else {
+            count = buildSwissRound(&job, round, pairings);
+        }
+        ok = playRound(&job, pairings, count);
+
+        if (ok && !json && mode == TOURNAMENT_SWISS) {
+            printf("Rodada %d:", round + 1);
+            for (int p = 0; p < count; p++) {
+                printf(" %s x %s", job.names[pairings[p].a],
+                       job.names[pairings[p].b]);
+            }
+            printf("\n");
+        }
+    }
+
+    timespec_get(&finish, TIME_UTC);
+    double seconds = (finish.tv_sec - start.tv_sec) + (finish.tv_nsec - start.tv_nsec) / 1e9;
+
+    if (ok) {
+        PlayerRating ratings[TOURNAMENT_MAX_PLAYERS];
+        computeRatings(&job, ratings);
+        qsort(ratings, job.playerCount, sizeof(PlayerRating), compareRatings);
+
+        if (json) {
+            printJson(&job, ratings, mode, rounds, seconds, threadCount);
+        } else {
+            printTable(&job, ratings);
+            printf("\n%ld partidas em %.2fs (%.0f partidas/s, %.1f turnos em média)\n", job.totalGames, seconds,
+                   seconds > 0.0 ? job.totalGames / seconds : 0.0,
+                   job.totalGames > 0 ? (double)job.totalTurns / job.totalGames : 0.0);
+        }
+    }
+
+    for (int i = 0; i < threadCount; i++) {
+        freeBattleContext(job.contexts[i]);
+    }
+    free(job.contexts);
+    freeWorkPool(job.pool);
+    freePolicyNet(net);
+    freeMonsterDatabase();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,435 @@
+/**
+ * PokeBattle - pokebattle-train
+ *
+ * Treina a rede de política com as amostras do pokebattle-selfplay e grava
+ * os pesos quantizados (int8) no formato que o jogo carrega. O treino é em
+ * float: duas camadas ocultas com ReLU, softmax só entre as ações válidas
+ * e entropia cruzada contra a escolha da busca, com Adam em mini-lotes.
+ * As últimas amostras do arquivo (as últimas partidas) ficam de fora para
+ * validação; no fim a rede gravada é lida de volta e avaliada em int8, do
+ * jeito que o jogo vai usar. --data pode se repetir (os arquivos são
+ * juntados na ordem). Exemplo:
+ *
+ *   pokebattle-train --data selfplay.bin --data dagger.bin --out resources/policy.bin
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "battle_rng.h"
+#include "policy_net.h"
+
+#define TRAIN_INPUTS POLICY_NET_INPUTS
+#define TRAIN_HIDDEN POLICY_NET_HIDDEN
+#define TRAIN_OUTPUTS POLICY_NET_OUTPUTS
+
+// Parâmetros do Adam
+#define ADAM_BETA1 0.9f
+#define ADAM_BETA2 0.999f
+#define ADAM_EPSILON 1e-8f
+
+#define TRAIN_MAX_FILES 8
+
+typedef struct {
+    int rows;
+    int cols;
+    float* weights;      // rows x cols
+    float* biases;
+    float* gradWeights;
+    float* gradBiases;
+    float* momentWeights;    // Médias do Adam (primeiro e segundo momento)
+    float* varianceWeights;
+    float* momentBiases;
+    float* varianceBiases;
+} TrainLayer;
+
+typedef struct {
+    TrainLayer layers[POLICY_NET_LAYERS];
+    int step;
+} TrainNet;
+
+// Ativações de uma amostra, guardadas para a volta
+typedef struct {
+    float input[TRAIN_INPUTS];
+    float hidden1[TRAIN_HIDDEN];
+    float hidden2[TRAIN_HIDDEN];
+    float probabilities[TRAIN_OUTPUTS];
+} TrainActivations;
+
+static void printUsage(const char* program) {
+    printf("Uso: %s --data ARQUIVO [--data ARQUIVO ...] --out ARQUIVO [opções]\n", program);
+    printf("  --epochs N       passadas pelos dados (padrão: 30)\n");
+    printf("  --batch N        amostras por passo (padrão: 128)\n");
+    printf("  --lr X           taxa de aprendizado (padrão: 0.002)\n");
+    printf("  --validation X   fração final separada para validação (padrão: 0.1)\n");
+    printf("  --seed S         semente (padrão: 1)\n");
+}
+
+static double uniform(BattleRng* rng) {
+    return (battleRngNext(rng) >> 11) * 0x1.0p-53;
+}
+
+static bool initLayer(TrainLayer* layer, int rows, int cols, BattleRng* rng) {
+    size_t count = (size_t)rows * cols;
+    layer->rows = rows;
+    layer->cols = cols;
+    layer->weights = calloc(count, sizeof(float));
+    layer->gradWeights = calloc(count, sizeof(float));
+    layer->momentWeights = calloc(count, sizeof(float));
+    layer->varianceWeights = calloc(count, sizeof(float));
+    layer->biases = calloc(rows, sizeof(float));
+    layer->gradBiases = calloc(rows, sizeof(float));
+    layer->momentBiases = calloc(rows, sizeof(float));
+    layer->varianceBiases = calloc(rows, sizeof(float));
+    if (layer->weights == NULL || layer->gradWeights == NULL || layer->momentWeights == NULL ||
+        layer->varianceWeights == NULL || layer->biases == NULL || layer->gradBiases == NULL ||
+        layer->momentBiases == NULL || layer->varianceBiases == NULL) {
+        return false;
+    }
+
+    // Inicialização de He (uniforme com a mesma variância)
+    float limit = sqrtf(6.0f / cols);
+    for (size_t i = 0; i < count; i++) {
+        layer->weights[i] = (float)((uniform(rng) * 2.0 - 1.0) * limit);
+    }
+    return true;
+}
+
+static void freeLayer(TrainLayer* layer) {
+    free(layer->weights);
+    free(layer->gradWeights);
+    free(layer->momentWeights);
+    free(layer->varianceWeights);
+    free(layer->biases);
+    free(layer->gradBiases);
+    free(layer->momentBiases);
+    free(layer->varianceBiases);
+}
+
+static void forwardLayer(const TrainLayer* layer, const float* input, float* output, bool relu) {
+    for (int r = 0; r < layer->rows; r++) {
+        const float* row = layer->weights + (size_t)r * layer->cols;
+        float sum = layer->biases[r];
+        for (int c = 0; c < layer->cols; c++) {
+            sum += row[c] * input[c];
+        }
+        output[r] = (relu && sum < 0.0f) ? 0.0f : sum;
+    }
+}
+
+// Ida completa; devolve a perda da amostra
+static float forward(const TrainNet* net, const PolicySample* sample, TrainActivations* act) {
+    for (int i = 0; i < TRAIN_INPUTS; i++) {
+        act->input[i] = sample->features[i] / 127.0f;
+    }
+    forwardLayer(&net->layers[0], act->input, act->hidden1, true);
+    forwardLayer(&net->layers[1], act->hidden1, act->hidden2, true);
+
+    float logits[TRAIN_OUTPUTS];
+    forwardLayer(&net->layers[2], act->hidden2, logits, false);
+
+    // Softmax só entre as ações válidas
+    float largest = -1e30f;
+    for (int i = 0; i < TRAIN_OUTPUTS; i++) {
+        if ((sample->legalMask & (1u << i)) && logits[i] > largest) {
+            largest = logits[i];
+        }
+    }
+    float total = 0.0f;
+    for (int i = 0; i < TRAIN_OUTPUTS; i++) {
+        act->probabilities[i] = (sample->legalMask & (1u << i)) ? expf(logits[i] - largest) : 0.0f;
+        total += act->probabilities[i];
+    }
+    for (int i = 0; i < TRAIN_OUTPUTS; i++) {
+        act->probabilities[i] /= total;
+    }
+
+    return -logf(fmaxf(act->probabilities[sample->action], 1e-12f));
+}
+
+// Acumula o gradiente da camada e devolve o da entrada (se inputGrad != NULL)
+static void backwardLayer(TrainLayer* layer, const float* input, const float* outputGrad, float* inputGrad) {
+    if (inputGrad != NULL) {
+        memset(inputGrad, 0, layer->cols * sizeof(float));
+    }
+    for (int r = 0; r < layer->rows; r++) {
+        float grad = outputGrad[r];
+        if (grad == 0.0f) continue;
+
+        float* row = layer->weights + (size_t)r * layer->cols;
+        float* gradRow = layer->gradWeights + (size_t)r * layer->cols;
+        for (int c = 0; c < layer->cols; c++) {
+            gradRow[c] += grad * input[c];
+        }
+        layer->gradBiases[r] += grad;
+        if (inputGrad != NULL) {
+            for (int c = 0; c < layer->cols; c++) {
+                inputGrad[c] += grad * row[c];
+            }
+        }
+    }
+}
+
+static void backward(TrainNet* net, const PolicySample* sample, const TrainActivations* act) {
+    float outputGrad[TRAIN_OUTPUTS];
+    float hidden2Grad[TRAIN_HIDDEN];
+    float hidden1Grad[TRAIN_HIDDEN];
+
+    for (int i = 0; i < TRAIN_OUTPUTS; i++) {
+        outputGrad[i] = act->probabilities[i] - (i == sample->action ? 1.0f : 0.0f);
+    }
+    backwardLayer(&net->layers[2], act->hidden2, outputGrad, hidden2Grad);
+    for (int i = 0; i < TRAIN_HIDDEN; i++) {
+        if (act->hidden2[i] <= 0.0f) hidden2Grad[i] = 0.0f;
+    }
+    backwardLayer(&net->layers[1], act->hidden1, hidden2Grad, hidden1Grad);
+    for (int i = 0; i < TRAIN_HIDDEN; i++) {
+        if (act->hidden1[i] <= 0.0f) hidden1Grad[i] = 0.0f;
+    }
+    backwardLayer(&net->layers[0], act->input, hidden1Grad, NULL);
+}
+
+static void adamUpdate(float* values, float* grads, float* moments, float* variances, size_t count,
+                       float learningRate, float scale, float correction1, float correction2) {
+    for (size_t i = 0; i < count; i++) {
+        float grad = grads[i] * scale;
+        moments[i] = ADAM_BETA1 * moments[i] + (1.0f - ADAM_BETA1) * grad;
+        variances[i] = ADAM_BETA2 * variances[i] + (1.0f - ADAM_BETA2) * grad * grad;
+        values[i] -= learningRate * (moments[i] / correction1) / (sqrtf(variances[i] / correction2) + ADAM_EPSILON);
+        grads[i] = 0.0f;
+    }
+}
+
+static void applyGradients(TrainNet* net, int batchSize, float learningRate) {
+    net->step++;
+    float correction1 = 1.0f - powf(ADAM_BETA1, (float)net->step);
+    float correction2 = 1.0f - powf(ADAM_BETA2, (float)net->step);
+    for (int i = 0; i < POLICY_NET_LAYERS; i++) {
+        TrainLayer* layer = &net->layers[i];
+        adamUpdate(layer->weights, layer->gradWeights, layer->momentWeights, layer->varianceWeights,
+                   (size_t)layer->rows * layer->cols, learningRate, 1.0f / batchSize, correction1, correction2);
+        adamUpdate(layer->biases, layer->gradBiases, layer->momentBiases, layer->varianceBiases,
+                   (size_t)layer->rows, learningRate, 1.0f / batchSize, correction1, correction2);
+    }
+}
+
+static int argmaxLegal(const float* values, uint16_t legalMask) {
+    int best = -1;
+    for (int i = 0; i < TRAIN_OUTPUTS; i++) {
+        if ((legalMask & (1u << i)) && (best < 0 || values[i] > values[best])) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+// Perda média e acerto (escolha igual à da busca) em float
+static void evaluateFloat(const TrainNet* net, const PolicySample* samples, long count,
+                          double* loss, double* accuracy) {
+    TrainActivations act;
+    double totalLoss = 0.0;
+    long correct = 0;
+    for (long i = 0; i < count; i++) {
+        totalLoss += forward(net, &samples[i], &act);
+        correct += argmaxLegal(act.probabilities, samples[i].legalMask) == samples[i].action;
+    }
+    *loss = count > 0 ? totalLoss / count : 0.0;
+    *accuracy = count > 0 ? (double)correct / count : 0.0;
+}
+
+int main(int argc, char** argv) {
+    const char* dataPaths[TRAIN_MAX_FILES];
+    int dataCount = 0;
+    const char* outPath = NULL;
+    int epochs = 30;
+    int batchSize = 128;
+    float learningRate = 0.002f;
+    double validationFraction = 0.1;
+    uint64_t seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0) {
+            printUsage(argv[0]);
+            return 0;
+        }
+
+        const char* value = (i + 1 < argc) ? argv[++i] : NULL;
+        if (value == NULL) {
+            printf("ERRO: faltou o valor de %s\n", arg);
+            return 1;
+        }
+
+        if (strcmp(arg, "--data") == 0) {
+            if (dataCount == TRAIN_MAX_FILES) {
+                printf("ERRO: no máximo %d arquivos de amostras\n", TRAIN_MAX_FILES);
+                return 1;
+            }
+            dataPaths[dataCount++] = value;
+        }
+        else if (strcmp(arg, "--out") == 0) outPath = value;
+        else if (strcmp(arg, "--epochs") == 0) epochs = atoi(value);
+        else if (strcmp(arg, "--batch") == 0) batchSize = atoi(value);
+        else if (strcmp(arg, "--lr") == 0) learningRate = (float)atof(value);
+        else if (strcmp(arg, "--validation") == 0) validationFraction = atof(value);
+        else if (strcmp(arg, "--seed") == 0) seed = strtoull(value, NULL, 10);
+        else {
+            printf("ERRO: opção desconhecida: %s\n", arg);
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (dataCount == 0 || outPath == NULL || epochs <= 0 || batchSize <= 0 || learningRate <= 0.0f ||
+        validationFraction < 0.0 || validationFraction >= 1.0) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    // Juntar os arquivos na ordem
+    long count = 0;
+    PolicySample* samples = NULL;
+    for (int i = 0; i < dataCount; i++) {
+        long fileCount;
+        PolicySample* fileSamples = loadPolicySamples(dataPaths[i], &fileCount);
+        PolicySample* grown = fileSamples != NULL ?
+                              realloc(samples, (count + fileCount + 1) * sizeof(PolicySample)) : NULL;
+        if (grown == NULL) {
+            free(fileSamples);
+            free(samples);
+            return 1;
+        }
+        samples = grown;
+        memcpy(samples + count, fileSamples, fileCount * sizeof(PolicySample));
+        count += fileCount;
+        free(fileSamples);
+    }
+
+    long validationCount = (long)(count * validationFraction);
+    long trainCount = count - validationCount;
+    const PolicySample* validation = samples + trainCount;
+    if (trainCount <= 0) {
+        printf("ERRO: amostras insuficientes\n");
+        free(samples);
+        return 1;
+    }
+
+    BattleRng rng;
+    battleRngSeed(&rng, seed);
+
+    TrainNet net;
+    memset(&net, 0, sizeof(net));
+    static const int rows[POLICY_NET_LAYERS] = { TRAIN_HIDDEN, TRAIN_HIDDEN, TRAIN_OUTPUTS };
+    static const int cols[POLICY_NET_LAYERS] = { TRAIN_INPUTS, TRAIN_HIDDEN, TRAIN_HIDDEN };
+    long* order = malloc(trainCount * sizeof(long));
+    bool ok = order != NULL;
+    for (int i = 0; i < POLICY_NET_LAYERS && ok; i++) {
+        ok = initLayer(&net.layers[i], rows[i], cols[i], &rng);
+    }
+    if (!ok) {
+        printf("ERRO: memória insuficiente\n");
+    }
+
+    printf("Treino: %ld amostras (%ld de validação), %d épocas, lote %d\n",
+           count, validationCount, epochs, batchSize);
+
+    struct timespec start, finish;
+    timespec_get(&start, TIME_UTC);
+
+    for (long i = 0; ok && i < trainCount; i++) {
+        order[i] = i;
+    }
+    for (int epoch = 0; ok && epoch < epochs; epoch++) {
+        // Embaralhar (Fisher-Yates)
+        for (long i = trainCount - 1; i > 0; i--) {
+            long j = (long)(uniform(&rng) * (i + 1));
+            long swap = order[i];
+            order[i] = order[j];
+            order[j] = swap;
+        }
+
+        // Taxa cai pela metade no último terço
+        float rate = epoch >= epochs * 2 / 3 ? learningRate * 0.5f : learningRate;
+        double totalLoss = 0.0;
+        TrainActivations act;
+        for (long first = 0; first < trainCount; first += batchSize) {
+            long last = first + batchSize < trainCount ? first + batchSize : trainCount;
+            for (long i = first; i < last; i++) {
+                const PolicySample* sample = &samples[order[i]];
+                totalLoss += forward(&net, sample, &act);
+                backward(&net, sample, &act);
+            }
+            applyGradients(&net, (int)(last - first), rate);
+        }
+
+        double validationLoss = 0.0, validationAccuracy = 0.0;
+        evaluateFloat(&net, validation, validationCount, &validationLoss, &validationAccuracy);
+        printf("Época %2d: perda %.4f, validação %.4f (acerto %.1f%%)\n", epoch + 1,
+               totalLoss / trainCount, validationLoss, validationAccuracy * 100.0);
+    }
+
+    timespec_get(&finish, TIME_UTC);
+    double seconds = (finish.tv_sec - start.tv_sec) + (finish.tv_nsec - start.tv_nsec) / 1e9;
+
+    if (ok) {
+        PolicyNetLayerWeights weights[POLICY_NET_LAYERS];
+        for (int i = 0; i < POLICY_NET_LAYERS; i++) {
+            weights[i].weights = net.layers[i].weights;
+            weights[i].biases = net.layers[i].biases;
+        }
+        ok = savePolicyNet(outPath, weights);
+    }
+
+    // A rede gravada, em int8, contra as mesmas amostras de validação
+    PolicyNet* quantized = ok ? loadPolicyNet(outPath) : NULL;
+    if (quantized != NULL) {
+        double floatLoss = 0.0, floatAccuracy = 0.0;
+        evaluateFloat(&net, validation, validationCount, &floatLoss, &floatAccuracy);
+
+        // Primeiro só a rede int8, para medir o tempo dela
+        int* choices = malloc((validationCount > 0 ? validationCount : 1) * sizeof(int));
+        struct timespec evalStart, evalFinish;
+        timespec_get(&evalStart, TIME_UTC);
+        for (long i = 0; choices != NULL && i < validationCount; i++) {
+            float features[TRAIN_INPUTS];
+            float logits[TRAIN_OUTPUTS];
+            for (int f = 0; f < TRAIN_INPUTS; f++) {
+                features[f] = validation[i].features[f] / 127.0f;
+            }
+            evaluatePolicyNet(quantized, features, logits);
+            choices[i] = argmaxLegal(logits, validation[i].legalMask);
+        }
+        timespec_get(&evalFinish, TIME_UTC);
+        double evalUs = ((evalFinish.tv_sec - evalStart.tv_sec) * 1e6 +
+                         (evalFinish.tv_nsec - evalStart.tv_nsec) / 1e3);
+
+        long correct = 0;
+        long agree = 0;
+        for (long i = 0; choices != NULL && i < validationCount; i++) {
+            TrainActivations act;
+            forward(&net, &validation[i], &act);
+            correct += choices[i] == validation[i].action;
+            agree += choices[i] == argmaxLegal(act.probabilities, validation[i].legalMask);
+        }
+        free(choices);
+
+        printf("Pesos em %s (%s). Validação: float %.1f%%, int8 %.1f%% (mesma escolha do float em %.1f%%)\n",
+               outPath, getPolicyNetKernelName(), floatAccuracy * 100.0,
+               validationCount > 0 ? correct * 100.0 / validationCount : 0.0,
+               validationCount > 0 ? agree * 100.0 / validationCount : 0.0);
+        printf("Treino em %.1fs; rede int8: %.2f us por decisão\n", seconds,
+               validationCount > 0 ? evalUs / validationCount : 0.0);
+        freePolicyNet(quantized);
+    } else if (ok) {
+        ok = false;
+    }
+
+    for (int i = 0; i < POLICY_NET_LAYERS; i++) {
+        freeLayer(&net.layers[i]);
+    }
+    free(order);
+    free(samples);
+    return ok ? 0 : 1;
+}